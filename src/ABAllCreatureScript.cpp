@@ -3,6 +3,7 @@
 #include "ABConfig.h"
 #include "ABCreatureInfo.h"
 #include "ABMapInfo.h"
+#include "ABMetrics.h"
 #include "ABScriptMgr.h"
 #include "ABUtils.h"
 #include "AutoBalance.h"
@@ -12,6 +13,7 @@
 void AutoBalance_AllCreatureScript::OnBeforeCreatureSelectLevel(const CreatureTemplate* /*creatureTemplate*/, Creature* creature, uint8& level)
 {
     Map* creatureMap = creature->GetMap();
+    AutoBalanceMetricsTimer metricsTimer(creatureMap, AUTOBALANCE_METRIC_CREATURES);
 
     if (creatureMap && creatureMap->IsDungeon())
     {
@@ -29,6 +31,9 @@ void AutoBalance_AllCreatureScript::OnBeforeCreatureSelectLevel(const CreatureTe
         // mark this creature as brand new so that only the level will be modified before creation
         creatureABInfo->isBrandNew = true;
 
+        // resolve the creature's policy while its summoner is known
+        GetCreaturePolicy(creature, creatureABInfo);
+
         // if the creature already has a selectedLevel on it, we have already processed it and can re-use that value
         if (creatureABInfo->selectedLevel)
         {
@@ -39,6 +44,25 @@ void AutoBalance_AllCreatureScript::OnBeforeCreatureSelectLevel(const CreatureTe
             );
 
             level = creatureABInfo->selectedLevel;
+
+            // dead creatures are dropped from the update queue; a respawn selects the level again, so queue it to be reset and modified
+            if (creature->isDead() || creatureABInfo->wasAliveNowDead)
+                QueueCreatureForUpdate(creature);
+
+            return;
+        }
+
+        // during a spawn burst, only register the creature - it will be scaled with the rest of the burst on the next map update
+        if (JoinSpawnBurst(creature))
+        {
+            creatureABInfo->UnmodifiedLevel = level;
+            AddCreatureToMapCreatureList(creature);
+
+            LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::OnBeforeCreatureSelectLevel: Creature {} ({}) | is part of a spawn burst and will be scaled on the next map update.",
+                creature->GetName(),
+                creatureABInfo->UnmodifiedLevel
+            );
+
             return;
         }
 
@@ -106,6 +130,8 @@ void AutoBalance_AllCreatureScript::OnCreatureSelectLevel(const CreatureTemplate
         return;
     }
 
+    AutoBalanceMetricsTimer metricsTimer(creature->GetMap(), AUTOBALANCE_METRIC_CREATURES);
+
     // get the creature's info
     AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
@@ -130,6 +156,10 @@ void AutoBalance_AllCreatureScript::OnCreatureSelectLevel(const CreatureTemplate
             creatureABInfo->isBrandNew = false;
         }
 
+        // creatures in a spawn burst are scaled on the next map update
+        if (creatureABInfo->isInSpawnBurst)
+            return;
+
         // Update the map's data if it is out of date
         UpdateMapDataIfNeeded(creature->GetMap());
 
@@ -161,14 +191,16 @@ void AutoBalance_AllCreatureScript::OnCreatureSelectLevel(const CreatureTemplate
 
 void AutoBalance_AllCreatureScript::OnCreatureAddWorld(Creature* creature)
 {
+    AutoBalanceMetricsTimer metricsTimer(creature->GetMap(), AUTOBALANCE_METRIC_CREATURES);
+
     if (creature->GetMap()->IsDungeon())
     {
         Map* creatureMap = creature->GetMap();
         InstanceMap* instanceMap = creatureMap->ToInstanceMap();
         AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
-        // final checks on the creature before spawning
-        if (isCreatureRelevant(creature))
+        // final checks on the creature before spawning (creatures in a spawn burst haven't been modified yet)
+        if (!creatureABInfo->isInSpawnBurst && isCreatureRelevant(creature))
         {
             // level check
             if (creature->GetLevel() != creatureABInfo->selectedLevel && !creature->IsSummon())
@@ -199,6 +231,10 @@ void AutoBalance_AllCreatureScript::OnCreatureAddWorld(Creature* creature)
             }
         }
 
+        // track the creature so that map-wide changes reach it, and give it its post-spawn update
+        RegisterScalableCreature(creature);
+        QueueCreatureForUpdate(creature);
+
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::OnCreatureAddWorld: Creature {} ({}) | added to map {} ({}{}{}{})",
             creature->GetName(),
             creature->GetLevel(),
@@ -213,6 +249,8 @@ void AutoBalance_AllCreatureScript::OnCreatureAddWorld(Creature* creature)
 
 void AutoBalance_AllCreatureScript::OnCreatureRemoveWorld(Creature* creature)
 {
+    AutoBalanceMetricsTimer metricsTimer(creature->GetMap(), AUTOBALANCE_METRIC_CREATURES);
+
     if (creature->GetMap()->IsDungeon())
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance:: ------------------------------------------------");
@@ -243,50 +281,255 @@ void AutoBalance_AllCreatureScript::OnCreatureRemoveWorld(Creature* creature)
     }
 }
 
-void AutoBalance_AllCreatureScript::OnAllCreatureUpdate(Creature* creature, uint32 /*diff*/)
+bool AutoBalance_AllCreatureScript::IsCreatureLevelScaled(AutoBalanceMapInfo const* mapABInfo, AutoBalanceCreatureInfo const* creatureABInfo)
 {
-    // ensure we're in a dungeon with a creature
+    return
+        (
+            LevelScaling &&
+            (
+                (mapABInfo->avgCreatureLevel > mapABInfo->highestPlayerLevel + mapABInfo->levelScalingSkipHigherLevels || mapABInfo->levelScalingSkipHigherLevels == 0) ||
+                (mapABInfo->avgCreatureLevel < mapABInfo->highestPlayerLevel - mapABInfo->levelScalingSkipLowerLevels || mapABInfo->levelScalingSkipLowerLevels == 0)
+                ) &&
+            !creatureABInfo->neverLevelScale
+            );
+}
+
+uint8 AutoBalance_AllCreatureScript::SelectScaledCreatureLevel(Creature* creature, AutoBalanceMapInfo const* mapABInfo, AutoBalanceCreatureInfo* creatureABInfo)
+{
+    uint8 selectedLevel;
+
+    // resolved again if the creature's entry or the config changed since the creature was added to the map
+    AutoBalanceCreaturePolicy const& policy = GetCreaturePolicy(creature, creatureABInfo);
+
+    // handle "special" creatures
+    // note that these already passed IsCreatureLevelScaled
     if (
-        !creature ||
-        !creature->GetMap() ||
-        !creature->GetMap()->IsDungeon() ||
-        !creature->GetMap()->GetInstanceId()
+        (policy.isTotem && creature->IsSummon() && creatureABInfo->summoner && creatureABInfo->summoner->IsPlayer()) ||
+        (
+            policy.isCritter && creatureABInfo->UnmodifiedLevel <= 5 && creature->GetMaxHealth() <= 100
+            )
         )
     {
-        return;
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::SelectScaledCreatureLevel: Creature {} ({}) | is a {} that will not be level scaled, but will have modifiers set.",
+            creature->GetName(),
+            creatureABInfo->UnmodifiedLevel,
+            policy.isTotem ? "totem" : "critter"
+        );
+
+        selectedLevel = creatureABInfo->UnmodifiedLevel;
     }
+    // if we're using dynamic scaling, calculate the creature's level based relative to the highest player level in the map
+    else if (LevelScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+    {
+        // calculate the creature's new level
+        selectedLevel = (mapABInfo->highestPlayerLevel + mapABInfo->levelScalingDynamicCeiling) - (mapABInfo->highestCreatureLevel - creatureABInfo->UnmodifiedLevel);
 
-    // update map data before making creature changes
-    UpdateMapDataIfNeeded(creature->GetMap());
+        // check to be sure that the creature's new level is at least the dynamic scaling floor
+        if (selectedLevel < (mapABInfo->highestPlayerLevel - mapABInfo->levelScalingDynamicFloor))
+            selectedLevel = mapABInfo->highestPlayerLevel - mapABInfo->levelScalingDynamicFloor;
 
-    // If the config is out of date and the creature was reset, run modify against it
-    if (ResetCreatureIfNeeded(creature))
-    {
-        LOG_DEBUG("module.AutoBalance", "AutoBalance:: ------------------------------------------------");
+        // check to be sure that the creature's new level is no higher than the dynamic scaling ceiling
+        if (selectedLevel > (mapABInfo->highestPlayerLevel + mapABInfo->levelScalingDynamicCeiling))
+            selectedLevel = mapABInfo->highestPlayerLevel + mapABInfo->levelScalingDynamicCeiling;
 
-        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::OnAllCreatureUpdate: Creature {} ({}) | Entry ID: ({}) | Spawn ID: ({})",
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::SelectScaledCreatureLevel: Creature {} ({}) | scaled to level ({}) via dynamic scaling.",
             creature->GetName(),
-            creature->GetLevel(),
-            creature->GetEntry(),
-            creature->GetSpawnId()
+            creatureABInfo->UnmodifiedLevel,
+            selectedLevel
         );
+    }
+    // otherwise we're using "fixed" scaling and should use the highest player level in the map
+    else
+    {
+        selectedLevel = mapABInfo->highestPlayerLevel;
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::SelectScaledCreatureLevel: Creature {} ({}) | scaled to level ({}) via fixed scaling.", creature->GetName(), creatureABInfo->UnmodifiedLevel, selectedLevel);
+    }
 
-        // Update the map's data if it is out of date
-        UpdateMapDataIfNeeded(creature->GetMap());
+    return selectedLevel;
+}
 
-        ModifyCreatureAttributes(creature);
+void AutoBalance_AllCreatureScript::RescaleMapCreatures(Map* map)
+{
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    // bring the map's data up to date and queue every creature, then process the queue right away
+    UpdateMapDataIfNeeded(map);
+    QueueMapCreaturesForUpdate(map);
+    ProcessUpdateQueue(map);
+}
+
+void AutoBalance_AllCreatureScript::RescaleCreaturesForPlayerLevel(Map* map)
+{
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    if (!mapABInfo->enabled)
+        return;
+
+    //
+    // A creature's stats only follow the players' level while it is level scaled,
+    // so only the creatures that are (or now would be) scaled away from their original level need to be reset
+    //
+
+    uint32 queuedCreatureCount = 0;
+
+    for (Creature* creature : mapABInfo->allScalableCreatures)
+    {
+        if (!creature || !creature->IsInWorld())
+            continue;
 
         AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
+        bool wasLevelScaled = LevelScaling && creatureABInfo->selectedLevel != creatureABInfo->UnmodifiedLevel;
+        bool isLevelScaled  = IsCreatureLevelScaled(mapABInfo, creatureABInfo) &&
+                              SelectScaledCreatureLevel(creature, mapABInfo, creatureABInfo) != creatureABInfo->UnmodifiedLevel;
+
+        if (!wasLevelScaled && !isLevelScaled)
+            continue;
+
+        // out of date with the map, so the queue resets it before modifying it again
+        creatureABInfo->mapConfigTime = 1;
+        QueueCreatureForUpdate(creature);
+
+        ++queuedCreatureCount;
+    }
+
+    LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::RescaleCreaturesForPlayerLevel: Map {} ({}{}) | ({}) of ({}) creature(s) queued for the new player level ({}).",
+        map->GetMapName(),
+        map->GetId(),
+        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+        queuedCreatureCount,
+        mapABInfo->allScalableCreatures.size(),
+        mapABInfo->highestPlayerLevel);
+}
+
+void AutoBalance_AllCreatureScript::ProcessUpdateQueue(Map* map)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    // take the work off the map so that anything queued while processing is kept for the next pass
+    std::vector<Creature*> creaturesToUpdate;
+
+    if (mapABInfo->allCreaturesNeedUpdate)
+    {
+        creaturesToUpdate = mapABInfo->allScalableCreatures;
+
+        // creatures that were queued individually are covered by the full pass
+        for (Creature* creature : mapABInfo->creatureUpdateQueue)
+            creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->isInUpdateQueue = false;
+
+        mapABInfo->creatureUpdateQueue.clear();
+        mapABInfo->allCreaturesNeedUpdate = false;
+    }
+    else
+    {
+        creaturesToUpdate.swap(mapABInfo->creatureUpdateQueue);
+
+        for (Creature* creature : creaturesToUpdate)
+            creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->isInUpdateQueue = false;
+    }
+
+    uint32 updatedCreatureCount = 0;
+
+    // the curve multipliers only depend on the map and the boss status, so resolve them once for the whole batch
+    CreatureCurveMultipliers batchCurveMultipliers[2];
+    bool hasBatchCurveMultipliers = mapABInfo->enabled && !creaturesToUpdate.empty() && map->ToInstanceMap();
+
+    if (hasBatchCurveMultipliers)
+    {
+        batchCurveMultipliers[false] = getCurveMultipliers(map->ToInstanceMap(), false);
+        batchCurveMultipliers[true]  = getCurveMultipliers(map->ToInstanceMap(), true);
+    }
+
+    // the creatures are prepared one at a time, their multipliers are calculated together, then the stats are applied one at a time
+    struct PreparedCreature
+    {
+        Creature*                  creature;
+        AutoBalanceScalingCreature scalingCreature;
+        AutoBalanceCreatureStats   finalStats;
+    };
+
+    std::vector<PreparedCreature> preparedCreatures;
+    preparedCreatures.reserve(creaturesToUpdate.size());
+    AutoBalanceCreatureBatch& batch = mapABInfo->creatureBatch;
+    batch.Resize(creaturesToUpdate.size());
+
+    auto updateLevel = [&updatedCreatureCount](Creature* creature)
+    {
+        AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+
         if (creature->GetLevel() != creatureABInfo->selectedLevel && isCreatureRelevant(creature))
         {
-            LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::OnAllCreatureUpdate: Creature {} ({}) | is set to level ({}).",
+            LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ProcessUpdateQueue: Creature {} ({}) | is set to level ({}).",
                 creature->GetName(),
                 creature->GetLevel(),
                 creatureABInfo->selectedLevel
             );
             creature->SetLevel(creatureABInfo->selectedLevel);
         }
+
+        ++updatedCreatureCount;
+    };
+
+    for (Creature* creature : creaturesToUpdate)
+    {
+        if (!creature || !creature->IsInWorld())
+            continue;
+
+        // the creature's spawn burst (if any) is over
+        creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->isInSpawnBurst = false;
+
+        // dead creatures are only primed for a reset, the respawn queues them again
+        if (creature->isDead())
+        {
+            ResetCreatureIfNeeded(creature);
+            continue;
+        }
+
+        // If the config is out of date and the creature was reset, run modify against it
+        if (!ResetCreatureIfNeeded(creature))
+            continue;
+
+        CreatureCurveMultipliers curveMultipliers;
+        PreparedCreature prepared = { creature, {}, {} };
+
+        // creatures that are left as they are, or re-applied from their stat memo, are done
+        if (!_PrepareCreatureAttributes(creature, hasBatchCurveMultipliers ? batchCurveMultipliers : nullptr, curveMultipliers, prepared.scalingCreature, prepared.finalStats))
+        {
+            updateLevel(creature);
+            continue;
+        }
+
+        batch.Set(preparedCreatures.size(), curveMultipliers, prepared.scalingCreature);
+        preparedCreatures.push_back(prepared);
+    }
+
+    if (!preparedCreatures.empty())
+    {
+        AutoBalanceMetricsTimer metricsTimer(map, AUTOBALANCE_METRIC_SCALING);
+
+        batch.Resize(preparedCreatures.size());
+        calculateCreatureMultipliersBatch(ScalingSettings, batch);
+
+        for (std::size_t i = 0; i < preparedCreatures.size(); ++i)
+        {
+            _FinishCreatureAttributes(preparedCreatures[i].creature, preparedCreatures[i].scalingCreature, batch.Get(i), preparedCreatures[i].finalStats);
+            updateLevel(preparedCreatures[i].creature);
+        }
+    }
+
+    if (updatedCreatureCount)
+    {
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ProcessUpdateQueue: Map {} ({}{}) | Updated ({}) of ({}) queued creatures.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            updatedCreatureCount,
+            creaturesToUpdate.size()
+        );
     }
 }
 
@@ -339,6 +582,10 @@ bool AutoBalance_AllCreatureScript::ResetCreatureIfNeeded(Creature* creature)
         bool isActive = creatureABInfo->isActive;
         bool wasAliveNowDead = creatureABInfo->wasAliveNowDead;
         bool isInCreatureList = creatureABInfo->isInCreatureList;
+        bool isInScalableList = creatureABInfo->isInScalableList;
+        bool isInUpdateQueue = creatureABInfo->isInUpdateQueue;
+        uint32 modifyCount = creatureABInfo->modifyCount;
+        AutoBalanceCreaturePolicy policy = creatureABInfo->policy;
 
         // reset AutoBalance modifiers
         creature->CustomData.Erase("AutoBalanceCreatureInfo");
@@ -391,6 +638,10 @@ bool AutoBalance_AllCreatureScript::ResetCreatureIfNeeded(Creature* creature)
         creatureABInfo->isActive = isActive;
         creatureABInfo->wasAliveNowDead = wasAliveNowDead;
         creatureABInfo->isInCreatureList = isInCreatureList;
+        creatureABInfo->isInScalableList = isInScalableList;
+        creatureABInfo->isInUpdateQueue = isInUpdateQueue;
+        creatureABInfo->modifyCount = modifyCount;
+        creatureABInfo->policy = policy;
 
         // damage and ccduration are handled using AutoBalanceCreatureInfo data only
 
@@ -408,21 +659,42 @@ bool AutoBalance_AllCreatureScript::ResetCreatureIfNeeded(Creature* creature)
 
 }
 
-void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
+void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature, CreatureCurveMultipliers const* batchCurveMultipliers)
+{
+    CreatureCurveMultipliers curveMultipliers;
+    AutoBalanceScalingCreature scalingCreature;
+    AutoBalanceCreatureStats finalStats;
+
+    if (!_PrepareCreatureAttributes(creature, batchCurveMultipliers, curveMultipliers, scalingCreature, finalStats))
+        return;
+
+    AutoBalanceMetricsTimer metricsTimer(creature->GetMap(), AUTOBALANCE_METRIC_SCALING);
+
+    _FinishCreatureAttributes(creature, scalingCreature, calculateCreatureMultipliers(ScalingSettings, curveMultipliers, scalingCreature), finalStats);
+}
+
+bool AutoBalance_AllCreatureScript::_PrepareCreatureAttributes(Creature* creature, CreatureCurveMultipliers const* batchCurveMultipliers, CreatureCurveMultipliers& curveMultipliers, AutoBalanceScalingCreature& scalingCreature, AutoBalanceCreatureStats& finalStats)
 {
     // make sure we have a creature
     if (!creature)
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: creature is null.");
-        return;
+        return false;
     }
 
     // grab creature and map data
     AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+    AutoBalanceCreaturePolicy const& policy = GetCreaturePolicy(creature, creatureABInfo);
     Map* map = creature->GetMap();
     InstanceMap* instanceMap = map->ToInstanceMap();
     AutoBalanceMapInfo* mapABInfo = GetMapInfo(instanceMap);
 
+    AutoBalanceMetricsTimer metricsTimer(map, AUTOBALANCE_METRIC_SCALING);
+
+    // keep track of how often creatures are modified
+    creatureABInfo->modifyCount++;
+    mapABInfo->modifyCreatureAttributesCount++;
+
     // mark the creature as updated using the current settings if needed
     // if this creature is brand new, do not update this so that it will be re-processed next OnCreatureUpdate
     if (creatureABInfo->mapConfigTime < mapABInfo->mapConfigTime && !creatureABInfo->isBrandNew)
@@ -451,7 +723,7 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
         // return the creature back to their original level, if it's not already
         creatureABInfo->selectedLevel = creatureABInfo->UnmodifiedLevel;
 
-        return;
+        return false;
     }
 
     // if the creature isn't relevant, don't modify it
@@ -465,7 +737,7 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
         // return the creature back to their original level, if it's not already
         creatureABInfo->selectedLevel = creatureABInfo->UnmodifiedLevel;
 
-        return;
+        return false;
     }
 
     // if this creature is below 85% of the minimum LFG level for the map, make no changes
@@ -478,22 +750,22 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
             (creatureABInfo->UnmodifiedLevel > (uint8)(((float)mapABInfo->lfgMaxLevel * 1.15f) + 0.5f))
             ) &&
         (
-            !(creature->IsCritter() && creatureABInfo->UnmodifiedLevel >= 5 && creature->GetMaxHealth() > 100) &&
-            !creature->IsTrigger()
+            !(policy.isCritter && creatureABInfo->UnmodifiedLevel >= 5 && creature->GetMaxHealth() > 100) &&
+            !policy.isTrigger
             )
         )
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is a {} outside of the expected NPC level range for the map ({} to {}), not modified.",
             creature->GetName(),
             creatureABInfo->UnmodifiedLevel,
-            creature->IsCritter() ? "critter" : "creature",
+            policy.isCritter ? "critter" : "creature",
             (uint8)(((float)mapABInfo->lfgMinLevel * .85f) + 0.5f),
             (uint8)(((float)mapABInfo->lfgMaxLevel * 1.15f) + 0.5f)
         );
 
         creatureABInfo->selectedLevel = creatureABInfo->UnmodifiedLevel;
 
-        return;
+        return false;
     }
 
     // if the creature was dead (but this function is being called because they are being revived), reset it and allow modifications
@@ -507,18 +779,18 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
     else if (creature->isDead())
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is dead, do not modify.", creature->GetName(), creatureABInfo->UnmodifiedLevel);
-        return;
+        return false;
     }
 
     CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate();
 
     // check to see if the creature is in the forced num players list
-    uint32 forcedNumPlayers = GetForcedNumPlayers(creatureTemplate->Entry);
+    uint32 forcedNumPlayers = policy.forcedNumPlayers;
 
     if (forcedNumPlayers == 0)
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is in the forced num players list with a value of 0, not changed.", creature->GetName(), creatureABInfo->UnmodifiedLevel);
-        return; // forcedNumPlayers 0 means that the creature is contained in DisabledID -> no scaling
+        return false; // forcedNumPlayers 0 means that the creature is contained in DisabledID -> no scaling
     }
 
     // start with the map's adjusted player count
@@ -537,68 +809,16 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
     if (!creatureABInfo->instancePlayerCount) // no players in map, do not modify attributes
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is on a map with no players, not changed.", creature->GetName(), creatureABInfo->UnmodifiedLevel);
-        return;
+        return false;
     }
 
     if (!sABScriptMgr->OnBeforeModifyAttributes(creature, creatureABInfo->instancePlayerCount))
-        return;
+        return false;
 
     // only scale levels if level scaling is enabled and the instance's average creature level is not within the skip range
-    if
-        (
-            LevelScaling &&
-            (
-                (mapABInfo->avgCreatureLevel > mapABInfo->highestPlayerLevel + mapABInfo->levelScalingSkipHigherLevels || mapABInfo->levelScalingSkipHigherLevels == 0) ||
-                (mapABInfo->avgCreatureLevel < mapABInfo->highestPlayerLevel - mapABInfo->levelScalingSkipLowerLevels || mapABInfo->levelScalingSkipLowerLevels == 0)
-                ) &&
-            !creatureABInfo->neverLevelScale
-            )
+    if (IsCreatureLevelScaled(mapABInfo, creatureABInfo))
     {
-        uint8 selectedLevel;
-
-        // handle "special" creatures
-        // note that these already passed a more complex check above
-        if (
-            (creature->IsTotem() && creature->IsSummon() && creatureABInfo->summoner && creatureABInfo->summoner->IsPlayer()) ||
-            (
-                creature->IsCritter() && creatureABInfo->UnmodifiedLevel <= 5 && creature->GetMaxHealth() <= 100
-                )
-            )
-        {
-            LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is a {} that will not be level scaled, but will have modifiers set.",
-                creature->GetName(),
-                creatureABInfo->UnmodifiedLevel,
-                creature->IsTotem() ? "totem" : "critter"
-            );
-
-            selectedLevel = creatureABInfo->UnmodifiedLevel;
-        }
-        // if we're using dynamic scaling, calculate the creature's level based relative to the highest player level in the map
-        else if (LevelScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
-        {
-            // calculate the creature's new level
-            selectedLevel = (mapABInfo->highestPlayerLevel + mapABInfo->levelScalingDynamicCeiling) - (mapABInfo->highestCreatureLevel - creatureABInfo->UnmodifiedLevel);
-
-            // check to be sure that the creature's new level is at least the dynamic scaling floor
-            if (selectedLevel < (mapABInfo->highestPlayerLevel - mapABInfo->levelScalingDynamicFloor))
-                selectedLevel = mapABInfo->highestPlayerLevel - mapABInfo->levelScalingDynamicFloor;
-
-            // check to be sure that the creature's new level is no higher than the dynamic scaling ceiling
-            if (selectedLevel > (mapABInfo->highestPlayerLevel + mapABInfo->levelScalingDynamicCeiling))
-                selectedLevel = mapABInfo->highestPlayerLevel + mapABInfo->levelScalingDynamicCeiling;
-
-            LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaled to level ({}) via dynamic scaling.",
-                creature->GetName(),
-                creatureABInfo->UnmodifiedLevel,
-                selectedLevel
-            );
-        }
-        // otherwise we're using "fixed" scaling and should use the highest player level in the map
-        else
-        {
-            selectedLevel = mapABInfo->highestPlayerLevel;
-            LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaled to level ({}) via fixed scaling.", creature->GetName(), creatureABInfo->UnmodifiedLevel, selectedLevel);
-        }
+        uint8 selectedLevel = SelectScaledCreatureLevel(creature, mapABInfo, creatureABInfo);
 
         creatureABInfo->selectedLevel = selectedLevel;
 
@@ -639,566 +859,167 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
             creatureABInfo->UnmodifiedLevel
         );
 
-        return;
+        return false;
     }
 
     CreatureBaseStats const* origCreatureBaseStats = sObjectMgr->GetCreatureBaseStats(creatureABInfo->UnmodifiedLevel, creatureTemplate->unit_class);
     CreatureBaseStats const* newCreatureBaseStats = sObjectMgr->GetCreatureBaseStats(creatureABInfo->selectedLevel, creatureTemplate->unit_class);
 
-    // Inflection Point - Get separate settings for each stat
-    bool isBoss = isBossOrBossSummon(creature);
-    AutoBalanceInflectionPointSettings inflectionPointSettingsHealth = getInflectionPointSettings(instanceMap, isBoss, AUTOBALANCE_STAT_HEALTH);
-    AutoBalanceInflectionPointSettings inflectionPointSettingsMana = getInflectionPointSettings(instanceMap, isBoss, AUTOBALANCE_STAT_MANA);
-    AutoBalanceInflectionPointSettings inflectionPointSettingsArmor = getInflectionPointSettings(instanceMap, isBoss, AUTOBALANCE_STAT_ARMOR);
-    AutoBalanceInflectionPointSettings inflectionPointSettingsDamage = getInflectionPointSettings(instanceMap, isBoss, AUTOBALANCE_STAT_DAMAGE);
-
-    // Generate the default multipliers (separate for each stat)
-    // Use boss formula types if this is a boss, otherwise use regular formula types
-    FormulaType healthFormulaType = isBoss ? FormulaTypeBossHealth : FormulaTypeHealth;
-    FormulaType manaFormulaType = isBoss ? FormulaTypeBossMana : FormulaTypeMana;
-    FormulaType armorFormulaType = isBoss ? FormulaTypeBossArmor : FormulaTypeArmor;
-    FormulaType damageFormulaType = isBoss ? FormulaTypeBossDamage : FormulaTypeDamage;
-    float defaultHealthMultiplier = getDefaultMultiplier(instanceMap, inflectionPointSettingsHealth, healthFormulaType);
-    float defaultManaMultiplier = getDefaultMultiplier(instanceMap, inflectionPointSettingsMana, manaFormulaType);
-    float defaultArmorMultiplier = getDefaultMultiplier(instanceMap, inflectionPointSettingsArmor, armorFormulaType);
-    float defaultDamageMultiplier = getDefaultMultiplier(instanceMap, inflectionPointSettingsDamage, damageFormulaType);
-    
+    // Default multipliers (separate for each stat), shared by every creature in the map with the same boss status
+    bool isBoss = policy.isBoss;
+    curveMultipliers = batchCurveMultipliers ? batchCurveMultipliers[isBoss] : getCurveMultipliers(instanceMap, isBoss);
+
     // For backwards compatibility and hook support, use health multiplier as the "default"
-    float defaultMultiplier = defaultHealthMultiplier;
+    float defaultMultiplier = curveMultipliers.health;
 
     if (!sABScriptMgr->OnAfterDefaultMultiplier(creature, defaultMultiplier))
-        return;
-
-    // Stat Modifiers
-    AutoBalanceStatModifiers statModifiers = getStatModifiers(map, creature);
-    float statMod_global = statModifiers.global;
-    float statMod_health = statModifiers.health;
-    float statMod_mana = statModifiers.mana;
-    float statMod_armor = statModifiers.armor;
-    float statMod_damage = statModifiers.damage;
-    float statMod_ccDuration = statModifiers.ccduration;
-
-    // Storage for the final values applied to the creature
-    uint32 newFinalHealth = 0;
-    uint32 newFinalMana = 0;
-    uint32 newFinalArmor = 0;
-
-    //
-    //  Health Scaling
-    //
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- HEALTH MULTIPLIER ----------",
-        creature->GetName(),
-        creatureABInfo->selectedLevel
-    );
-
-    float healthMultiplier = defaultHealthMultiplier * statMod_global * statMod_health;
-    float scaledHealthMultiplier;
-
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | HealthMultiplier: ({}) = defaultHealthMultiplier ({}) * statMod_global ({}) * statMod_health ({})",
-        creature->GetName(),
-        creatureABInfo->selectedLevel,
-        healthMultiplier,
-        defaultHealthMultiplier,
-        statMod_global,
-        statMod_health
-    );
-
-    // Can't be less than MinHPModifier
-    if (healthMultiplier <= MinHPModifier)
-    {
-        healthMultiplier = MinHPModifier;
-
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | HealthMultiplier: ({}) - capped to MinHPModifier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            healthMultiplier,
-            MinHPModifier
-        );
-    }
-
-    // set the non-level-scaled health multiplier on the creature's AB info
-    creatureABInfo->HealthMultiplier = healthMultiplier;
-
-    // only level scale health if level scaling is enabled and the creature level has been altered
-    if (LevelScaling && creatureABInfo->selectedLevel != creatureABInfo->UnmodifiedLevel)
-    {
-        // the max health that the creature had before we did anything with it
-        float origHealth = origCreatureBaseStats->GenerateHealth(creatureTemplate);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origHealth ({}) = origCreatureBaseStats->GenerateHealth(creatureTemplate)",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            origHealth
-        );
-
-        // the base health of the new creature level for this creature's class
-        // uses a custom smoothing formula to smooth transitions between expansions
-        float newBaseHealth = getBaseExpansionValueForLevel(newCreatureBaseStats->BaseHealth, mapABInfo->highestPlayerLevel);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newBaseHealth ({}) = getBaseExpansionValueForLevel(newCreatureBaseStats->BaseHealth, mapABInfo->highestPlayerLevel ({}))",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newBaseHealth,
-            mapABInfo->highestPlayerLevel
-        );
-
-        // the health of the creature at its new level (before per-player scaling)
-        float newHealth = newBaseHealth * creatureTemplate->ModHealth;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newHealth ({}) = newBaseHealth ({}) * creature ModHealth ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newHealth,
-            newBaseHealth,
-            creatureTemplate->ModHealth
-        );
-
-        // the multiplier that would need to be applied to the creature's original health to get the new level's health (before per-player scaling)
-        float newHealthMultiplier = newHealth / origHealth;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newHealthMultiplier ({}) = newHealth ({}) / origHealth ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newHealthMultiplier,
-            newHealth,
-            origHealth
-        );
-
-        // the multiplier that would need to be applied to the creature's original health to get the new level's health (after per-player scaling)
-        scaledHealthMultiplier = healthMultiplier * newHealthMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledHealthMultiplier ({}) = healthMultiplier ({}) * newHealthMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            scaledHealthMultiplier,
-            healthMultiplier,
-            newHealthMultiplier
-        );
-
-        // the actual health value to be applied to the level-scaled and player-scaled creature
-        newFinalHealth = round(origHealth * scaledHealthMultiplier);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalHealth ({}) = origHealth ({}) * scaledHealthMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newFinalHealth,
-            origHealth,
-            scaledHealthMultiplier
-        );
-    }
-    else
-    {
-        // the non-level-scaled health multiplier is the same as the level-scaled health multiplier
-        scaledHealthMultiplier = healthMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledHealthMultiplier ({}) = healthMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            scaledHealthMultiplier,
-            healthMultiplier
-        );
-
-        // the original health of the creature
-        uint32 origHealth = origCreatureBaseStats->GenerateHealth(creatureTemplate);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origHealth ({}) = origCreatureBaseStats->GenerateHealth(creatureTemplate)",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            origHealth
-        );
-
-        // the actual health value to be applied to the player-scaled creature
-        newFinalHealth = round(origHealth * creatureABInfo->HealthMultiplier);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalHealth ({}) = origHealth ({}) * HealthMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newFinalHealth,
-            origHealth,
-            creatureABInfo->HealthMultiplier
-        );
-    }
-
-    //
-    //  Mana Scaling
-    //
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- MANA MULTIPLIER ----------",
-        creature->GetName(),
-        creatureABInfo->selectedLevel
-    );
-
-    float manaMultiplier = defaultManaMultiplier * statMod_global * statMod_mana;
-    float scaledManaMultiplier;
-
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ManaMultiplier: ({}) = defaultManaMultiplier ({}) * statMod_global ({}) * statMod_mana ({})",
-        creature->GetName(),
-        creatureABInfo->selectedLevel,
-        manaMultiplier,
-        defaultManaMultiplier,
-        statMod_global,
-        statMod_mana
-    );
-
-    // Can't be less than MinManaModifier
-    if (manaMultiplier <= MinManaModifier)
-    {
-        manaMultiplier = MinManaModifier;
-
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ManaMultiplier: ({}) - capped to MinManaModifier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            manaMultiplier,
-            MinManaModifier
-        );
-    }
+        return false;
 
-    // if the creature doesn't have mana, set the multiplier to 0.0
-    if (!origCreatureBaseStats->GenerateMana(creatureTemplate))
+    // if the creature was recently scaled with the same inputs (e.g. a player left and came back), re-apply those stats
+    // the script hooks still run, and the multiplier they returned is part of the inputs
+    finalStats.entry = creature->GetEntry();
+    finalStats.mapAdjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+    finalStats.instancePlayerCount = creatureABInfo->instancePlayerCount;
+    finalStats.isBoss = isBoss;
+    finalStats.unmodifiedLevel = creatureABInfo->UnmodifiedLevel;
+    finalStats.selectedLevel = creatureABInfo->selectedLevel;
+    // the highest player level only changes the stats of level scaled creatures
+    finalStats.highestPlayerLevel = creatureABInfo->selectedLevel != creatureABInfo->UnmodifiedLevel ? mapABInfo->highestPlayerLevel : 0;
+    finalStats.defaultMultiplier = defaultMultiplier;
+    finalStats.globalConfigTime = globalConfigTime;
+    finalStats.mapGlobalConfigTime = mapABInfo->globalConfigTime;
+
+    if (AutoBalanceCreatureStats const* memoStats = creature->CustomData.GetDefault<AutoBalanceCreatureStatMemo>("AutoBalanceCreatureStatMemo")->Find(finalStats))
     {
-        manaMultiplier = 0.0f;
-        creatureABInfo->ManaMultiplier = 0.0f;
-        scaledManaMultiplier = 0.0f;
-
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Creature doesn't have mana, multiplier set to ({})",
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | re-applying remembered stats for {} players.",
             creature->GetName(),
             creatureABInfo->selectedLevel,
-            creatureABInfo->ManaMultiplier
+            finalStats.instancePlayerCount
         );
-    }
-    // if the creature has mana, continue calculations
-    else
-    {
-        // set the non-level-scaled mana multiplier on the creature's AB info
-        creatureABInfo->ManaMultiplier = manaMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ManaMultiplier: ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            creatureABInfo->ManaMultiplier
-        );
-
-        // only level scale mana if level scaling is enabled and the creature level has been altered
-        if (LevelScaling && creatureABInfo->selectedLevel != creatureABInfo->UnmodifiedLevel)
-        {
-            // the max mana that the creature had before we did anything with it
-            uint32 origMana = origCreatureBaseStats->GenerateMana(creatureTemplate);
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origMana ({}) = origCreatureBaseStats->GenerateMana(creatureTemplate)",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                origMana
-            );
-
-            // the max mana that the creature would have at its new level
-            // there is no per-expansion adjustment for mana
-            uint32 newMana = newCreatureBaseStats->GenerateMana(creatureTemplate);
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newMana ({}) = newCreatureBaseStats->GenerateMana(creatureTemplate)",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                newMana
-            );
-
-            // the multiplier that would need to be applied to the creature's original mana to get the new level's mana (before per-player scaling)
-            float newManaMultiplier = (float)newMana / (float)origMana;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newManaMultiplier ({}) = newMana ({}) / origMana ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                newManaMultiplier,
-                newMana,
-                origMana
-            );
-
-            // the multiplier that would need to be applied to the creature's original mana to get the new level's mana (after per-player scaling)
-            scaledManaMultiplier = manaMultiplier * newManaMultiplier;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledManaMultiplier ({}) = manaMultiplier ({}) * newManaMultiplier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                scaledManaMultiplier,
-                manaMultiplier,
-                newManaMultiplier
-            );
-
-            // the actual mana value to be applied to the level-scaled and player-scaled creature
-            newFinalMana = round(origMana * scaledManaMultiplier);
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalMana ({}) = origMana ({}) * scaledManaMultiplier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                newFinalMana,
-                origMana,
-                scaledManaMultiplier
-            );
-        }
-        else
-        {
-            // scaled mana multiplier is the same as the non-level-scaled mana multiplier
-            scaledManaMultiplier = manaMultiplier;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledManaMultiplier ({}) = manaMultiplier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                scaledManaMultiplier,
-                manaMultiplier
-            );
 
-            // the original mana of the creature
-            uint32 origMana = origCreatureBaseStats->GenerateMana(creatureTemplate);
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origMana ({}) = origCreatureBaseStats->GenerateMana(creatureTemplate)",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                origMana
-            );
-
-            // the actual mana value to be applied to the player-scaled creature
-            newFinalMana = round(origMana * creatureABInfo->ManaMultiplier);
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalMana ({}) = origMana ({}) * creatureABInfo->ManaMultiplier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                newFinalMana,
-                origMana,
-                creatureABInfo->ManaMultiplier
-            );
-        }
+        _ApplyCreatureStats(creature, *memoStats);
+        return false;
     }
 
     //
-    //  Armor Scaling
+    // Gather the creature's base values and level ratios, the multipliers themselves come from the scaling core
     //
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- ARMOR MULTIPLIER ----------",
-        creature->GetName(),
-        creatureABInfo->selectedLevel
-    );
 
-    float armorMultiplier = defaultArmorMultiplier * statMod_global * statMod_armor;
-    float scaledArmorMultiplier;
+    scalingCreature.defaultMultiplier = defaultMultiplier;
+    scalingCreature.statModifiers     = getStatModifiers(map, creature);
+    scalingCreature.baseHealth        = origCreatureBaseStats->GenerateHealth(creatureTemplate);
+    scalingCreature.baseMana          = origCreatureBaseStats->GenerateMana(creatureTemplate);
+    scalingCreature.baseArmor         = origCreatureBaseStats->GenerateArmor(creatureTemplate);
 
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | armorMultiplier: ({}) = defaultArmorMultiplier ({}) * statMod_global ({}) * statMod_armor ({})",
-        creature->GetName(),
-        creatureABInfo->selectedLevel,
-        armorMultiplier,
-        defaultArmorMultiplier,
-        statMod_global,
-        statMod_armor
-    );
-
-    // set the non-level-scaled armor multiplier on the creature's AB info
-    creatureABInfo->ArmorMultiplier = armorMultiplier;
-
-    // only level scale armor if level scaling is enabled and the creature level has been altered
+    // only level scale if level scaling is enabled and the creature level has been altered
     if (LevelScaling && creatureABInfo->selectedLevel != creatureABInfo->UnmodifiedLevel)
     {
-        // the armor that the creature had before we did anything with it
-        uint32 origArmor = origCreatureBaseStats->GenerateArmor(creatureTemplate);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origArmor ({}) = origCreatureBaseStats->GenerateArmor(creatureTemplate)",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            origArmor
-        );
+        // health and damage use a custom smoothing formula to smooth transitions between expansions
+        // there is no per-expansion adjustment for mana and armor
+        float newHealth = getBaseExpansionValueForLevel(newCreatureBaseStats->BaseHealth, mapABInfo->highestPlayerLevel) * creatureTemplate->ModHealth;
+        scalingCreature.healthLevelRatio = newHealth / scalingCreature.baseHealth;
 
-        // the armor that the creature would have at its new level
-        // there is no per-expansion adjustment for armor
-        uint32 newArmor = newCreatureBaseStats->GenerateArmor(creatureTemplate);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newArmor ({}) = newCreatureBaseStats->GenerateArmor(creatureTemplate)",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newArmor
-        );
+        if (scalingCreature.baseMana)
+            scalingCreature.manaLevelRatio = (float)newCreatureBaseStats->GenerateMana(creatureTemplate) / scalingCreature.baseMana;
 
-        // the multiplier that would need to be applied to the creature's original armor to get the new level's armor (before per-player scaling)
-        float newArmorMultiplier = (float)newArmor / (float)origArmor;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newArmorMultiplier ({}) = newArmor ({}) / origArmor ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newArmorMultiplier,
-            newArmor,
-            origArmor
-        );
+        scalingCreature.armorLevelRatio = (float)newCreatureBaseStats->GenerateArmor(creatureTemplate) / scalingCreature.baseArmor;
 
-        // the multiplier that would need to be applied to the creature's original armor to get the new level's armor (after per-player scaling)
-        scaledArmorMultiplier = armorMultiplier * newArmorMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledArmorMultiplier ({}) = armorMultiplier ({}) * newArmorMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            scaledArmorMultiplier,
-            armorMultiplier,
-            newArmorMultiplier
-        );
-
-        // the actual armor value to be applied to the level-scaled and player-scaled creature
-        newFinalArmor = round(origArmor * scaledArmorMultiplier);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalArmor ({}) = origArmor ({}) * scaledArmorMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newFinalArmor,
-            origArmor,
-            scaledArmorMultiplier
-        );
+        // note that we don't mess with the damage modifier here since it applied equally to the original and new levels
+        float newBaseDamage = getBaseExpansionValueForLevel(newCreatureBaseStats->BaseDamage, mapABInfo->highestPlayerLevel);
+        scalingCreature.damageLevelRatio = newBaseDamage / origCreatureBaseStats->GenerateBaseDamage(creatureTemplate);
     }
-    else
-    {
-        // Scaled armor multiplier is the same as the non-level-scaled armor multiplier
-        scaledArmorMultiplier = armorMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledArmorMultiplier ({}) = armorMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            scaledArmorMultiplier,
-            armorMultiplier
-        );
 
-        // the original armor of the creature
-        uint32 origArmor = origCreatureBaseStats->GenerateArmor(creatureTemplate);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origArmor ({}) = origCreatureBaseStats->GenerateArmor(creatureTemplate)",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            origArmor
-        );
+    return true;
+}
 
-        // the actual armor value to be applied to the player-scaled creature
-        newFinalArmor = round(origArmor * creatureABInfo->ArmorMultiplier);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalArmor ({}) = origArmor ({}) * creatureABInfo->ArmorMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newFinalArmor,
-            origArmor,
-            creatureABInfo->ArmorMultiplier
-        );
-    }
+void AutoBalance_AllCreatureScript::_FinishCreatureAttributes(Creature* creature, AutoBalanceScalingCreature const& scalingCreature, AutoBalanceCreatureMultipliers const& multipliers, AutoBalanceCreatureStats finalStats)
+{
+    AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
-    //
-    //  Damage Scaling
-    //
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- DAMAGE MULTIPLIER ----------",
+    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | health: {} = {} * HealthMultiplier ({}) * level ratio ({})",
         creature->GetName(),
-        creatureABInfo->selectedLevel
+        creatureABInfo->selectedLevel,
+        multipliers.health,
+        scalingCreature.baseHealth,
+        multipliers.healthMultiplier,
+        scalingCreature.healthLevelRatio
     );
 
-    float damageMultiplier = defaultDamageMultiplier * statMod_global * statMod_damage;
-    float scaledDamageMultiplier;
-
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | DamageMultiplier: ({}) = defaultDamageMultiplier ({}) * statMod_global ({}) * statMod_damage ({})",
+    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | mana: {} = {} * ManaMultiplier ({}) * level ratio ({})",
         creature->GetName(),
         creatureABInfo->selectedLevel,
-        damageMultiplier,
-        defaultDamageMultiplier,
-        statMod_global,
-        statMod_damage
+        multipliers.mana,
+        scalingCreature.baseMana,
+        multipliers.manaMultiplier,
+        scalingCreature.manaLevelRatio
     );
 
-    // Can't be less than MinDamageModifier
-    if (damageMultiplier <= MinDamageModifier)
-    {
-        damageMultiplier = MinDamageModifier;
-
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | DamageMultiplier: ({}) - capped to MinDamageModifier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            damageMultiplier,
-            MinDamageModifier
-        );
-    }
-
-    // set the non-level-scaled damage multiplier on the creature's AB info
-    creatureABInfo->DamageMultiplier = damageMultiplier;
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | DamageMultiplier: ({})",
+    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | armor: {} = {} * ArmorMultiplier ({}) * level ratio ({})",
         creature->GetName(),
         creatureABInfo->selectedLevel,
-        creatureABInfo->DamageMultiplier
+        multipliers.armor,
+        scalingCreature.baseArmor,
+        multipliers.armorMultiplier,
+        scalingCreature.armorLevelRatio
     );
 
-    // only level scale damage if level scaling is enabled and the creature level has been altered
-    if (LevelScaling && creatureABInfo->selectedLevel != creatureABInfo->UnmodifiedLevel)
-    {
-
-        // the original base damage of the creature
-        // note that we don't mess with the damage modifier here since it applied equally to the original and new levels
-        float origBaseDamage = origCreatureBaseStats->GenerateBaseDamage(creatureTemplate);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origBaseDamage ({}) = origCreatureBaseStats->GenerateBaseDamage(creatureTemplate)",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            origBaseDamage
-        );
-
-        // the base damage of the new creature level for this creature's class
-        // uses a custom smoothing formula to smooth transitions between expansions
-        float newBaseDamage = getBaseExpansionValueForLevel(newCreatureBaseStats->BaseDamage, mapABInfo->highestPlayerLevel);
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newBaseDamage ({}) = getBaseExpansionValueForLevel(newCreatureBaseStats->BaseDamage, mapABInfo->highestPlayerLevel ({}))",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newBaseDamage,
-            mapABInfo->highestPlayerLevel
-        );
-
-        // the multiplier that would need to be applied to the creature's original damage to get the new level's damage (before per-player scaling)
-        float newDamageMultiplier = newBaseDamage / origBaseDamage;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newDamageMultiplier ({}) = newBaseDamage ({}) / origBaseDamage ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            newDamageMultiplier,
-            newBaseDamage,
-            origBaseDamage
-        );
-
-        // the actual multiplier that will be used to scale the creature's damage (after per-player scaling)
-        scaledDamageMultiplier = damageMultiplier * newDamageMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledDamageMultiplier ({}) = damageMultiplier ({}) * newDamageMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            scaledDamageMultiplier,
-            damageMultiplier,
-            newDamageMultiplier
-        );
-    }
-    else
-    {
-        // the scaled damage multiplier is the same as the non-level-scaled damage multiplier
-        scaledDamageMultiplier = damageMultiplier;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledDamageMultiplier ({}) = damageMultiplier ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            scaledDamageMultiplier,
-            origCreatureBaseStats->GenerateBaseDamage(creatureTemplate),
-            damageMultiplier
-        );
-
-    }
-
-    //
-    // Crowd Control Debuff Duration Scaling
-    //
-
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- CC DURATION MULTIPLIER ----------",
+    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ScaledDamageMultiplier ({}) = DamageMultiplier ({}) * level ratio ({})",
         creature->GetName(),
-        creatureABInfo->selectedLevel
+        creatureABInfo->selectedLevel,
+        multipliers.scaledDamageMultiplier,
+        multipliers.damageMultiplier,
+        scalingCreature.damageLevelRatio
     );
 
-    float ccDurationMultiplier;
-
-    if (statMod_ccDuration != -1.0f)
-    {
-        // calculate CC Duration from the default multiplier and the config settings
-        ccDurationMultiplier = defaultMultiplier * statMod_ccDuration;
-
-        // Min/Max checking
-        if (ccDurationMultiplier < MinCCDurationModifier)
-            ccDurationMultiplier = MinCCDurationModifier;
-        else if (ccDurationMultiplier > MaxCCDurationModifier)
-            ccDurationMultiplier = MaxCCDurationModifier;
-
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ccDurationMultiplier: ({})",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            ccDurationMultiplier
-        );
-    }
-    else
-    {
-        // the CC Duration will not be changed
-        ccDurationMultiplier = 1.0f;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Crowd Control Duration will not be changed.",
-            creature->GetName(),
-            creatureABInfo->selectedLevel
-        );
-    }
-
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ccDurationMultiplier: ({}) = defaultMultiplier ({}) * statMod_ccDuration ({})",
+    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | CCDurationMultiplier ({}) | XPModifier ({}) | MoneyModifier ({})",
         creature->GetName(),
         creatureABInfo->selectedLevel,
-        ccDurationMultiplier,
-        defaultMultiplier,
-        statMod_ccDuration
+        multipliers.ccDurationMultiplier,
+        multipliers.xpModifier,
+        multipliers.moneyModifier
     );
 
     //
     //  Apply New Values
     //
-    if (!sABScriptMgr->OnBeforeUpdateStats(creature, newFinalHealth, newFinalMana, damageMultiplier, newFinalArmor))
+    finalStats.health = multipliers.health;
+    finalStats.mana = multipliers.mana;
+    finalStats.armor = multipliers.armor;
+    finalStats.HealthMultiplier = multipliers.healthMultiplier;
+    finalStats.ScaledHealthMultiplier = multipliers.scaledHealthMultiplier;
+    finalStats.ManaMultiplier = multipliers.manaMultiplier;
+    finalStats.ScaledManaMultiplier = multipliers.scaledManaMultiplier;
+    finalStats.ArmorMultiplier = multipliers.armorMultiplier;
+    finalStats.ScaledArmorMultiplier = multipliers.scaledArmorMultiplier;
+    finalStats.DamageMultiplier = multipliers.damageMultiplier;
+    finalStats.ScaledDamageMultiplier = multipliers.scaledDamageMultiplier;
+    finalStats.CCDurationMultiplier = multipliers.ccDurationMultiplier;
+    finalStats.XPModifier = multipliers.xpModifier;
+    finalStats.MoneyModifier = multipliers.moneyModifier;
+
+    // remember the stats before OnBeforeUpdateStats so that a later hit runs the hook the same way
+    creature->CustomData.GetDefault<AutoBalanceCreatureStatMemo>("AutoBalanceCreatureStatMemo")->Store(finalStats);
+
+    _ApplyCreatureStats(creature, finalStats);
+}
+
+void AutoBalance_AllCreatureScript::_ApplyCreatureStats(Creature* creature, AutoBalanceCreatureStats stats)
+{
+    AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+
+    creatureABInfo->HealthMultiplier = stats.HealthMultiplier;
+    creatureABInfo->ScaledHealthMultiplier = stats.ScaledHealthMultiplier;
+    creatureABInfo->ManaMultiplier = stats.ManaMultiplier;
+    creatureABInfo->ScaledManaMultiplier = stats.ScaledManaMultiplier;
+    creatureABInfo->ArmorMultiplier = stats.ArmorMultiplier;
+    creatureABInfo->ScaledArmorMultiplier = stats.ScaledArmorMultiplier;
+    creatureABInfo->DamageMultiplier = stats.DamageMultiplier;
+    creatureABInfo->ScaledDamageMultiplier = stats.ScaledDamageMultiplier;
+    creatureABInfo->CCDurationMultiplier = stats.CCDurationMultiplier;
+    creatureABInfo->XPModifier = stats.XPModifier;
+    creatureABInfo->MoneyModifier = stats.MoneyModifier;
+
+    if (!sABScriptMgr->OnBeforeUpdateStats(creature, stats.health, stats.mana, stats.DamageMultiplier, stats.armor))
         return;
 
     uint32 prevMaxHealth = creature->GetMaxHealth();
@@ -1211,22 +1032,17 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
 
     Powers pType = creature->getPowerType();
 
-    creature->SetArmor(newFinalArmor);
-    creature->SetStatFlatModifier(UNIT_MOD_ARMOR, BASE_VALUE, (float)newFinalArmor);
-    creature->SetCreateHealth(newFinalHealth);
-    creature->SetMaxHealth(newFinalHealth);
+    creature->SetArmor(stats.armor);
+    creature->SetStatFlatModifier(UNIT_MOD_ARMOR, BASE_VALUE, (float)stats.armor);
+    creature->SetCreateHealth(stats.health);
+    creature->SetMaxHealth(stats.health);
     creature->ResetPlayerDamageReq();
-    creature->SetCreateMana(newFinalMana);
-    creature->SetMaxPower(Powers::POWER_MANA, newFinalMana);
+    creature->SetCreateMana(stats.mana);
+    creature->SetMaxPower(Powers::POWER_MANA, stats.mana);
     creature->SetStatFlatModifier(UNIT_MOD_ENERGY, BASE_VALUE, (float)100.0f);
     creature->SetStatFlatModifier(UNIT_MOD_RAGE, BASE_VALUE, (float)100.0f);
-    creature->SetStatFlatModifier(UNIT_MOD_HEALTH, BASE_VALUE, (float)newFinalHealth);
-    creature->SetStatFlatModifier(UNIT_MOD_MANA, BASE_VALUE, (float)newFinalMana);
-    creatureABInfo->ScaledHealthMultiplier = scaledHealthMultiplier;
-    creatureABInfo->ScaledManaMultiplier = scaledManaMultiplier;
-    creatureABInfo->ScaledArmorMultiplier = scaledArmorMultiplier;
-    creatureABInfo->ScaledDamageMultiplier = scaledDamageMultiplier;
-    creatureABInfo->CCDurationMultiplier = ccDurationMultiplier;
+    creature->SetStatFlatModifier(UNIT_MOD_HEALTH, BASE_VALUE, (float)stats.health);
+    creature->SetStatFlatModifier(UNIT_MOD_MANA, BASE_VALUE, (float)stats.mana);
 
     // adjust the current health as appropriate
     uint32 scaledCurHealth = 0;
@@ -1273,12 +1089,12 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
     {
         if (prevHealth && prevMaxHealth)
         {
-            scaledCurHealth = float(newFinalHealth) / float(prevMaxHealth) * float(prevHealth);
+            scaledCurHealth = float(stats.health) / float(prevMaxHealth) * float(prevHealth);
             LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledCurHealth ({}) = float(newFinalHealth) ({}) / float(prevMaxHealth) ({}) * float(prevHealth) ({})",
                 creature->GetName(),
                 creatureABInfo->selectedLevel,
                 scaledCurHealth,
-                newFinalHealth,
+                stats.health,
                 prevMaxHealth,
                 prevHealth
             );
@@ -1295,12 +1111,12 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
 
         if (prevPower && prevMaxPower)
         {
-            scaledCurPower = float(newFinalMana) / float(prevMaxPower) * float(prevPower);
+            scaledCurPower = float(stats.mana) / float(prevMaxPower) * float(prevPower);
             LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | scaledCurPower ({}) = float(newFinalMana) ({}) / float(prevMaxPower) ({}) * float(prevPower) ({})",
                 creature->GetName(),
                 creatureABInfo->selectedLevel,
                 scaledCurPower,
-                newFinalMana,
+                stats.mana,
                 prevMaxPower,
                 prevPower
             );
@@ -1331,98 +1147,11 @@ void AutoBalance_AllCreatureScript::ModifyCreatureAttributes(Creature* creature)
     else
     {
         // Scale the damage requirements similar to creature HP scaling
-        uint32 scaledPlayerDmgReq = float(prevPlayerDamageRequired) * float(newFinalHealth) / float(prevCreateHealth);
+        uint32 scaledPlayerDmgReq = float(prevPlayerDamageRequired) * float(stats.health) / float(prevCreateHealth);
         // Do some math
         creature->LowerPlayerDamageReq(playerDamageRequired - scaledPlayerDmgReq, true);
     }
 
-    //
-    // Reward Scaling
-    //
-
-    LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- REWARD SCALING ----------",
-        creature->GetName(),
-        creatureABInfo->selectedLevel
-    );
-
-    // calculate the average multiplier after level scaling is applied
-    float avgHealthDamageMultipliers;
-
-    // only if one of the scaling options is enabled
-    if (RewardScalingXP || RewardScalingMoney)
-    {
-        // use health and damage to calculate the average multiplier
-        avgHealthDamageMultipliers = (scaledHealthMultiplier + scaledDamageMultiplier) / 2.0f;
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | avgHealthDamageMultipliers ({}) = (scaledHealthMultiplier ({}) + scaledDamageMultiplier ({})) / 2.0f",
-            creature->GetName(),
-            creatureABInfo->selectedLevel,
-            avgHealthDamageMultipliers,
-            scaledHealthMultiplier,
-            scaledDamageMultiplier
-        );
-    }
-    else
-    {
-        // Reward scaling is disabled
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Reward scaling is disabled.",
-            creature->GetName(),
-            creatureABInfo->selectedLevel
-        );
-    }
-
-    // XP Scaling
-    if (RewardScalingXP)
-    {
-        if (RewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
-        {
-            creatureABInfo->XPModifier = RewardScalingXPModifier;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Fixed Mode: XPModifier ({}) = RewardScalingXPModifier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                creatureABInfo->XPModifier,
-                RewardScalingXPModifier
-            );
-        }
-        else if (RewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
-        {
-            creatureABInfo->XPModifier = avgHealthDamageMultipliers * RewardScalingXPModifier;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Dynamic Mode: XPModifier ({}) = avgHealthDamageMultipliers ({}) * RewardScalingXPModifier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                creatureABInfo->XPModifier,
-                avgHealthDamageMultipliers,
-                RewardScalingXPModifier
-            );
-        }
-    }
-
-    // Money Scaling
-    if (RewardScalingMoney)
-    {
-
-        if (RewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
-        {
-            creatureABInfo->MoneyModifier = RewardScalingMoneyModifier;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Fixed Mode: MoneyModifier ({}) = RewardScalingMoneyModifier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                creatureABInfo->MoneyModifier,
-                RewardScalingMoneyModifier
-            );
-        }
-        else if (RewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
-        {
-            creatureABInfo->MoneyModifier = avgHealthDamageMultipliers * RewardScalingMoneyModifier;
-            LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Dynamic Mode: MoneyModifier ({}) = avgHealthDamageMultipliers ({}) * RewardScalingMoneyModifier ({})",
-                creature->GetName(),
-                creatureABInfo->selectedLevel,
-                creatureABInfo->MoneyModifier,
-                avgHealthDamageMultipliers,
-                RewardScalingMoneyModifier
-            );
-        }
-    }
-
     // update all stats
     creature->UpdateAllStats();
 
@@ -1509,14 +1238,7 @@ bool AutoBalance_AllCreatureScript::_isSummonCloneOfSummoner(Creature* summon)
         return false;
 
     // if this creature's ID is in the list of creatures that are not clones of their summoner (creatureIDsThatAreNotClones), return false
-    if (
-        std::find
-        (
-            creatureIDsThatAreNotClones.begin(),
-            creatureIDsThatAreNotClones.end(),
-            summon->GetEntry()
-        ) != creatureIDsThatAreNotClones.end()
-        )
+    if (GetCreaturePolicy(summon, summonABInfo).isNeverClone)
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | creatureIDsThatAreNotClones contains this creature's ID ({}) | false",
             summon->GetName(),
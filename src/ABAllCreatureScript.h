@@ -5,6 +5,10 @@
 #ifndef __AB_ALL_CREATURE_SCRIPT_H
 #define __AB_ALL_CREATURE_SCRIPT_H
 
+#include "ABCreatureInfo.h"
+#include "ABMapInfo.h"
+#include "ABUtils.h"
+
 #include "ScriptMgr.h"
 
 class AutoBalance_AllCreatureScript : public AllCreatureScript
@@ -19,14 +23,32 @@ public:
     void OnCreatureSelectLevel(const CreatureTemplate* /* cinfo */, Creature* creature) override;
     void OnCreatureAddWorld(Creature* creature) override;
     void OnCreatureRemoveWorld(Creature* creature) override;
-    void OnAllCreatureUpdate(Creature* creature, uint32 /*diff*/) override;
 
     // Reset the passed creature to stock if the config has changed
-    bool ResetCreatureIfNeeded(Creature* creature);
-    void ModifyCreatureAttributes(Creature* creature);
+    static bool ResetCreatureIfNeeded(Creature* creature);
+    // batchCurveMultipliers, if set, holds the non-boss and boss curve multipliers already resolved for the creature's map
+    static void ModifyCreatureAttributes(Creature* creature, CreatureCurveMultipliers const* batchCurveMultipliers = nullptr);
+
+    // Reset and modify every out-of-date creature in the map in a single pass
+    static void RescaleMapCreatures(Map* map);
+    // Reset and modify the creatures in the map's update queue
+    static void ProcessUpdateQueue(Map* map);
+    // Queue only the creatures whose level or stats depend on the map's (changed) highest player level
+    static void RescaleCreaturesForPlayerLevel(Map* map);
+
+    // Whether the creature's level should follow the players' level on its map
+    static bool IsCreatureLevelScaled(AutoBalanceMapInfo const* mapABInfo, AutoBalanceCreatureInfo const* creatureABInfo);
+    // The level a level scaled creature should be set to
+    static uint8 SelectScaledCreatureLevel(Creature* creature, AutoBalanceMapInfo const* mapABInfo, AutoBalanceCreatureInfo* creatureABInfo);
 
 private:
-    bool _isSummonCloneOfSummoner(Creature* summon);
+    static bool _isSummonCloneOfSummoner(Creature* summon);
+    // ModifyCreatureAttributes up to the multiplier calculation, false if the creature is left as it is or was re-applied from its stat memo
+    static bool _PrepareCreatureAttributes(Creature* creature, CreatureCurveMultipliers const* batchCurveMultipliers, CreatureCurveMultipliers& curveMultipliers, AutoBalanceScalingCreature& scalingCreature, AutoBalanceCreatureStats& finalStats);
+    // ModifyCreatureAttributes from the calculated multipliers: remember and apply the final stats
+    static void _FinishCreatureAttributes(Creature* creature, AutoBalanceScalingCreature const& scalingCreature, AutoBalanceCreatureMultipliers const& multipliers, AutoBalanceCreatureStats finalStats);
+    // Apply the final stats to the creature, calculated by ModifyCreatureAttributes or remembered from an earlier call
+    static void _ApplyCreatureStats(Creature* creature, AutoBalanceCreatureStats stats);
 };
 
 #endif /* __AB_ALL_CREATURE_SCRIPT_H */
@@ -1,12 +1,70 @@
 #include "ABAllMapScript.h"
 
+#include "ABAllCreatureScript.h"
 #include "ABConfig.h"
+#include "ABInstanceRegistry.h"
 #include "ABMapInfo.h"
+#include "ABMapInfoPool.h"
+#include "ABMetrics.h"
 #include "ABUtils.h"
 
 #include "Chat.h"
 #include "Message.h"
 
+void AutoBalance_AllMapScript::OnDestroyMap(Map* map)
+{
+    RemoveInstanceSummary(map);
+    ReleaseMapInfoStorage(map);
+}
+
+void AutoBalance_AllMapScript::OnMapUpdate(Map* map, uint32 diff)
+{
+    if (!map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    AutoBalanceMetricsTimer metricsTimer(map, AUTOBALANCE_METRIC_MAP_UPDATE);
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    // roll the profiling window used by `.ab top`
+    UpdateMapMetricsWindow(mapABInfo->metrics, diff, mapABInfo->modifyCreatureAttributesCount);
+
+    // apply a player count change once it has waited out the debounce window
+    UpdatePlayerCountDebounce(map, diff);
+
+    // if creatures were registered as part of a spawn burst, the map's data is calculated once and they are all scaled below
+    bool spawnBurstEnded = mapABInfo->spawnBurstActive;
+    uint32 modifyCountBefore = mapABInfo->modifyCreatureAttributesCount;
+
+    mapABInfo->spawnBurstActive = false;
+
+    // update map data if it is out of date (or forced at the end of a spawn burst); any change queues the map's creatures
+    UpdateMapDataIfNeeded(map, spawnBurstEnded);
+
+    // only process the queue when something is waiting in it
+    if (mapABInfo->allCreaturesNeedUpdate || !mapABInfo->creatureUpdateQueue.empty())
+        AutoBalance_AllCreatureScript::ProcessUpdateQueue(map);
+
+    if (spawnBurstEnded)
+    {
+        uint32 spawnBurstModifications = mapABInfo->modifyCreatureAttributesCount - modifyCountBefore;
+
+        // kept for `.ab mapstat` and the metrics export, to compare against maps scaled without AutoBalance.SpawnBurst
+        mapABInfo->spawnBurstTotalCount++;
+        mapABInfo->spawnBurstTotalCreatures += mapABInfo->spawnBurstCreatureCount;
+        mapABInfo->spawnBurstTotalModifications += spawnBurstModifications;
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_AllMapScript::OnMapUpdate: Map {} ({}{}) | Spawn burst of ({}) creature(s) scaled with ({}) modification(s).",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            mapABInfo->spawnBurstCreatureCount,
+            spawnBurstModifications
+        );
+
+        mapABInfo->spawnBurstCreatureCount = 0;
+    }
+}
 
 void AutoBalance_AllMapScript::OnPlayerEnterAll(Map* map, Player* player)
 {
@@ -36,10 +94,7 @@ void AutoBalance_AllMapScript::OnPlayerEnterAll(Map* map, Player* player)
     AddPlayerToMap(map, player);
 
     // recalculate the zone's level stats
-    mapABInfo->highestCreatureLevel = 0;
-    mapABInfo->lowestCreatureLevel = 0;
-    //mapABInfo->avgCreatureLevel = 0;
-    mapABInfo->activeCreatureCount = 0;
+    ResetMapCreatureLevelStats(map);
 
     WorldSession* session = player->GetSession();
     LocaleConstant locale = session->GetSessionDbLocaleIndex();
@@ -78,6 +133,9 @@ void AutoBalance_AllMapScript::OnPlayerEnterAll(Map* map, Player* player)
         {
             if (mapABInfo->playerCount)
             {
+                // the announcement is the same for everyone else, so only format it once per locale
+                ABLocaleMessageCache enteringMessage(AB_MSG_ANNOUNCE_NON_GM_ENTERING_INSTANCE);
+
                 for (std::vector<Player*>::const_iterator playerIterator = mapABInfo->allMapPlayers.begin(); playerIterator != mapABInfo->allMapPlayers.end(); ++playerIterator)
                 {
                     Player* thisPlayer = *playerIterator;
@@ -90,16 +148,16 @@ void AutoBalance_AllMapScript::OnPlayerEnterAll(Map* map, Player* player)
 
                         if (thisPlayer && thisPlayer == player) // This is the player that entered
                         {
-                            chatHandle.PSendSysMessage(ABGetLocaleText(locale, "welcome_to_player").c_str(),
+                            chatHandle.PSendSysMessage(ABGetLocaleText(locale, AB_MSG_WELCOME_TO_PLAYER),
                                 map->GetMapName(),
                                 instanceMap->GetMaxPlayers(),
                                 instanceDifficulty.c_str(),
                                 mapABInfo->playerCount,
                                 mapABInfo->adjustedPlayerCount);
 
-                            // Calculate and display stat multipliers for creatures and bosses
-                            StatMultiplierDisplay creatureStats = CalculateStatMultipliersForDisplay(instanceMap, false);
-                            StatMultiplierDisplay bossStats = CalculateStatMultipliersForDisplay(instanceMap, true);
+                            // Display the stat multipliers for creatures and bosses, calculated during the map refresh
+                            StatMultiplierDisplay const& creatureStats = GetMapDisplayMultipliers(map, false);
+                            StatMultiplierDisplay const& bossStats     = GetMapDisplayMultipliers(map, true);
                             
                             chatHandle.PSendSysMessage("|cff00ff00AutoBalance:|r Difficulty set for {} players.", mapABInfo->adjustedPlayerCount);
                             chatHandle.PSendSysMessage("|cff00ff00Creatures:|r Health: {:.1f}% | Damage: {:.1f}%", 
@@ -109,13 +167,16 @@ void AutoBalance_AllMapScript::OnPlayerEnterAll(Map* map, Player* player)
 
                             // notify GMs that they won't be accounted for
                             if (player->IsGameMaster())
-                                chatHandle.PSendSysMessage(ABGetLocaleText(locale, "welcome_to_gm").c_str());
+                                chatHandle.PSendSysMessage(ABGetLocaleText(locale, AB_MSG_WELCOME_TO_GM));
                         }
                         else
                         {
                             // announce non-GMs entering the instance only
                             if (!player->IsGameMaster())
-                                chatHandle.PSendSysMessage(ABGetLocaleText(locale, "announce_non_gm_entering_instance").c_str(), player->GetName().c_str(), mapABInfo->playerCount, mapABInfo->adjustedPlayerCount);
+                                chatHandle.SendSysMessage(enteringMessage.Get(thisPlayer->GetSession()->GetSessionDbLocaleIndex(),
+                                    player->GetName(),
+                                    mapABInfo->playerCount,
+                                    mapABInfo->adjustedPlayerCount));
                         }
                     }
                 }
@@ -159,10 +220,7 @@ void AutoBalance_AllMapScript::OnPlayerLeaveAll(Map* map, Player* player)
         return;
 
     // recalculate the zone's level stats
-    mapABInfo->highestCreatureLevel = 0;
-    mapABInfo->lowestCreatureLevel = 0;
-    //mapABInfo->avgCreatureLevel = 0;
-    mapABInfo->activeCreatureCount = 0;
+    ResetMapCreatureLevelStats(map);
 
     // see which existing creatures are active
     for (std::vector<Creature*>::iterator creatureIterator = mapABInfo->allMapCreatures.begin(); creatureIterator != mapABInfo->allMapCreatures.end(); ++creatureIterator)
@@ -209,25 +267,29 @@ void AutoBalance_AllMapScript::OnPlayerLeaveAll(Map* map, Player* player)
         {
             if (mapABInfo->playerCount)
             {
+                // the announcement is the same for everyone, so only format it once per locale
+                ABLocaleMessageCache leavingMessage(mapABInfo->combatLocked ? AB_MSG_LEAVING_INSTANCE_COMBAT : AB_MSG_LEAVING_INSTANCE);
+
                 for (std::vector<Player*>::const_iterator playerIterator = mapABInfo->allMapPlayers.begin(); playerIterator != mapABInfo->allMapPlayers.end(); ++playerIterator)
                 {
                     Player* thisPlayer = *playerIterator;
                     if (thisPlayer && thisPlayer != player)
                     {
                         ChatHandler chatHandle = ChatHandler(thisPlayer->GetSession());
+                        LocaleConstant thisLocale = thisPlayer->GetSession()->GetSessionDbLocaleIndex();
 
                         if (mapABInfo->combatLocked)
                         {
-                            chatHandle.PSendSysMessage(ABGetLocaleText(thisPlayer->GetSession()->GetSessionDbLocaleIndex(), "leaving_instance_combat").c_str(),
-                                player->GetName().c_str(),
-                                mapABInfo->adjustedPlayerCount);
+                            chatHandle.SendSysMessage(leavingMessage.Get(thisLocale,
+                                player->GetName(),
+                                mapABInfo->adjustedPlayerCount));
                         }
                         else
                         {
-                            chatHandle.PSendSysMessage(ABGetLocaleText(thisPlayer->GetSession()->GetSessionDbLocaleIndex(), "leaving_instance").c_str(),
-                                player->GetName().c_str(),
+                            chatHandle.SendSysMessage(leavingMessage.Get(thisLocale,
+                                player->GetName(),
                                 mapABInfo->playerCount,
-                                mapABInfo->adjustedPlayerCount);
+                                mapABInfo->adjustedPlayerCount));
                         }
                     }
                 }
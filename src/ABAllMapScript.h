@@ -12,12 +12,18 @@ class AutoBalance_AllMapScript : public AllMapScript
 public:
     AutoBalance_AllMapScript()
         : AllMapScript("AutoBalance_AllMapScript", {
+            ALLMAPHOOK_ON_DESTROY_MAP,
+            ALLMAPHOOK_ON_MAP_UPDATE,
             ALLMAPHOOK_ON_PLAYER_ENTER_ALL,
             ALLMAPHOOK_ON_PLAYER_LEAVE_ALL
         })
     {
     }
 
+    // hook triggers when the map is unloaded; leaves the instance registry and keeps the map's containers for the next instance of the same map
+    void OnDestroyMap(Map* map) override;
+    // hook triggers once per map update; processes the map's creature update queue
+    void OnMapUpdate(Map* map, uint32 diff) override;
     // hook triggers after the player has already entered the world
     void OnPlayerEnterAll(Map* map, Player* player) override;
     // hook triggers just before the player left the world
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABCombatCapture.h"
+
+#include "ABConfig.h"
+#include "ABMapInfo.h"
+#include "ABUtils.h"
+
+#include "Creature.h"
+#include "Log.h"
+#include "Map.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static_assert((AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE & (AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE - 1)) == 0, "AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE must be a power of two");
+
+//
+// Bounded multi-producer ring; each cell's sequence says whether it is free for the producer at that
+// position or holds an event for the writer at that position
+//
+struct AutoBalanceCombatCaptureQueueCell
+{
+    std::atomic<size_t>           sequence { 0 };
+    AutoBalanceCombatCaptureEvent event;
+};
+
+static std::unique_ptr<AutoBalanceCombatCaptureQueueCell[]> combatCaptureQueue;            // Allocated the first time the capture is enabled, never resized
+static std::atomic<size_t>                                  combatCaptureEnqueuePosition  { 0 };
+static size_t                                               combatCaptureDequeuePosition  = 0;   // Only used by the writer thread
+static std::atomic<bool>                                    combatCaptureActive           { false };
+static std::atomic<uint64>                                  combatCaptureCount            { 0 };  // Events captured or dropped, counted against the limit
+static std::atomic<uint64>                                  combatCaptureDropped          { 0 };
+static std::atomic<uint64>                                  combatCaptureWritten          { 0 };
+static uint64                                               combatCaptureMaxEvents        = 0;   // CombatCaptureMaxEvents when the capture was opened
+static std::chrono::steady_clock::time_point                combatCaptureStartTime;
+
+static std::thread                                          combatCaptureThread;
+static std::atomic<bool>                                    combatCaptureThreadRunning    { false };
+static std::string                                          combatCaptureFileName;
+
+static bool _PushCombatCaptureEvent(AutoBalanceCombatCaptureEvent const& event)
+{
+    size_t position = combatCaptureEnqueuePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        AutoBalanceCombatCaptureQueueCell& cell = combatCaptureQueue[position & (AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE - 1)];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0)
+        {
+            // the cell is free, claim it
+            if (combatCaptureEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell.event = event;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the writer hasn't caught up with this cell yet, the queue is full
+            return false;
+        }
+        else
+        {
+            // another map thread claimed this position first
+            position = combatCaptureEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+static bool _PopCombatCaptureEvent(AutoBalanceCombatCaptureEvent& event)
+{
+    AutoBalanceCombatCaptureQueueCell& cell = combatCaptureQueue[combatCaptureDequeuePosition & (AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE - 1)];
+
+    if (cell.sequence.load(std::memory_order_acquire) != combatCaptureDequeuePosition + 1)
+        return false;
+
+    event = cell.event;
+    cell.sequence.store(combatCaptureDequeuePosition + AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE, std::memory_order_release);
+    ++combatCaptureDequeuePosition;
+
+    return true;
+}
+
+static void _WriteCombatCaptureEvents(FILE* file, std::vector<AutoBalanceCombatCaptureEvent>& buffer)
+{
+    AutoBalanceCombatCaptureEvent event;
+    uint64 count = 0;
+
+    // one fwrite per block rather than per event
+    while (_PopCombatCaptureEvent(event))
+    {
+        buffer.push_back(event);
+
+        if (buffer.size() == buffer.capacity())
+        {
+            fwrite(buffer.data(), sizeof(AutoBalanceCombatCaptureEvent), buffer.size(), file);
+            count += buffer.size();
+            buffer.clear();
+        }
+    }
+
+    if (!buffer.empty())
+    {
+        fwrite(buffer.data(), sizeof(AutoBalanceCombatCaptureEvent), buffer.size(), file);
+        count += buffer.size();
+        buffer.clear();
+    }
+
+    if (!count)
+        return;
+
+    fflush(file);
+    combatCaptureWritten.fetch_add(count, std::memory_order_relaxed);
+}
+
+static void _CombatCaptureWriter(FILE* file)
+{
+    std::vector<AutoBalanceCombatCaptureEvent> buffer;
+    buffer.reserve(1024);
+
+    uint64 reportedDropped = combatCaptureDropped.load(std::memory_order_relaxed);
+
+    while (combatCaptureThreadRunning.load(std::memory_order_acquire))
+    {
+        _WriteCombatCaptureEvents(file, buffer);
+
+        uint64 dropped = combatCaptureDropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped)
+        {
+            LOG_WARN("module.AutoBalance", "AutoBalance::CombatCaptureWriter: The capture queue was full, {} events dropped ({} total).", dropped - reportedDropped, dropped);
+            reportedDropped = dropped;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(AUTOBALANCE_COMBAT_CAPTURE_WRITE_INTERVAL));
+    }
+
+    // write whatever was queued before we were stopped
+    _WriteCombatCaptureEvents(file, buffer);
+    fclose(file);
+}
+
+static void _CloseCombatCapture()
+{
+    combatCaptureActive = false;
+
+    if (!combatCaptureThread.joinable())
+        return;
+
+    combatCaptureThreadRunning.store(false, std::memory_order_release);
+    combatCaptureThread.join();
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::CloseCombatCapture: Closed capture file `{}` after {} events ({} dropped).",
+        combatCaptureFileName,
+        combatCaptureWritten.load(std::memory_order_relaxed),
+        combatCaptureDropped.load(std::memory_order_relaxed)
+    );
+}
+
+static uint8 _GetCombatCaptureRole(Unit* unit)
+{
+    if (!unit)
+        return AUTOBALANCE_CAPTURE_ROLE_NONE;
+
+    if (unit->GetTypeId() == TYPEID_PLAYER)
+        return AUTOBALANCE_CAPTURE_ROLE_PLAYER;
+
+    if (unit->IsControlledByPlayer())
+        return AUTOBALANCE_CAPTURE_ROLE_PLAYER_CONTROLLED;
+
+    if (Creature* creature = unit->ToCreature())
+        if (creature->IsDungeonBoss() || creature->isWorldBoss())
+            return AUTOBALANCE_CAPTURE_ROLE_BOSS;
+
+    return AUTOBALANCE_CAPTURE_ROLE_CREATURE;
+}
+
+void OpenCombatCapture()
+{
+    // keep the current writer if nothing changed on a config reload
+    if (CombatCaptureEnable && combatCaptureActive && combatCaptureFileName == CombatCaptureFile)
+        return;
+
+    _CloseCombatCapture();
+
+    if (!CombatCaptureEnable)
+        return;
+
+    FILE* file = fopen(CombatCaptureFile.c_str(), "wb");
+    if (!file)
+    {
+        LOG_ERROR("module.AutoBalance", "AutoBalance::OpenCombatCapture: Could not open capture file `{}`. Combat capture is disabled.", CombatCaptureFile);
+        return;
+    }
+
+    AutoBalanceCombatCaptureHeader header;
+    header.eventSize = sizeof(AutoBalanceCombatCaptureEvent);
+    fwrite(&header, sizeof(header), 1, file);
+
+    if (!combatCaptureQueue)
+    {
+        combatCaptureQueue = std::make_unique<AutoBalanceCombatCaptureQueueCell[]>(AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE);
+
+        for (size_t i = 0; i < AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE; ++i)
+            combatCaptureQueue[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    combatCaptureFileName  = CombatCaptureFile;
+    combatCaptureMaxEvents = CombatCaptureMaxEvents;
+    combatCaptureStartTime = std::chrono::steady_clock::now();
+    combatCaptureCount     = 0;
+    combatCaptureWritten   = 0;
+    combatCaptureDropped   = 0;
+
+    combatCaptureThreadRunning.store(true, std::memory_order_release);
+    combatCaptureThread = std::thread(_CombatCaptureWriter, file);
+
+    // release so the map threads see the queue and the settings above
+    combatCaptureActive.store(true, std::memory_order_release);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::OpenCombatCapture: Capturing combat events to `{}` (limit: {}).", combatCaptureFileName, combatCaptureMaxEvents);
+}
+
+void CloseCombatCapture()
+{
+    _CloseCombatCapture();
+}
+
+bool IsCombatCaptureActive()
+{
+    return combatCaptureActive.load(std::memory_order_relaxed);
+}
+
+void CaptureCombatEvent(Combat_Capture_Hook hook, Unit* target, Unit* source, uint32 spellId, AutoBalanceCombatDecision const& decision, int32 amountIn, int32 amountOut)
+{
+    // acquire so the queue allocated by OpenCombatCapture is visible
+    if (!combatCaptureActive.load(std::memory_order_acquire))
+        return;
+
+    // only instances are captured, the hooks return early everywhere else
+    if (!target || !target->GetMap() || !target->GetMap()->IsDungeon())
+        return;
+
+    // a limit of 0 captures until the capture is disabled
+    uint64 index = combatCaptureCount.fetch_add(1, std::memory_order_relaxed);
+    if (combatCaptureMaxEvents && index >= combatCaptureMaxEvents)
+        return;
+
+    if (combatCaptureMaxEvents && index + 1 == combatCaptureMaxEvents)
+    {
+        combatCaptureActive = false;
+        LOG_INFO("module.AutoBalance", "AutoBalance::CaptureCombatEvent: Reached AutoBalance.Capture.MaxEvents ({}).", combatCaptureMaxEvents);
+    }
+
+    Map* map = target->GetMap();
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    AutoBalanceCombatCaptureEvent event;
+    event.timestamp           = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - combatCaptureStartTime).count();
+    event.mapId               = map->GetId();
+    event.instanceId          = map->GetInstanceId();
+    event.sourceEntry         = (source && source->GetTypeId() != TYPEID_PLAYER) ? source->GetEntry() : 0;
+    event.targetEntry         = target->GetTypeId() != TYPEID_PLAYER ? target->GetEntry() : 0;
+    event.spellId             = spellId;
+    event.amountIn            = amountIn;
+    event.amountOut           = amountOut;
+    event.flags               = decision.flags;
+    event.multiplier          = decision.multiplier;
+    event.hook                = hook;
+    event.sourceRole          = _GetCombatCaptureRole(source);
+    event.targetRole          = _GetCombatCaptureRole(target);
+    event.difficulty          = map->GetDifficulty();
+    event.playerCount         = mapABInfo->playerCount;
+    event.adjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+    event.mapLevel            = mapABInfo->mapLevel;
+    event.enabled             = mapABInfo->enabled;
+    event.reason              = decision.reason;
+    event.multiplierSource    = decision.multiplierSource;
+
+    if (!_PushCombatCaptureEvent(event))
+        combatCaptureDropped.fetch_add(1, std::memory_order_relaxed);
+}
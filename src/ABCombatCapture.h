@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_COMBAT_CAPTURE_H
+#define __AB_COMBAT_CAPTURE_H
+
+#include "ABCombatCaptureFormat.h"
+#include "ABCombatDecision.h"
+#include "AutoBalance.h"
+
+#include "Define.h"
+#include "Unit.h"
+
+//
+// The map threads queue their events on a bounded lock-free ring and a background thread writes them to disk
+// Events that don't fit in the ring are dropped and counted, the hooks never wait for the writer
+//
+
+#define AUTOBALANCE_COMBAT_CAPTURE_QUEUE_SIZE     65536 // events waiting for the writer, must be a power of two
+#define AUTOBALANCE_COMBAT_CAPTURE_WRITE_INTERVAL 100   // milliseconds between the writer's passes over the queue
+
+void OpenCombatCapture();
+void CloseCombatCapture();
+bool IsCombatCaptureActive();
+void CaptureCombatEvent(Combat_Capture_Hook hook, Unit* target, Unit* source, uint32 spellId, AutoBalanceCombatDecision const& decision, int32 amountIn, int32 amountOut);
+
+#endif
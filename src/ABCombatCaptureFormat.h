@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_COMBAT_CAPTURE_FORMAT_H
+#define __AB_COMBAT_CAPTURE_FORMAT_H
+
+#include <cstdint>
+
+//
+// Binary capture of the damage, healing and CC duration decisions made by the UnitScript hooks
+//
+// The file starts with an AutoBalanceCombatCaptureHeader followed by a flat array of
+// AutoBalanceCombatCaptureEvent records. All fields are little-endian and fixed width.
+// Each event holds the decision's inputs (flags and multiplier) and its outcome, so ab_replay
+// can make the decision again with the current decision code and compare.
+//
+// Version 2 added flags, multiplier, reason and multiplierSource.
+//
+
+#define AUTOBALANCE_COMBAT_CAPTURE_MAGIC   0x43434241 // "ABCC"
+#define AUTOBALANCE_COMBAT_CAPTURE_VERSION 2
+
+#pragma pack(push, 1)
+
+struct AutoBalanceCombatCaptureHeader
+{
+    uint32_t magic               = AUTOBALANCE_COMBAT_CAPTURE_MAGIC;
+    uint16_t version             = AUTOBALANCE_COMBAT_CAPTURE_VERSION;
+    uint16_t eventSize           = 0;     // sizeof(AutoBalanceCombatCaptureEvent) when the file was written
+};
+
+struct AutoBalanceCombatCaptureEvent
+{
+    uint32_t timestamp           = 0;     // Milliseconds since the capture file was opened
+    uint32_t mapId               = 0;     // The map the target was in
+    uint32_t instanceId          = 0;     // The instance the target was in
+    uint32_t sourceEntry         = 0;     // The source's creature entry (0 for players or no source)
+    uint32_t targetEntry         = 0;     // The target's creature entry (0 for players)
+    uint32_t spellId             = 0;     // The spell that caused the event (0 for melee)
+    int32_t  amountIn            = 0;     // The amount (or aura duration) before AutoBalance modified it
+    int32_t  amountOut           = 0;     // The amount (or aura duration) after AutoBalance modified it
+    uint32_t flags               = 0;     // Damage_Healing_Flag, or CC_Duration_Flag for the aura hook
+    float    multiplier          = 1.0f;  // The multiplier that was looked up (1.0 when none was needed)
+    uint8_t  hook                = 0;     // Combat_Capture_Hook
+    uint8_t  sourceRole          = 0;     // Combat_Capture_Role
+    uint8_t  targetRole          = 0;     // Combat_Capture_Role
+    uint8_t  difficulty          = 0;     // The map's difficulty
+    uint8_t  playerCount         = 0;     // The map's actual player count
+    uint8_t  adjustedPlayerCount = 0;     // The player count the map was scaled to
+    uint8_t  mapLevel            = 0;     // The map's level
+    uint8_t  enabled             = 0;     // Whether AutoBalance was enabled on the map
+    uint8_t  reason              = 0;     // Decision_Trace_Reason
+    uint8_t  multiplierSource    = 0;     // Combat_Multiplier_Source
+};
+
+#pragma pack(pop)
+
+#endif
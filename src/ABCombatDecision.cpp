@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABCombatDecision.h"
+
+static char const* decisionTraceReasonNames[AUTOBALANCE_TRACE_REASON_COUNT] =
+{
+    "global_disabled",
+    "source_not_in_world",
+    "spell_never_modified",
+    "map_not_enabled",
+    "player_self_heal",
+    "player_spends_health",
+    "enemy_player",
+    "shared_damage_aura",
+    "player_pet",
+    "map_multiplier",
+    "map_multiplier_unscaled",
+    "creature_multiplier",
+    "creature_multiplier_unscaled",
+    "cc_duration",
+    "unchanged"
+};
+
+static char const* combatMultiplierSourceNames[AUTOBALANCE_MULTIPLIER_SOURCE_COUNT] =
+{
+    "none",
+    "source_map_world",
+    "source_map_scaled_world",
+    "target_map_world",
+    "target_map_scaled_world",
+    "source_damage",
+    "source_scaled_damage",
+    "caster_cc_duration"
+};
+
+static void _Decide(AutoBalanceCombatDecision& decision, Decision_Trace_Reason reason, Combat_Multiplier_Source multiplierSource = AUTOBALANCE_MULTIPLIER_NONE)
+{
+    decision.reason           = reason;
+    decision.multiplierSource = multiplierSource;
+}
+
+void decideDamageHealing(AutoBalanceCombatDecision& decision, int32_t amount)
+{
+    uint32_t flags = decision.flags;
+
+    //
+    // Pre-flight Checks
+    //
+
+    if (!(flags & AUTOBALANCE_DAMAGE_HEALING_GLOBAL_ENABLED))
+        return _Decide(decision, AUTOBALANCE_TRACE_GLOBAL_DISABLED);
+
+    // outside of instances nothing is modified or traced
+    if (!(flags & AUTOBALANCE_DAMAGE_HEALING_IN_INSTANCE))
+        return _Decide(decision, AUTOBALANCE_TRACE_UNCHANGED);
+
+    if (!(flags & AUTOBALANCE_DAMAGE_HEALING_SOURCE_IN_WORLD))
+        return _Decide(decision, AUTOBALANCE_TRACE_SOURCE_NOT_IN_WORLD);
+
+    if (flags & AUTOBALANCE_DAMAGE_HEALING_SPELL_NEVER_MODIFIED)
+        return _Decide(decision, AUTOBALANCE_TRACE_SPELL_NEVER_MODIFIED);
+
+    if (!(flags & AUTOBALANCE_DAMAGE_HEALING_MAPS_ENABLED))
+        return _Decide(decision, AUTOBALANCE_TRACE_MAP_NOT_ENABLED);
+
+    //
+    // Source and Target Checking
+    //
+
+    bool isDamage         = amount < 0;
+    bool sourceIsPlayer   = flags & AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER;
+    bool sourceIsCreature = flags & AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_CREATURE;
+    bool sourceIsTarget   = flags & AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_TARGET;
+    bool targetIsPlayer   = flags & AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER;
+    bool percentHealth    = flags & AUTOBALANCE_DAMAGE_HEALING_PERCENT_HEALTH_AURA;
+
+    // a player healing themselves
+    if (sourceIsPlayer && sourceIsTarget && !isDamage)
+        return _Decide(decision, AUTOBALANCE_TRACE_PLAYER_SELF_HEAL);
+    // a player damaging themselves is scaled, unless the spell is one that spends the player's health
+    else if (sourceIsPlayer && sourceIsTarget)
+    {
+        if (flags & AUTOBALANCE_DAMAGE_HEALING_SPELL_SPENDS_HEALTH)
+            return _Decide(decision, AUTOBALANCE_TRACE_PLAYER_SPENDS_HEALTH);
+    }
+    // a player damaging a friendly unit is scaled
+    else if (sourceIsPlayer && (flags & AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_FRIENDLY) && isDamage)
+    {
+    }
+    // a player under any other condition
+    else if (sourceIsPlayer)
+        return _Decide(decision, AUTOBALANCE_TRACE_ENEMY_PLAYER);
+    // a creature damaging itself with an aura that shares damage
+    else if (sourceIsCreature && sourceIsTarget && (flags & AUTOBALANCE_DAMAGE_HEALING_SHARED_DAMAGE_AURA))
+        return _Decide(decision, AUTOBALANCE_TRACE_SHARED_DAMAGE_AURA);
+
+    // pets and summons under the control of a player, but not mind control targets
+    if (flags & AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER_PET)
+        return _Decide(decision, AUTOBALANCE_TRACE_PLAYER_PET);
+
+    //
+    // Multiplier selection
+    // auras that damage based on a percent of the player's max health use the un-level-scaled multipliers
+    //
+
+    // a player damaging themselves uses the map's multiplier
+    if (sourceIsPlayer && sourceIsTarget && isDamage)
+    {
+        if (percentHealth)
+            _Decide(decision, AUTOBALANCE_TRACE_MAP_MULTIPLIER_UNSCALED, AUTOBALANCE_MULTIPLIER_SOURCE_MAP_WORLD);
+        else
+            _Decide(decision, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_SOURCE_MAP_SCALED_WORLD);
+    }
+    // a non-player healing a player uses the map's multiplier
+    else if (targetIsPlayer && !isDamage)
+        _Decide(decision, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD);
+    // a player damaged by something other than a creature uses the map's multiplier
+    else if (targetIsPlayer && !sourceIsCreature && isDamage)
+    {
+        if (percentHealth)
+            _Decide(decision, AUTOBALANCE_TRACE_MAP_MULTIPLIER_UNSCALED, AUTOBALANCE_MULTIPLIER_TARGET_MAP_WORLD);
+        else
+            _Decide(decision, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD);
+    }
+    // everything else uses the source creature's damage multiplier
+    else
+    {
+        if (percentHealth)
+            _Decide(decision, AUTOBALANCE_TRACE_CREATURE_MULTIPLIER_UNSCALED, AUTOBALANCE_MULTIPLIER_SOURCE_DAMAGE);
+        else
+            _Decide(decision, AUTOBALANCE_TRACE_CREATURE_MULTIPLIER, AUTOBALANCE_MULTIPLIER_SOURCE_SCALED_DAMAGE);
+    }
+}
+
+int32_t applyDamageHealingDecision(AutoBalanceCombatDecision const& decision, int32_t amount)
+{
+    if (decision.multiplierSource == AUTOBALANCE_MULTIPLIER_NONE)
+        return amount;
+
+    return amount * decision.multiplier;
+}
+
+void decideCCDuration(AutoBalanceCombatDecision& decision)
+{
+    // only CC auras that creatures just cast on players inside instances are scaled, and pets and summons of players are left alone
+    uint32_t const required = AUTOBALANCE_CC_DURATION_GLOBAL_ENABLED | AUTOBALANCE_CC_DURATION_HAS_TARGET_AND_CASTER | AUTOBALANCE_CC_DURATION_JUST_CAST |
+                              AUTOBALANCE_CC_DURATION_TARGET_IS_PLAYER | AUTOBALANCE_CC_DURATION_IN_INSTANCE | AUTOBALANCE_CC_DURATION_IS_CROWD_CONTROL;
+    uint32_t const excluded = AUTOBALANCE_CC_DURATION_CASTER_IS_PLAYER | AUTOBALANCE_CC_DURATION_CASTER_IS_PLAYER_PET;
+
+    if ((decision.flags & (required | excluded)) != required || decision.multiplier == 1.0f)
+        return _Decide(decision, AUTOBALANCE_TRACE_UNCHANGED);
+
+    _Decide(decision, AUTOBALANCE_TRACE_CC_DURATION, AUTOBALANCE_MULTIPLIER_CASTER_CC_DURATION);
+}
+
+int32_t applyCCDurationDecision(AutoBalanceCombatDecision const& decision, int32_t duration)
+{
+    if (decision.multiplierSource == AUTOBALANCE_MULTIPLIER_NONE)
+        return duration;
+
+    return (float)duration * decision.multiplier;
+}
+
+char const* getDecisionTraceReasonName(uint8_t reason)
+{
+    return reason < AUTOBALANCE_TRACE_REASON_COUNT ? decisionTraceReasonNames[reason] : "unknown";
+}
+
+char const* getCombatMultiplierSourceName(uint8_t multiplierSource)
+{
+    return multiplierSource < AUTOBALANCE_MULTIPLIER_SOURCE_COUNT ? combatMultiplierSourceNames[multiplierSource] : "unknown";
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_COMBAT_DECISION_H
+#define __AB_COMBAT_DECISION_H
+
+#include "AutoBalance.h"
+
+#include <cstdint>
+
+//
+// The damage, healing and CC duration decisions made by the UnitScript hooks, without any AzerothCore dependencies
+//
+// The hooks describe the event as a set of flags, the decision picks the reason and which multiplier applies,
+// and the hooks look that multiplier up and apply it. The combat capture records the flags and the multiplier,
+// so ab_replay can make the same decisions offline.
+//
+
+// What a damage or healing hook knows about the event
+// Flags are only gathered once the decision can still depend on them, so a missing flag may also mean "not checked"
+enum Damage_Healing_Flag : uint32_t
+{
+    AUTOBALANCE_DAMAGE_HEALING_GLOBAL_ENABLED       = 0x0001, // AutoBalance.Enable.Global
+    AUTOBALANCE_DAMAGE_HEALING_IN_INSTANCE          = 0x0002, // both the source and the target are in an instance
+    AUTOBALANCE_DAMAGE_HEALING_SOURCE_IN_WORLD      = 0x0004,
+    AUTOBALANCE_DAMAGE_HEALING_SPELL_NEVER_MODIFIED = 0x0008, // the spell is in AutoBalance.SpellsToNeverModify
+    AUTOBALANCE_DAMAGE_HEALING_MAPS_ENABLED         = 0x0010, // AutoBalance is enabled on both the source's and the target's map
+    AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER     = 0x0020,
+    AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_CREATURE   = 0x0040,
+    AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_TARGET     = 0x0080,
+    AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER     = 0x0100,
+    AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_FRIENDLY   = 0x0200, // the target is friendly to the source
+    AUTOBALANCE_DAMAGE_HEALING_SPELL_SPENDS_HEALTH  = 0x0400, // the spell is in AutoBalance.SpellsThatSpendPlayerHealth
+    AUTOBALANCE_DAMAGE_HEALING_SHARED_DAMAGE_AURA   = 0x0800, // the spell has a SPELL_AURA_SHARE_DAMAGE_PCT aura
+    AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER_PET = 0x1000, // the source is a pet or summon controlled by a player
+    AUTOBALANCE_DAMAGE_HEALING_PERCENT_HEALTH_AURA  = 0x2000  // the spell has a SPELL_AURA_PERIODIC_DAMAGE_PERCENT aura
+};
+
+// What the CC duration hook knows about the aura
+enum CC_Duration_Flag : uint32_t
+{
+    AUTOBALANCE_CC_DURATION_GLOBAL_ENABLED          = 0x0001, // AutoBalance.Enable.Global
+    AUTOBALANCE_CC_DURATION_HAS_TARGET_AND_CASTER   = 0x0002,
+    AUTOBALANCE_CC_DURATION_JUST_CAST               = 0x0004, // the aura still has its full duration
+    AUTOBALANCE_CC_DURATION_TARGET_IS_PLAYER        = 0x0008,
+    AUTOBALANCE_CC_DURATION_CASTER_IS_PLAYER        = 0x0010,
+    AUTOBALANCE_CC_DURATION_IN_INSTANCE             = 0x0020, // both the target and the caster are in an instance
+    AUTOBALANCE_CC_DURATION_CASTER_IS_PLAYER_PET    = 0x0040, // the caster is a pet or summon controlled by a player
+    AUTOBALANCE_CC_DURATION_IS_CROWD_CONTROL        = 0x0080  // the aura charms, confuses, disarms, fears, pacifies, possesses, silences, stuns or slows
+};
+
+// The multiplier a decision applies
+enum Combat_Multiplier_Source : uint8_t
+{
+    AUTOBALANCE_MULTIPLIER_NONE,                    // the amount is returned unchanged
+    AUTOBALANCE_MULTIPLIER_SOURCE_MAP_WORLD,        // the source map's worldDamageHealingMultiplier
+    AUTOBALANCE_MULTIPLIER_SOURCE_MAP_SCALED_WORLD, // the source map's scaledWorldDamageHealingMultiplier
+    AUTOBALANCE_MULTIPLIER_TARGET_MAP_WORLD,        // the target map's worldDamageHealingMultiplier
+    AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD, // the target map's scaledWorldDamageHealingMultiplier
+    AUTOBALANCE_MULTIPLIER_SOURCE_DAMAGE,           // the source creature's DamageMultiplier
+    AUTOBALANCE_MULTIPLIER_SOURCE_SCALED_DAMAGE,    // the source creature's ScaledDamageMultiplier
+    AUTOBALANCE_MULTIPLIER_CASTER_CC_DURATION,      // the caster's CCDurationMultiplier
+    AUTOBALANCE_MULTIPLIER_SOURCE_COUNT
+};
+
+struct AutoBalanceCombatDecision
+{
+    uint32_t flags            = 0;                           // Damage_Healing_Flag or CC_Duration_Flag
+    float    multiplier       = 1.0f;                        // The multiplier that was looked up, an input for CC durations
+    uint8_t  reason           = AUTOBALANCE_TRACE_UNCHANGED; // Decision_Trace_Reason
+    uint8_t  multiplierSource = AUTOBALANCE_MULTIPLIER_NONE; // Combat_Multiplier_Source
+};
+
+// Sets the reason and the multiplier source from the flags and the sign of the amount (negative for damage)
+void decideDamageHealing(AutoBalanceCombatDecision& decision, int32_t amount);
+
+// The amount once the decision's multiplier is applied
+int32_t applyDamageHealingDecision(AutoBalanceCombatDecision const& decision, int32_t amount);
+
+// Sets the reason and the multiplier source from the flags and the caster's CC duration multiplier, which must already be set
+void decideCCDuration(AutoBalanceCombatDecision& decision);
+
+// The aura duration once the decision's multiplier is applied
+int32_t applyCCDurationDecision(AutoBalanceCombatDecision const& decision, int32_t duration);
+
+char const* getDecisionTraceReasonName(uint8_t reason);
+char const* getCombatMultiplierSourceName(uint8_t multiplierSource);
+
+#endif
@@ -2,16 +2,23 @@
 
 #include "ABConfig.h"
 #include "ABCreatureInfo.h"
+#include "ABInstanceRegistry.h"
 #include "ABMapInfo.h"
+#include "ABMapInfoPool.h"
 #include "ABUtils.h"
 #include "Message.h"
 
+#include "MapMgr.h"
+
+#include <algorithm>
+#include <limits>
+
 bool AutoBalance_CommandScript::HandleABSetOffsetCommand(ChatHandler* handler, const char* args)
 {
     if (!*args)
     {
         handler->PSendSysMessage(".autobalance setoffset #");
-        handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), "set_offset_command_description").c_str());
+        handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), AB_MSG_SET_OFFSET_COMMAND_DESCRIPTION));
         return false;
     }
     char* offset = strtok((char*)args, " ");
@@ -21,19 +28,19 @@ bool AutoBalance_CommandScript::HandleABSetOffsetCommand(ChatHandler* handler, c
     {
         offseti = (uint32)atoi(offset);
         std::vector<std::string> args = { std::to_string(offseti) };
-        handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), "set_offset_command_success").c_str(), offseti);
+        handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), AB_MSG_SET_OFFSET_COMMAND_SUCCESS), offseti);
         PlayerCountDifficultyOffset = offseti;
         globalConfigTime = GetCurrentConfigTime();
         return true;
     }
     else
-        handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), "set_offset_command_error").c_str());
+        handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), AB_MSG_SET_OFFSET_COMMAND_ERROR));
     return false;
 }
 
 bool AutoBalance_CommandScript::HandleABGetOffsetCommand(ChatHandler* handler, const char* /*args*/)
 {
-    handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), "get_offset_command_success").c_str(), PlayerCountDifficultyOffset);
+    handler->PSendSysMessage(ABGetLocaleText(handler->GetSession()->GetSessionDbLocaleIndex(), AB_MSG_GET_OFFSET_COMMAND_SUCCESS), PlayerCountDifficultyOffset);
     return true;
 }
 
@@ -68,59 +75,109 @@ bool AutoBalance_CommandScript::HandleABMapStatsCommand(ChatHandler* handler, co
 
         // Adjusted player count (multiple scenarios)
         if (mapABInfo->combatLockTripped)
-            handler->PSendSysMessage(ABGetLocaleText(locale, "adjusted_player_count_combat_locked").c_str(), mapABInfo->adjustedPlayerCount);
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ADJUSTED_PLAYER_COUNT_COMBAT_LOCKED), mapABInfo->adjustedPlayerCount);
         else if (mapABInfo->playerCount < mapABInfo->minPlayers && !PlayerCountDifficultyOffset)
-            handler->PSendSysMessage(ABGetLocaleText(locale, "adjusted_player_count_map_minimum").c_str(), mapABInfo->adjustedPlayerCount);
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ADJUSTED_PLAYER_COUNT_MAP_MINIMUM), mapABInfo->adjustedPlayerCount);
         else if (mapABInfo->playerCount < mapABInfo->minPlayers && PlayerCountDifficultyOffset)
-            handler->PSendSysMessage(ABGetLocaleText(locale, "adjusted_player_count_map_minimum_difficulty_offset").c_str(), mapABInfo->adjustedPlayerCount, PlayerCountDifficultyOffset);
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ADJUSTED_PLAYER_COUNT_MAP_MINIMUM_DIFFICULTY_OFFSET), mapABInfo->adjustedPlayerCount, PlayerCountDifficultyOffset);
         else if (PlayerCountDifficultyOffset)
-            handler->PSendSysMessage(ABGetLocaleText(locale, "adjusted_player_count_difficulty_offset").c_str(), mapABInfo->adjustedPlayerCount, PlayerCountDifficultyOffset);
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ADJUSTED_PLAYER_COUNT_DIFFICULTY_OFFSET), mapABInfo->adjustedPlayerCount, PlayerCountDifficultyOffset);
         else
-            handler->PSendSysMessage(ABGetLocaleText(locale, "adjusted_player_count").c_str(), mapABInfo->adjustedPlayerCount);
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ADJUSTED_PLAYER_COUNT), mapABInfo->adjustedPlayerCount);
+
+        // Debounced player count changes
+        if (PlayerCountDebounceWindow)
+        {
+            AutoBalancePlayerCountDebounce const& debounce = mapABInfo->playerCountDebounce;
+
+            if (debounce.pending)
+                handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_DEBOUNCE_PENDING_CHANGE),
+                    mapABInfo->adjustedPlayerCount,
+                    debounce.adjustedPlayerCount,
+                    debounce.stableTime / 1000.0f,
+                    PlayerCountDebounceWindow
+                );
+
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_DEBOUNCE_CHANGES),
+                debounce.suppressedChanges,
+                debounce.appliedChanges
+            );
+        }
 
         // LFG levels
-        handler->PSendSysMessage(ABGetLocaleText(locale, "lfg_range").c_str(), mapABInfo->lfgMinLevel, mapABInfo->lfgMaxLevel, mapABInfo->lfgTargetLevel);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_LFG_RANGE), mapABInfo->lfgMinLevel, mapABInfo->lfgMaxLevel, mapABInfo->lfgTargetLevel);
 
         // Calculated map level (creature average)
-        handler->PSendSysMessage(ABGetLocaleText(locale, "map_level").c_str(),
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_MAP_LEVEL),
             (uint8)(mapABInfo->avgCreatureLevel + 0.5f),
-            mapABInfo->isLevelScalingEnabled && mapABInfo->enabled ? "->" + std::to_string(mapABInfo->highestPlayerLevel) + ABGetLocaleText(locale, "level_scaling_enabled").c_str() : ABGetLocaleText(locale, "level_scaling_disabled").c_str()
+            mapABInfo->isLevelScalingEnabled && mapABInfo->enabled ? "->" + std::to_string(mapABInfo->highestPlayerLevel) + std::string(ABGetLocaleText(locale, AB_MSG_LEVEL_SCALING_ENABLED)) : std::string(ABGetLocaleText(locale, AB_MSG_LEVEL_SCALING_DISABLED))
         );
 
         // World Health Multiplier
-        handler->PSendSysMessage(ABGetLocaleText(locale, "world_health_multiplier").c_str(), mapABInfo->worldHealthMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_WORLD_HEALTH_MULTIPLIER), mapABInfo->worldHealthMultiplier);
 
         // World Damage and Healing Multiplier
         if (mapABInfo->worldDamageHealingMultiplier != mapABInfo->scaledWorldDamageHealingMultiplier)
         {
-            handler->PSendSysMessage(ABGetLocaleText(locale, "world_hostile_damage_healing_multiplier_to").c_str(),
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_WORLD_HOSTILE_DAMAGE_HEALING_MULTIPLIER_TO),
                 mapABInfo->worldDamageHealingMultiplier,
                 mapABInfo->scaledWorldDamageHealingMultiplier
             );
         }
         else
         {
-            handler->PSendSysMessage(ABGetLocaleText(locale, "world_hostile_damage_healing_multiplier").c_str(),
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_WORLD_HOSTILE_DAMAGE_HEALING_MULTIPLIER),
                 mapABInfo->worldDamageHealingMultiplier
             );
         }
 
+        // Stat multipliers announced to players
+        StatMultiplierDisplay const& creatureStats = GetMapDisplayMultipliers(player->GetMap(), false);
+        StatMultiplierDisplay const& bossStats     = GetMapDisplayMultipliers(player->GetMap(), true);
+
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_DISPLAY_MULTIPLIERS),
+            creatureStats.healthPercent,
+            creatureStats.damagePercent,
+            bossStats.healthPercent,
+            bossStats.damagePercent
+        );
+
         // Creature Stats
-        handler->PSendSysMessage(ABGetLocaleText(locale, "original_creature_level_range").c_str(),
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ORIGINAL_CREATURE_LEVEL_RANGE),
             mapABInfo->lowestCreatureLevel,
             mapABInfo->highestCreatureLevel,
             mapABInfo->avgCreatureLevel
         );
-        handler->PSendSysMessage(ABGetLocaleText(locale, "active_total_creatures_in_map").c_str(),
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ACTIVE_TOTAL_CREATURES_IN_MAP),
             mapABInfo->activeCreatureCount,
             mapABInfo->allMapCreatures.size()
         );
 
+        // Spawn bursts, against every modification made in the map
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_SPAWN_BURST_STATS),
+            mapABInfo->spawnBurstTotalCount,
+            mapABInfo->spawnBurstTotalCreatures,
+            mapABInfo->spawnBurstTotalModifications,
+            mapABInfo->spawnBurstTotalCreatures ? (float)mapABInfo->spawnBurstTotalModifications / mapABInfo->spawnBurstTotalCreatures : 0.0f,
+            mapABInfo->modifyCreatureAttributesCount,
+            !mapABInfo->allMapCreatures.empty() ? (float)mapABInfo->modifyCreatureAttributesCount / mapABInfo->allMapCreatures.size() : 0.0f
+        );
+
+        // Spawn profile
+        if (mapABInfo->hasLevelProfile)
+            handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_SPAWN_PROFILE),
+                mapABInfo->profileCreatureCount,
+                mapABInfo->profileBossCount,
+                mapABInfo->profileLowestCreatureLevel,
+                mapABInfo->profileHighestCreatureLevel,
+                mapABInfo->profileAvgCreatureLevel
+            );
+
         return true;
     }
     else
     {
-        handler->PSendSysMessage(ABGetLocaleText(locale, "ab_command_only_in_instance").c_str());
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_COMMAND_ONLY_IN_INSTANCE));
         return false;
     }
 }
@@ -139,7 +196,7 @@ bool AutoBalance_CommandScript::HandleABCreatureStatsCommand(ChatHandler* handle
     }
     else if (!target->GetMap()->IsDungeon())
     {
-        handler->PSendSysMessage(ABGetLocaleText(locale, "target_no_in_instance").c_str());
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_TARGET_NO_IN_INSTANCE));
         handler->SetSentErrorMessage(true);
         return false;
     }
@@ -151,36 +208,275 @@ bool AutoBalance_CommandScript::HandleABCreatureStatsCommand(ChatHandler* handle
         target->GetName(),
         targetABInfo->UnmodifiedLevel,
         isCreatureRelevant(target) && targetABInfo->UnmodifiedLevel != target->GetLevel() ? "->" + std::to_string(targetABInfo->selectedLevel) : "",
-        isBossOrBossSummon(target) ? " | Boss" : "",
-        targetABInfo->isActive ? ABGetLocaleText(locale, "active_for_map_stats").c_str() : ABGetLocaleText(locale, "ignored_for_map_stats").c_str());
-    handler->PSendSysMessage(ABGetLocaleText(locale, "creature_difficulty_level").c_str(), targetABInfo->instancePlayerCount);
+        GetCreaturePolicy(target, targetABInfo).isBoss ? " | Boss" : "",
+        targetABInfo->isActive ? ABGetLocaleText(locale, AB_MSG_ACTIVE_FOR_MAP_STATS) : ABGetLocaleText(locale, AB_MSG_IGNORED_FOR_MAP_STATS));
+    handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_CREATURE_DIFFICULTY_LEVEL), targetABInfo->instancePlayerCount);
 
     // summon
     if (target->IsSummon() && targetABInfo->summoner && targetABInfo->isCloneOfSummoner)
-        handler->PSendSysMessage(ABGetLocaleText(locale, "clone_of_summon").c_str(), targetABInfo->summonerName, targetABInfo->summonerLevel);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_CLONE_OF_SUMMON), targetABInfo->summonerName, targetABInfo->summonerLevel);
     else if (target->IsSummon() && targetABInfo->summoner)
-        handler->PSendSysMessage(ABGetLocaleText(locale, "summon_of_summon").c_str(), targetABInfo->summonerName, targetABInfo->summonerLevel);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_SUMMON_OF_SUMMON), targetABInfo->summonerName, targetABInfo->summonerLevel);
     else if (target->IsSummon())
-        handler->PSendSysMessage(ABGetLocaleText(locale, "summon_without_summoner").c_str());
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_SUMMON_WITHOUT_SUMMONER));
 
     // level scaled
     if (targetABInfo->UnmodifiedLevel != target->GetLevel())
     {
-        handler->PSendSysMessage(ABGetLocaleText(locale, "health_multiplier_to").c_str(), targetABInfo->HealthMultiplier, targetABInfo->ScaledHealthMultiplier);
-        handler->PSendSysMessage(ABGetLocaleText(locale, "mana_multiplier_to").c_str(), targetABInfo->ManaMultiplier, targetABInfo->ScaledManaMultiplier);
-        handler->PSendSysMessage(ABGetLocaleText(locale, "armor_multiplier_to").c_str(), targetABInfo->ArmorMultiplier, targetABInfo->ScaledArmorMultiplier);
-        handler->PSendSysMessage(ABGetLocaleText(locale, "damage_multiplier_to").c_str(), targetABInfo->DamageMultiplier, targetABInfo->ScaledDamageMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_HEALTH_MULTIPLIER_TO), targetABInfo->HealthMultiplier, targetABInfo->ScaledHealthMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_MANA_MULTIPLIER_TO), targetABInfo->ManaMultiplier, targetABInfo->ScaledManaMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ARMOR_MULTIPLIER_TO), targetABInfo->ArmorMultiplier, targetABInfo->ScaledArmorMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_DAMAGE_MULTIPLIER_TO), targetABInfo->DamageMultiplier, targetABInfo->ScaledDamageMultiplier);
     }
     // not level scaled
     else
     {
-        handler->PSendSysMessage(ABGetLocaleText(locale, "health_multiplier").c_str(), targetABInfo->HealthMultiplier);
-        handler->PSendSysMessage(ABGetLocaleText(locale, "mana_multiplier").c_str(), targetABInfo->ManaMultiplier);
-        handler->PSendSysMessage(ABGetLocaleText(locale, "armor_multiplier").c_str(), targetABInfo->ArmorMultiplier);
-        handler->PSendSysMessage(ABGetLocaleText(locale, "damage_multiplier").c_str(), targetABInfo->DamageMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_HEALTH_MULTIPLIER), targetABInfo->HealthMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_MANA_MULTIPLIER), targetABInfo->ManaMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_ARMOR_MULTIPLIER), targetABInfo->ArmorMultiplier);
+        handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_DAMAGE_MULTIPLIER), targetABInfo->DamageMultiplier);
+    }
+    handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_CC_DURATION_MULTIPLIER), targetABInfo->CCDurationMultiplier);
+    handler->PSendSysMessage(ABGetLocaleText(locale, AB_MSG_XP_MONEY_MULTIPLIER), targetABInfo->XPModifier, targetABInfo->MoneyModifier);
+
+    return true;
+}
+
+bool AutoBalance_CommandScript::HandleABSimulateCommand(ChatHandler* handler, const char* args)
+{
+    if (!*args)
+    {
+        handler->PSendSysMessage(".autobalance simulate <mapId> [difficulty|all] [players|min-max]");
+        handler->PSendSysMessage("Lists, as CSV, every multiplier the current config gives the map's creatures and bosses for each player count (before level scaling and per-creature overrides).");
+        return false;
+    }
+
+    char* mapIdString       = strtok((char*)args, " ");
+    char* difficultyString  = strtok(nullptr, " ");
+    char* playerCountString = strtok(nullptr, " ");
+
+    uint32 mapId = mapIdString ? (uint32)atoi(mapIdString) : 0;
+
+    // a single difficulty, or every difficulty the map has
+    uint32 minDifficulty = 0;
+    uint32 maxDifficulty = MAX_DIFFICULTY - 1;
+
+    if (difficultyString && strcmp(difficultyString, "all") != 0)
+        minDifficulty = maxDifficulty = (uint32)atoi(difficultyString);
+    else if (!difficultyString)
+        maxDifficulty = 0;
+
+    // a single player count, or a range; clamped to each difficulty's maximum
+    uint32 minPlayerCount = 1;
+    uint32 maxPlayerCount = std::numeric_limits<uint32>::max();
+
+    if (playerCountString)
+    {
+        char const* rangeSeparator = strchr(playerCountString, '-');
+
+        minPlayerCount = std::max(1, atoi(playerCountString));
+        maxPlayerCount = rangeSeparator ? std::max(1, atoi(rangeSeparator + 1)) : minPlayerCount;
+    }
+
+    bool foundDifficulty = false;
+
+    for (uint32 difficulty = minDifficulty; difficulty <= maxDifficulty && difficulty < MAX_DIFFICULTY; ++difficulty)
+    {
+        AutoBalanceMapDescriptor const* descriptor = GetMapDescriptor(mapId, Difficulty(difficulty));
+
+        if (!descriptor)
+            continue;
+
+        if (!foundDifficulty)
+            handler->PSendSysMessage("difficulty,max_players,heroic,enabled,players,boss,health,mana,armor,damage,cc_duration,xp,money");
+
+        foundDifficulty = true;
+
+        AutoBalanceScalingMap scalingMap = GetScalingMap(descriptor);
+
+        for (uint32 playerCount = minPlayerCount; playerCount <= std::min(maxPlayerCount, descriptor->maxPlayers); ++playerCount)
+        {
+            for (bool isBoss : { false, true })
+            {
+                AutoBalanceCreatureMultipliers multipliers = calculateMapMultipliers(ScalingSettings, scalingMap, isBoss, (float)playerCount);
+
+                // the multipliers ModifyCreatureAttributes applies, as fractions of the unscaled values
+                handler->PSendSysMessage("{},{},{},{},{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}",
+                    difficulty,
+                    descriptor->maxPlayers,
+                    descriptor->isHeroic ? 1 : 0,
+                    descriptor->enabled ? 1 : 0,
+                    playerCount,
+                    isBoss ? 1 : 0,
+                    multipliers.healthMultiplier,
+                    multipliers.manaMultiplier,
+                    multipliers.armorMultiplier,
+                    multipliers.damageMultiplier,
+                    multipliers.ccDurationMultiplier,
+                    multipliers.xpModifier,
+                    multipliers.moneyModifier
+                );
+            }
+        }
+    }
+
+    if (!foundDifficulty)
+    {
+        handler->PSendSysMessage("No instance map with ID {} and difficulty {}.", mapId, difficultyString ? difficultyString : "0");
+        return false;
+    }
+
+    return true;
+}
+
+bool AutoBalance_CommandScript::HandleABTopCommand(ChatHandler* handler, const char* args)
+{
+    if (!ProfilingEnable)
+    {
+        handler->PSendSysMessage("Profiling is disabled. Set AutoBalance.Profiling.Enable = 1 and reload the config.");
+        return false;
+    }
+
+    uint32 count = *args ? (uint32)atoi(args) : 10;
+    if (!count)
+        count = 10;
+
+    struct TopRow
+    {
+        Map*                map;
+        AutoBalanceMapInfo* mapABInfo;
+        uint64              timeUs[AUTOBALANCE_METRIC_COUNT];
+        uint64              totalUs;
+    };
+
+    std::vector<TopRow> rows;
+
+    // commands are handled on the world thread between map updates
+    sMapMgr->DoForAllMaps([&rows](Map* map)
+    {
+        if (!map->IsDungeon() || !map->GetInstanceId())
+            return;
+
+        AutoBalanceMapInfo* mapABInfo = map->CustomData.Get<AutoBalanceMapInfo>("AutoBalanceMapInfo");
+        if (!mapABInfo)
+            return;
+
+        TopRow row { map, mapABInfo, {}, 0 };
+
+        for (uint8 type = 0; type < AUTOBALANCE_METRIC_COUNT; ++type)
+            row.timeUs[type] = GetMapMetricsWindowTimeUs(mapABInfo->metrics, Map_Metric_Type(type));
+
+        // scaling time is already part of the creature or map update time it ran in
+        row.totalUs = row.timeUs[AUTOBALANCE_METRIC_HOOKS] + row.timeUs[AUTOBALANCE_METRIC_CREATURES] + row.timeUs[AUTOBALANCE_METRIC_MAP_UPDATE];
+
+        rows.push_back(row);
+    });
+
+    std::sort(rows.begin(), rows.end(), [](TopRow const& a, TopRow const& b) { return a.totalUs > b.totalUs; });
+
+    if (rows.size() > count)
+        rows.resize(count);
+
+    handler->PSendSysMessage("Top {} instances by AutoBalance time over the last {} seconds (ms: total | hooks | creatures | scaling | map update):",
+        rows.size(),
+        AUTOBALANCE_METRICS_WINDOW_BUCKETS * AUTOBALANCE_METRICS_WINDOW_BUCKET_MS / IN_MILLISECONDS
+    );
+
+    for (TopRow const& row : rows)
+    {
+        handler->PSendSysMessage("{} ({}-{}) | {} players, {} creatures, {} rescales | {:.1f} | {:.1f} | {:.1f} | {:.1f} | {:.1f}",
+            row.map->GetMapName(),
+            row.map->GetId(),
+            row.map->GetInstanceId(),
+            row.mapABInfo->playerCount,
+            row.mapABInfo->allMapCreatures.size(),
+            GetMapMetricsWindowRescales(row.mapABInfo->metrics, row.mapABInfo->modifyCreatureAttributesCount),
+            row.totalUs / 1000.0f,
+            row.timeUs[AUTOBALANCE_METRIC_HOOKS] / 1000.0f,
+            row.timeUs[AUTOBALANCE_METRIC_CREATURES] / 1000.0f,
+            row.timeUs[AUTOBALANCE_METRIC_SCALING] / 1000.0f,
+            row.timeUs[AUTOBALANCE_METRIC_MAP_UPDATE] / 1000.0f
+        );
+    }
+
+    return true;
+}
+
+bool AutoBalance_CommandScript::HandleABInstancesCommand(ChatHandler* handler, const char* /*args*/)
+{
+    // the registry holds copies published by each instance, so no map data is read here
+    std::vector<AutoBalanceInstanceSummary> summaries = GetInstanceSummaries();
+
+    std::sort(summaries.begin(), summaries.end(), [](AutoBalanceInstanceSummary const& a, AutoBalanceInstanceSummary const& b)
+    {
+        return a.mapId != b.mapId ? a.mapId < b.mapId : a.instanceId < b.instanceId;
+    });
+
+    handler->PSendSysMessage("{} AutoBalance-enabled instances (players | adjusted | level | creature health/damage | boss health/damage):", summaries.size());
+
+    for (AutoBalanceInstanceSummary const& summary : summaries)
+    {
+        handler->PSendSysMessage("{} ({}-{}) | {}/{} | {}{} | {} | {:.0f}%/{:.0f}% | {:.0f}%/{:.0f}%",
+            summary.mapName,
+            summary.mapId,
+            summary.instanceId,
+            summary.playerCount,
+            summary.maxPlayers,
+            summary.adjustedPlayerCount,
+            summary.combatLocked ? " (combat locked)" : "",
+            summary.mapLevel,
+            summary.creatureHealthPercent,
+            summary.creatureDamagePercent,
+            summary.bossHealthPercent,
+            summary.bossDamagePercent
+        );
+    }
+
+    // shows how often new instances start from the storage of unloaded ones instead of allocating it
+    AutoBalanceMapInfoPoolStats poolStats = GetMapInfoPoolStats();
+
+    handler->PSendSysMessage("Map info storage since startup: {} reused | {} allocated presized | {} allocated cold | {} kept | {} freed (pool full).",
+        poolStats.reused,
+        poolStats.reserved,
+        poolStats.cold,
+        poolStats.released,
+        poolStats.dropped
+    );
+
+    return true;
+}
+
+bool AutoBalance_CommandScript::HandleABTraceDumpCommand(ChatHandler* handler, const char* /*args*/)
+{
+    Player* player = handler->GetPlayer();
+
+    if (!player->GetMap()->IsDungeon())
+    {
+        handler->PSendSysMessage("The decision trace is only kept inside instances.");
+        return false;
+    }
+
+    if (!DecisionTraceEnable)
+    {
+        handler->PSendSysMessage("The decision trace is disabled. Set AutoBalance.Trace.Enable = 1 and reload the config.");
+        return false;
+    }
+
+    // copy first so the file is written without holding up the map
+    std::vector<AutoBalanceDecisionTraceEntry> entries = GetMapInfo(player->GetMap())->decisionTrace.Snapshot();
+
+    std::string logsDir = sConfigMgr->GetOption<std::string>("LogsDir", "");
+    if (!logsDir.empty() && logsDir.back() != '/' && logsDir.back() != '\\')
+        logsDir.push_back('/');
+
+    std::string fileName = logsDir + "autobalance_trace_" + std::to_string(player->GetMapId()) + "_" + std::to_string(player->GetInstanceId()) + ".csv";
+
+    if (!WriteDecisionTrace(entries, fileName))
+    {
+        handler->PSendSysMessage("Could not write the decision trace to {}.", fileName);
+        return false;
     }
-    handler->PSendSysMessage(ABGetLocaleText(locale, "cc_duration_multiplier").c_str(), targetABInfo->CCDurationMultiplier);
-    handler->PSendSysMessage(ABGetLocaleText(locale, "xp_money_multiplier").c_str(), targetABInfo->XPModifier, targetABInfo->MoneyModifier);
 
+    handler->PSendSysMessage("Wrote {} decisions to {}.", entries.size(), fileName);
     return true;
 }
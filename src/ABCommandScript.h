@@ -18,12 +18,21 @@ public:
 
     ChatCommandTable GetCommands() const override
     {
+        static ChatCommandTable ABTraceCommandTable =
+        {
+            { "dump",          HandleABTraceDumpCommand,      SEC_GAMEMASTER,  Console::No  }
+        };
+
         static ChatCommandTable ABCommandTable =
         {
             { "setoffset",     HandleABSetOffsetCommand,      SEC_GAMEMASTER,  Console::Yes },
             { "getoffset",     HandleABGetOffsetCommand,      SEC_PLAYER,      Console::Yes },
             { "mapstat",       HandleABMapStatsCommand,       SEC_PLAYER,      Console::Yes },
-            { "creaturestat",  HandleABCreatureStatsCommand,  SEC_PLAYER,      Console::Yes }
+            { "creaturestat",  HandleABCreatureStatsCommand,  SEC_PLAYER,      Console::Yes },
+            { "simulate",      HandleABSimulateCommand,       SEC_GAMEMASTER,  Console::Yes },
+            { "top",           HandleABTopCommand,            SEC_GAMEMASTER,  Console::Yes },
+            { "instances",     HandleABInstancesCommand,      SEC_GAMEMASTER,  Console::Yes },
+            { "trace",         ABTraceCommandTable }
         };
 
         static ChatCommandTable commandTable =
@@ -39,6 +48,10 @@ public:
     static bool HandleABGetOffsetCommand(ChatHandler* handler, const char* args);
     static bool HandleABMapStatsCommand(ChatHandler* handler, const char* args);
     static bool HandleABCreatureStatsCommand(ChatHandler* handler, const char* args);
+    static bool HandleABSimulateCommand(ChatHandler* handler, const char* args);
+    static bool HandleABTopCommand(ChatHandler* handler, const char* args);
+    static bool HandleABInstancesCommand(ChatHandler* handler, const char* args);
+    static bool HandleABTraceDumpCommand(ChatHandler* handler, const char* args);
 };
 
 #endif /* __AB_COMMAND_SCRIPT_H */
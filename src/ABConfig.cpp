@@ -22,6 +22,8 @@ std::map<uint32, AutoBalanceStatModifiers> statModifierBossOverrides;
 std::map<uint32, AutoBalanceStatModifiers> statModifierCreatureOverrides;
 std::map<uint8, AutoBalanceLevelScalingDynamicLevelSettings> levelScalingDynamicLevelOverrides;
 std::map<uint32, uint32> levelScalingDistanceCheckOverrides;
+std::map<uint32, AutoBalanceMapDescriptor> mapDescriptors;
+AutoBalancePrecomputeCache precomputeCache;
 
 // spell IDs that spend player health
 // player abilities don't actually appear to be caught by `ModifySpellDamageTaken`,
@@ -94,23 +96,37 @@ bool          LevelScalingEndGameBoost;
 bool          PlayerChangeNotify;
 bool          rewardEnabled;
 
-float         MinHPModifier;
-float         MinManaModifier;
-float         MinDamageModifier;
-float         MinCCDurationModifier;
-float         MaxCCDurationModifier;
+uint64_t      globalConfigTime = GetCurrentConfigTime();
 
 //
-// RewardScaling.*
+// Logging.*
 //
 
-ScalingMethod RewardScalingMethod;
-bool          RewardScalingXP;
-bool          RewardScalingMoney;
-float         RewardScalingXPModifier;
-float         RewardScalingMoneyModifier;
+uint32           DamageHealingDebugSampleRate;
+uint32           DamageHealingDebugMaxPerSecond;
+std::set<uint32> DamageHealingDebugSpellIds;
+std::set<uint32> DamageHealingDebugCreatureIds;
 
-uint64_t      globalConfigTime = GetCurrentConfigTime();
+//
+// Performance.*
+//
+
+bool          SpawnBurst;
+uint32        PlayerCountDebounceWindow;
+bool          PlayerCountDebounceImmediateIncrease;
+bool          CombatCaptureEnable;
+std::string   CombatCaptureFile;
+uint32        CombatCaptureMaxEvents;
+bool          PrecomputeCacheEnable;
+std::string   PrecomputeCacheFile;
+bool          DecisionTraceEnable;
+bool          EncounterTelemetryEnable;
+std::string   EncounterTelemetryFile;
+bool          MetricsEnable;
+std::string   MetricsFile;
+uint32        MetricsInterval;
+uint32        MetricsMaxInstances;
+bool          ProfilingEnable;
 
 //
 // Enable.*
@@ -130,306 +146,7 @@ bool          EnableOtherNormal;
 bool          EnableOtherHeroic;
 
 //
-// InflectionPoint*
-//
-
-float         InflectionPoint;
-float         InflectionPointCurveFloor;
-float         InflectionPointCurveCeiling;
-float         InflectionPointBoss;
-float         InflectionPointBossInflection;
-float         InflectionPointHealth;
-float         InflectionPointMana;
-float         InflectionPointArmor;
-float         InflectionPointDamage;
-float         InflectionPointBossHealth;
-float         InflectionPointBossMana;
-float         InflectionPointBossArmor;
-float         InflectionPointBossDamage;
-
-float         InflectionPointHeroic;
-float         InflectionPointHeroicCurveFloor;
-float         InflectionPointHeroicCurveCeiling;
-float         InflectionPointHeroicBoss;
-float         InflectionPointHeroicBossInflection;
-float         InflectionPointHeroicHealth;
-float         InflectionPointHeroicMana;
-float         InflectionPointHeroicArmor;
-float         InflectionPointHeroicDamage;
-float         InflectionPointHeroicBossHealth;
-float         InflectionPointHeroicBossMana;
-float         InflectionPointHeroicBossArmor;
-float         InflectionPointHeroicBossDamage;
-
-float         InflectionPointRaid;
-float         InflectionPointRaidCurveFloor;
-float         InflectionPointRaidCurveCeiling;
-float         InflectionPointRaidBoss;
-float         InflectionPointRaidBossInflection;
-float         InflectionPointRaidHealth;
-float         InflectionPointRaidMana;
-float         InflectionPointRaidArmor;
-float         InflectionPointRaidDamage;
-float         InflectionPointRaidBossHealth;
-float         InflectionPointRaidBossMana;
-float         InflectionPointRaidBossArmor;
-float         InflectionPointRaidBossDamage;
-
-float         InflectionPointRaidHeroic;
-float         InflectionPointRaidHeroicCurveFloor;
-float         InflectionPointRaidHeroicCurveCeiling;
-float         InflectionPointRaidHeroicBoss;
-float         InflectionPointRaidHeroicBossInflection;
-float         InflectionPointRaidHeroicHealth;
-float         InflectionPointRaidHeroicMana;
-float         InflectionPointRaidHeroicArmor;
-float         InflectionPointRaidHeroicDamage;
-float         InflectionPointRaidHeroicBossHealth;
-float         InflectionPointRaidHeroicBossMana;
-float         InflectionPointRaidHeroicBossArmor;
-float         InflectionPointRaidHeroicBossDamage;
-
-float         InflectionPointRaid10M;
-float         InflectionPointRaid10MCurveFloor;
-float         InflectionPointRaid10MCurveCeiling;
-float         InflectionPointRaid10MBoss;
-float         InflectionPointRaid10MBossInflection;
-float         InflectionPointRaid10MHealth;
-float         InflectionPointRaid10MMana;
-float         InflectionPointRaid10MArmor;
-float         InflectionPointRaid10MDamage;
-
-float         InflectionPointRaid10MHeroic;
-float         InflectionPointRaid10MHeroicCurveFloor;
-float         InflectionPointRaid10MHeroicCurveCeiling;
-float         InflectionPointRaid10MHeroicBoss;
-float         InflectionPointRaid10MHeroicBossInflection;
-float         InflectionPointRaid10MHeroicHealth;
-float         InflectionPointRaid10MHeroicMana;
-float         InflectionPointRaid10MHeroicArmor;
-float         InflectionPointRaid10MHeroicDamage;
-
-float         InflectionPointRaid15M;
-float         InflectionPointRaid15MCurveFloor;
-float         InflectionPointRaid15MCurveCeiling;
-float         InflectionPointRaid15MBoss;
-float         InflectionPointRaid15MBossInflection;
-float         InflectionPointRaid15MHealth;
-float         InflectionPointRaid15MMana;
-float         InflectionPointRaid15MArmor;
-float         InflectionPointRaid15MDamage;
-
-float         InflectionPointRaid20M;
-float         InflectionPointRaid20MCurveFloor;
-float         InflectionPointRaid20MCurveCeiling;
-float         InflectionPointRaid20MBoss;
-float         InflectionPointRaid20MBossInflection;
-float         InflectionPointRaid20MHealth;
-float         InflectionPointRaid20MMana;
-float         InflectionPointRaid20MArmor;
-float         InflectionPointRaid20MDamage;
-
-float         InflectionPointRaid25M;
-float         InflectionPointRaid25MCurveFloor;
-float         InflectionPointRaid25MCurveCeiling;
-float         InflectionPointRaid25MBoss;
-float         InflectionPointRaid25MBossInflection;
-float         InflectionPointRaid25MHealth;
-float         InflectionPointRaid25MMana;
-float         InflectionPointRaid25MArmor;
-float         InflectionPointRaid25MDamage;
-
-float         InflectionPointRaid25MHeroic;
-float         InflectionPointRaid25MHeroicCurveFloor;
-float         InflectionPointRaid25MHeroicCurveCeiling;
-float         InflectionPointRaid25MHeroicBoss;
-float         InflectionPointRaid25MHeroicBossInflection;
-float         InflectionPointRaid25MHeroicHealth;
-float         InflectionPointRaid25MHeroicMana;
-float         InflectionPointRaid25MHeroicArmor;
-float         InflectionPointRaid25MHeroicDamage;
-
-float         InflectionPointRaid40M;
-float         InflectionPointRaid40MCurveFloor;
-float         InflectionPointRaid40MCurveCeiling;
-float         InflectionPointRaid40MBoss;
-float         InflectionPointRaid40MHealth;
-float         InflectionPointRaid40MMana;
-float         InflectionPointRaid40MArmor;
-float         InflectionPointRaid40MDamage;
-float         InflectionPointRaid40MBossInflection;
-
-//
-// FormulaType* (Health and Damage formula selection)
-//
-
-FormulaType   FormulaTypeHealth;
-FormulaType   FormulaTypeMana;
-FormulaType   FormulaTypeArmor;
-FormulaType   FormulaTypeDamage;
-FormulaType   FormulaTypeBossHealth;
-FormulaType   FormulaTypeBossMana;
-FormulaType   FormulaTypeBossArmor;
-FormulaType   FormulaTypeBossDamage;
-
-//
-// StatModifier*
+// InflectionPoint*, StatModifier*, FormulaType*, Min/Max modifiers and RewardScaling.*
 //
 
-float         StatModifier_Global;
-float         StatModifier_Health;
-float         StatModifier_Mana;
-float         StatModifier_Armor;
-float         StatModifier_Damage;
-float         StatModifier_CCDuration;
-
-float         StatModifierHeroic_Global;
-float         StatModifierHeroic_Health;
-float         StatModifierHeroic_Mana;
-float         StatModifierHeroic_Armor;
-float         StatModifierHeroic_Damage;
-float         StatModifierHeroic_CCDuration;
-
-float         StatModifierRaid_Global;
-float         StatModifierRaid_Health;
-float         StatModifierRaid_Mana;
-float         StatModifierRaid_Armor;
-float         StatModifierRaid_Damage;
-float         StatModifierRaid_CCDuration;
-
-float         StatModifierRaidHeroic_Global;
-float         StatModifierRaidHeroic_Health;
-float         StatModifierRaidHeroic_Mana;
-float         StatModifierRaidHeroic_Armor;
-float         StatModifierRaidHeroic_Damage;
-float         StatModifierRaidHeroic_CCDuration;
-
-float         StatModifierRaid10M_Global;
-float         StatModifierRaid10M_Health;
-float         StatModifierRaid10M_Mana;
-float         StatModifierRaid10M_Armor;
-float         StatModifierRaid10M_Damage;
-float         StatModifierRaid10M_CCDuration;
-
-float         StatModifierRaid10MHeroic_Global;
-float         StatModifierRaid10MHeroic_Health;
-float         StatModifierRaid10MHeroic_Mana;
-float         StatModifierRaid10MHeroic_Armor;
-float         StatModifierRaid10MHeroic_Damage;
-float         StatModifierRaid10MHeroic_CCDuration;
-
-float         StatModifierRaid15M_Global;
-float         StatModifierRaid15M_Health;
-float         StatModifierRaid15M_Mana;
-float         StatModifierRaid15M_Armor;
-float         StatModifierRaid15M_Damage;
-float         StatModifierRaid15M_CCDuration;
-
-float         StatModifierRaid20M_Global;
-float         StatModifierRaid20M_Health;
-float         StatModifierRaid20M_Mana;
-float         StatModifierRaid20M_Armor;
-float         StatModifierRaid20M_Damage;
-float         StatModifierRaid20M_CCDuration;
-
-float         StatModifierRaid25M_Global;
-float         StatModifierRaid25M_Health;
-float         StatModifierRaid25M_Mana;
-float         StatModifierRaid25M_Armor;
-float         StatModifierRaid25M_Damage;
-float         StatModifierRaid25M_CCDuration;
-
-float         StatModifierRaid25MHeroic_Global;
-float         StatModifierRaid25MHeroic_Health;
-float         StatModifierRaid25MHeroic_Mana;
-float         StatModifierRaid25MHeroic_Armor;
-float         StatModifierRaid25MHeroic_Damage;
-float         StatModifierRaid25MHeroic_CCDuration;
-
-float         StatModifierRaid40M_Global;
-float         StatModifierRaid40M_Health;
-float         StatModifierRaid40M_Mana;
-float         StatModifierRaid40M_Armor;
-float         StatModifierRaid40M_Damage;
-float         StatModifierRaid40M_CCDuration;
-
-//
-// StatModifier* (Boss)
-//
-
-float         StatModifier_Boss_Global;
-float         StatModifier_Boss_Health;
-float         StatModifier_Boss_Mana;
-float         StatModifier_Boss_Armor;
-float         StatModifier_Boss_Damage;
-float         StatModifier_Boss_CCDuration;
-
-float         StatModifierHeroic_Boss_Global;
-float         StatModifierHeroic_Boss_Health;
-float         StatModifierHeroic_Boss_Mana;
-float         StatModifierHeroic_Boss_Armor;
-float         StatModifierHeroic_Boss_Damage;
-float         StatModifierHeroic_Boss_CCDuration;
-
-float         StatModifierRaid_Boss_Global;
-float         StatModifierRaid_Boss_Health;
-float         StatModifierRaid_Boss_Mana;
-float         StatModifierRaid_Boss_Armor;
-float         StatModifierRaid_Boss_Damage;
-float         StatModifierRaid_Boss_CCDuration;
-
-float         StatModifierRaidHeroic_Boss_Global;
-float         StatModifierRaidHeroic_Boss_Health;
-float         StatModifierRaidHeroic_Boss_Mana;
-float         StatModifierRaidHeroic_Boss_Armor;
-float         StatModifierRaidHeroic_Boss_Damage;
-float         StatModifierRaidHeroic_Boss_CCDuration;
-
-float         StatModifierRaid10M_Boss_Global;
-float         StatModifierRaid10M_Boss_Health;
-float         StatModifierRaid10M_Boss_Mana;
-float         StatModifierRaid10M_Boss_Armor;
-float         StatModifierRaid10M_Boss_Damage;
-float         StatModifierRaid10M_Boss_CCDuration;
-
-float         StatModifierRaid10MHeroic_Boss_Global;
-float         StatModifierRaid10MHeroic_Boss_Health;
-float         StatModifierRaid10MHeroic_Boss_Mana;
-float         StatModifierRaid10MHeroic_Boss_Armor;
-float         StatModifierRaid10MHeroic_Boss_Damage;
-float         StatModifierRaid10MHeroic_Boss_CCDuration;
-
-float         StatModifierRaid15M_Boss_Global;
-float         StatModifierRaid15M_Boss_Health;
-float         StatModifierRaid15M_Boss_Mana;
-float         StatModifierRaid15M_Boss_Armor;
-float         StatModifierRaid15M_Boss_Damage;
-float         StatModifierRaid15M_Boss_CCDuration;
-
-float         StatModifierRaid20M_Boss_Global;
-float         StatModifierRaid20M_Boss_Health;
-float         StatModifierRaid20M_Boss_Mana;
-float         StatModifierRaid20M_Boss_Armor;
-float         StatModifierRaid20M_Boss_Damage;
-float         StatModifierRaid20M_Boss_CCDuration;
-
-float         StatModifierRaid25M_Boss_Global;
-float         StatModifierRaid25M_Boss_Health;
-float         StatModifierRaid25M_Boss_Mana;
-float         StatModifierRaid25M_Boss_Armor;
-float         StatModifierRaid25M_Boss_Damage;
-float         StatModifierRaid25M_Boss_CCDuration;
-
-float         StatModifierRaid25MHeroic_Boss_Global;
-float         StatModifierRaid25MHeroic_Boss_Health;
-float         StatModifierRaid25MHeroic_Boss_Mana;
-float         StatModifierRaid25MHeroic_Boss_Armor;
-float         StatModifierRaid25MHeroic_Boss_Damage;
-float         StatModifierRaid25MHeroic_Boss_CCDuration;
-
-float         StatModifierRaid40M_Boss_Global;
-float         StatModifierRaid40M_Boss_Health;
-float         StatModifierRaid40M_Boss_Mana;
-float         StatModifierRaid40M_Boss_Armor;
-float         StatModifierRaid40M_Boss_Damage;
-float         StatModifierRaid40M_Boss_CCDuration;
+AutoBalanceScalingSettings ScalingSettings;
@@ -7,6 +7,9 @@
 
 #include "ABInflectionPointSettings.h"
 #include "ABLevelScalingDynamicLevelSettings.h"
+#include "ABMapDescriptor.h"
+#include "ABPrecomputeCache.h"
+#include "ABScalingSettings.h"
 #include "ABStatModifiers.h"
 #include "AutoBalance.h"
 
@@ -14,6 +17,8 @@
 
 #include <list>
 #include <map>
+#include <set>
+#include <string>
 
 extern std::map<uint32, AutoBalanceInflectionPointSettings>          dungeonOverrides;
 extern std::map<uint32, AutoBalanceInflectionPointSettings>          bossOverrides;
@@ -22,6 +27,8 @@ extern std::map<uint32, AutoBalanceStatModifiers>                    statModifie
 extern std::map<uint32, AutoBalanceStatModifiers>                    statModifierCreatureOverrides;
 extern std::map<uint8 , AutoBalanceLevelScalingDynamicLevelSettings> levelScalingDynamicLevelOverrides;
 extern std::map<uint32, uint32>                                      levelScalingDistanceCheckOverrides;
+extern std::map<uint32, AutoBalanceMapDescriptor>                    mapDescriptors;
+extern AutoBalancePrecomputeCache                                    precomputeCache;
 
 extern std::map <int, int>                                           forcedCreatureIds;
 extern std::list<uint32>                                             disabledDungeonIds;
@@ -64,23 +71,37 @@ extern bool                                                          LevelScalin
 extern bool                                                          PlayerChangeNotify;
 extern bool                                                          rewardEnabled;
 
-extern float                                                         MinHPModifier;
-extern float                                                         MinManaModifier;
-extern float                                                         MinDamageModifier;
-extern float                                                         MinCCDurationModifier;
-extern float                                                         MaxCCDurationModifier;
+extern uint64_t                                                      globalConfigTime;
 
-// 
-// RewardScaling.*
-// 
+//
+// Logging.*
+//
 
-extern ScalingMethod                                                 RewardScalingMethod;
-extern bool                                                          RewardScalingXP;
-extern bool                                                          RewardScalingMoney;
-extern float                                                         RewardScalingXPModifier;
-extern float                                                         RewardScalingMoneyModifier;
+extern uint32                                                        DamageHealingDebugSampleRate;
+extern uint32                                                        DamageHealingDebugMaxPerSecond;
+extern std::set<uint32>                                              DamageHealingDebugSpellIds;
+extern std::set<uint32>                                              DamageHealingDebugCreatureIds;
 
-extern uint64_t                                                      globalConfigTime;
+//
+// Performance.*
+//
+
+extern bool                                                          SpawnBurst;
+extern uint32                                                        PlayerCountDebounceWindow;
+extern bool                                                          PlayerCountDebounceImmediateIncrease;
+extern bool                                                          CombatCaptureEnable;
+extern std::string                                                   CombatCaptureFile;
+extern uint32                                                        CombatCaptureMaxEvents;
+extern bool                                                          PrecomputeCacheEnable;
+extern std::string                                                   PrecomputeCacheFile;
+extern bool                                                          DecisionTraceEnable;
+extern bool                                                          EncounterTelemetryEnable;
+extern std::string                                                   EncounterTelemetryFile;
+extern bool                                                          MetricsEnable;
+extern std::string                                                   MetricsFile;
+extern uint32                                                        MetricsInterval;
+extern uint32                                                        MetricsMaxInstances;
+extern bool                                                          ProfilingEnable;
 
 // 
 // Enable.*
@@ -100,308 +121,9 @@ extern bool                                                          EnableOther
 extern bool                                                          EnableOtherHeroic;
 
 //
-// InflectionPoint*
-//
-
-extern float                                                         InflectionPoint;
-extern float                                                         InflectionPointCurveFloor;
-extern float                                                         InflectionPointCurveCeiling;
-extern float                                                         InflectionPointBoss;
-extern float                                                         InflectionPointBossInflection;
-extern float                                                         InflectionPointHealth;
-extern float                                                         InflectionPointMana;
-extern float                                                         InflectionPointArmor;
-extern float                                                         InflectionPointDamage;
-extern float                                                         InflectionPointBossHealth;
-extern float                                                         InflectionPointBossMana;
-extern float                                                         InflectionPointBossArmor;
-extern float                                                         InflectionPointBossDamage;
-
-extern float                                                         InflectionPointHeroic;
-extern float                                                         InflectionPointHeroicCurveFloor;
-extern float                                                         InflectionPointHeroicCurveCeiling;
-extern float                                                         InflectionPointHeroicBoss;
-extern float                                                         InflectionPointHeroicBossInflection;
-extern float                                                         InflectionPointHeroicHealth;
-extern float                                                         InflectionPointHeroicMana;
-extern float                                                         InflectionPointHeroicArmor;
-extern float                                                         InflectionPointHeroicDamage;
-extern float                                                         InflectionPointHeroicBossHealth;
-extern float                                                         InflectionPointHeroicBossMana;
-extern float                                                         InflectionPointHeroicBossArmor;
-extern float                                                         InflectionPointHeroicBossDamage;
-
-extern float                                                         InflectionPointRaid;
-extern float                                                         InflectionPointRaidCurveFloor;
-extern float                                                         InflectionPointRaidCurveCeiling;
-extern float                                                         InflectionPointRaidBoss;
-extern float                                                         InflectionPointRaidBossInflection;
-extern float                                                         InflectionPointRaidHealth;
-extern float                                                         InflectionPointRaidMana;
-extern float                                                         InflectionPointRaidArmor;
-extern float                                                         InflectionPointRaidDamage;
-extern float                                                         InflectionPointRaidBossHealth;
-extern float                                                         InflectionPointRaidBossMana;
-extern float                                                         InflectionPointRaidBossArmor;
-extern float                                                         InflectionPointRaidBossDamage;
-
-extern float                                                         InflectionPointRaidHeroic;
-extern float                                                         InflectionPointRaidHeroicCurveFloor;
-extern float                                                         InflectionPointRaidHeroicCurveCeiling;
-extern float                                                         InflectionPointRaidHeroicBoss;
-extern float                                                         InflectionPointRaidHeroicBossInflection;
-extern float                                                         InflectionPointRaidHeroicHealth;
-extern float                                                         InflectionPointRaidHeroicMana;
-extern float                                                         InflectionPointRaidHeroicArmor;
-extern float                                                         InflectionPointRaidHeroicDamage;
-extern float                                                         InflectionPointRaidHeroicBossHealth;
-extern float                                                         InflectionPointRaidHeroicBossMana;
-extern float                                                         InflectionPointRaidHeroicBossArmor;
-extern float                                                         InflectionPointRaidHeroicBossDamage;
-
-extern float                                                         InflectionPointRaid10M;
-extern float                                                         InflectionPointRaid10MCurveFloor;
-extern float                                                         InflectionPointRaid10MCurveCeiling;
-extern float                                                         InflectionPointRaid10MBoss;
-extern float                                                         InflectionPointRaid10MBossInflection;
-extern float                                                         InflectionPointRaid10MHealth;
-extern float                                                         InflectionPointRaid10MMana;
-extern float                                                         InflectionPointRaid10MArmor;
-extern float                                                         InflectionPointRaid10MDamage;
-
-extern float                                                         InflectionPointRaid10MHeroic;
-extern float                                                         InflectionPointRaid10MHeroicCurveFloor;
-extern float                                                         InflectionPointRaid10MHeroicCurveCeiling;
-extern float                                                         InflectionPointRaid10MHeroicBoss;
-extern float                                                         InflectionPointRaid10MHeroicBossInflection;
-extern float                                                         InflectionPointRaid10MHeroicHealth;
-extern float                                                         InflectionPointRaid10MHeroicMana;
-extern float                                                         InflectionPointRaid10MHeroicArmor;
-extern float                                                         InflectionPointRaid10MHeroicDamage;
-
-extern float                                                         InflectionPointRaid15M;
-extern float                                                         InflectionPointRaid15MCurveFloor;
-extern float                                                         InflectionPointRaid15MCurveCeiling;
-extern float                                                         InflectionPointRaid15MBoss;
-extern float                                                         InflectionPointRaid15MBossInflection;
-extern float                                                         InflectionPointRaid15MHealth;
-extern float                                                         InflectionPointRaid15MMana;
-extern float                                                         InflectionPointRaid15MArmor;
-extern float                                                         InflectionPointRaid15MDamage;
-
-extern float                                                         InflectionPointRaid20M;
-extern float                                                         InflectionPointRaid20MCurveFloor;
-extern float                                                         InflectionPointRaid20MCurveCeiling;
-extern float                                                         InflectionPointRaid20MBoss;
-extern float                                                         InflectionPointRaid20MBossInflection;
-extern float                                                         InflectionPointRaid20MHealth;
-extern float                                                         InflectionPointRaid20MMana;
-extern float                                                         InflectionPointRaid20MArmor;
-extern float                                                         InflectionPointRaid20MDamage;
-
-extern float                                                         InflectionPointRaid25M;
-extern float                                                         InflectionPointRaid25MCurveFloor;
-extern float                                                         InflectionPointRaid25MCurveCeiling;
-extern float                                                         InflectionPointRaid25MBoss;
-extern float                                                         InflectionPointRaid25MBossInflection;
-extern float                                                         InflectionPointRaid25MHealth;
-extern float                                                         InflectionPointRaid25MMana;
-extern float                                                         InflectionPointRaid25MArmor;
-extern float                                                         InflectionPointRaid25MDamage;
-
-extern float                                                         InflectionPointRaid25MHeroic;
-extern float                                                         InflectionPointRaid25MHeroicCurveFloor;
-extern float                                                         InflectionPointRaid25MHeroicCurveCeiling;
-extern float                                                         InflectionPointRaid25MHeroicBoss;
-extern float                                                         InflectionPointRaid25MHeroicBossInflection;
-extern float                                                         InflectionPointRaid25MHeroicHealth;
-extern float                                                         InflectionPointRaid25MHeroicMana;
-extern float                                                         InflectionPointRaid25MHeroicArmor;
-extern float                                                         InflectionPointRaid25MHeroicDamage;
-
-extern float                                                         InflectionPointRaid40M;
-extern float                                                         InflectionPointRaid40MCurveFloor;
-extern float                                                         InflectionPointRaid40MCurveCeiling;
-extern float                                                         InflectionPointRaid40MBoss;
-extern float                                                         InflectionPointRaid40MBossInflection;
-extern float                                                         InflectionPointRaid40MHealth;
-extern float                                                         InflectionPointRaid40MMana;
-extern float                                                         InflectionPointRaid40MArmor;
-extern float                                                         InflectionPointRaid40MDamage;
-
-//
-// FormulaType* (Health and Damage formula selection)
-//
-
-extern FormulaType                                                    FormulaTypeHealth;
-extern FormulaType                                                    FormulaTypeMana;
-extern FormulaType                                                    FormulaTypeArmor;
-extern FormulaType                                                    FormulaTypeDamage;
-extern FormulaType                                                    FormulaTypeBossHealth;
-extern FormulaType                                                    FormulaTypeBossMana;
-extern FormulaType                                                    FormulaTypeBossArmor;
-extern FormulaType                                                    FormulaTypeBossDamage;
-
+// InflectionPoint*, StatModifier*, FormulaType*, Min/Max modifiers and RewardScaling.*
 //
-// StatModifier*
-//
-
-extern float                                                         StatModifier_Global;
-extern float                                                         StatModifier_Health;
-extern float                                                         StatModifier_Mana;
-extern float                                                         StatModifier_Armor;
-extern float                                                         StatModifier_Damage;
-extern float                                                         StatModifier_CCDuration;
-
-extern float                                                         StatModifierHeroic_Global;
-extern float                                                         StatModifierHeroic_Health;
-extern float                                                         StatModifierHeroic_Mana;
-extern float                                                         StatModifierHeroic_Armor;
-extern float                                                         StatModifierHeroic_Damage;
-extern float                                                         StatModifierHeroic_CCDuration;
-
-extern float                                                         StatModifierRaid_Global;
-extern float                                                         StatModifierRaid_Health;
-extern float                                                         StatModifierRaid_Mana;
-extern float                                                         StatModifierRaid_Armor;
-extern float                                                         StatModifierRaid_Damage;
-extern float                                                         StatModifierRaid_CCDuration;
-
-extern float                                                         StatModifierRaidHeroic_Global;
-extern float                                                         StatModifierRaidHeroic_Health;
-extern float                                                         StatModifierRaidHeroic_Mana;
-extern float                                                         StatModifierRaidHeroic_Armor;
-extern float                                                         StatModifierRaidHeroic_Damage;
-extern float                                                         StatModifierRaidHeroic_CCDuration;
-
-extern float                                                         StatModifierRaid10M_Global;
-extern float                                                         StatModifierRaid10M_Health;
-extern float                                                         StatModifierRaid10M_Mana;
-extern float                                                         StatModifierRaid10M_Armor;
-extern float                                                         StatModifierRaid10M_Damage;
-extern float                                                         StatModifierRaid10M_CCDuration;
-
-extern float                                                         StatModifierRaid10MHeroic_Global;
-extern float                                                         StatModifierRaid10MHeroic_Health;
-extern float                                                         StatModifierRaid10MHeroic_Mana;
-extern float                                                         StatModifierRaid10MHeroic_Armor;
-extern float                                                         StatModifierRaid10MHeroic_Damage;
-extern float                                                         StatModifierRaid10MHeroic_CCDuration;
-
-extern float                                                         StatModifierRaid15M_Global;
-extern float                                                         StatModifierRaid15M_Health;
-extern float                                                         StatModifierRaid15M_Mana;
-extern float                                                         StatModifierRaid15M_Armor;
-extern float                                                         StatModifierRaid15M_Damage;
-extern float                                                         StatModifierRaid15M_CCDuration;
-
-extern float                                                         StatModifierRaid20M_Global;
-extern float                                                         StatModifierRaid20M_Health;
-extern float                                                         StatModifierRaid20M_Mana;
-extern float                                                         StatModifierRaid20M_Armor;
-extern float                                                         StatModifierRaid20M_Damage;
-extern float                                                         StatModifierRaid20M_CCDuration;
-
-extern float                                                         StatModifierRaid25M_Global;
-extern float                                                         StatModifierRaid25M_Health;
-extern float                                                         StatModifierRaid25M_Mana;
-extern float                                                         StatModifierRaid25M_Armor;
-extern float                                                         StatModifierRaid25M_Damage;
-extern float                                                         StatModifierRaid25M_CCDuration;
-
-extern float                                                         StatModifierRaid25MHeroic_Global;
-extern float                                                         StatModifierRaid25MHeroic_Health;
-extern float                                                         StatModifierRaid25MHeroic_Mana;
-extern float                                                         StatModifierRaid25MHeroic_Armor;
-extern float                                                         StatModifierRaid25MHeroic_Damage;
-extern float                                                         StatModifierRaid25MHeroic_CCDuration;
-
-extern float                                                         StatModifierRaid40M_Global;
-extern float                                                         StatModifierRaid40M_Health;
-extern float                                                         StatModifierRaid40M_Mana;
-extern float                                                         StatModifierRaid40M_Armor;
-extern float                                                         StatModifierRaid40M_Damage;
-extern float                                                         StatModifierRaid40M_CCDuration;
-
-//
-// StatModifier* (Boss)
-//
-
-extern float                                                         StatModifier_Boss_Global;
-extern float                                                         StatModifier_Boss_Health;
-extern float                                                         StatModifier_Boss_Mana;
-extern float                                                         StatModifier_Boss_Armor;
-extern float                                                         StatModifier_Boss_Damage;
-extern float                                                         StatModifier_Boss_CCDuration;
-
-extern float                                                         StatModifierHeroic_Boss_Global;
-extern float                                                         StatModifierHeroic_Boss_Health;
-extern float                                                         StatModifierHeroic_Boss_Mana;
-extern float                                                         StatModifierHeroic_Boss_Armor;
-extern float                                                         StatModifierHeroic_Boss_Damage;
-extern float                                                         StatModifierHeroic_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid_Boss_Global;
-extern float                                                         StatModifierRaid_Boss_Health;
-extern float                                                         StatModifierRaid_Boss_Mana;
-extern float                                                         StatModifierRaid_Boss_Armor;
-extern float                                                         StatModifierRaid_Boss_Damage;
-extern float                                                         StatModifierRaid_Boss_CCDuration;
-
-extern float                                                         StatModifierRaidHeroic_Boss_Global;
-extern float                                                         StatModifierRaidHeroic_Boss_Health;
-extern float                                                         StatModifierRaidHeroic_Boss_Mana;
-extern float                                                         StatModifierRaidHeroic_Boss_Armor;
-extern float                                                         StatModifierRaidHeroic_Boss_Damage;
-extern float                                                         StatModifierRaidHeroic_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid10M_Boss_Global;
-extern float                                                         StatModifierRaid10M_Boss_Health;
-extern float                                                         StatModifierRaid10M_Boss_Mana;
-extern float                                                         StatModifierRaid10M_Boss_Armor;
-extern float                                                         StatModifierRaid10M_Boss_Damage;
-extern float                                                         StatModifierRaid10M_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid10MHeroic_Boss_Global;
-extern float                                                         StatModifierRaid10MHeroic_Boss_Health;
-extern float                                                         StatModifierRaid10MHeroic_Boss_Mana;
-extern float                                                         StatModifierRaid10MHeroic_Boss_Armor;
-extern float                                                         StatModifierRaid10MHeroic_Boss_Damage;
-extern float                                                         StatModifierRaid10MHeroic_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid15M_Boss_Global;
-extern float                                                         StatModifierRaid15M_Boss_Health;
-extern float                                                         StatModifierRaid15M_Boss_Mana;
-extern float                                                         StatModifierRaid15M_Boss_Armor;
-extern float                                                         StatModifierRaid15M_Boss_Damage;
-extern float                                                         StatModifierRaid15M_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid40M_Boss_Damage;
-extern float                                                         StatModifierRaid20M_Boss_Global;
-extern float                                                         StatModifierRaid20M_Boss_Health;
-extern float                                                         StatModifierRaid20M_Boss_Mana;
-extern float                                                         StatModifierRaid20M_Boss_Armor;
-extern float                                                         StatModifierRaid20M_Boss_Damage;
-extern float                                                         StatModifierRaid20M_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid25M_Boss_Global;
-extern float                                                         StatModifierRaid25M_Boss_Health;
-extern float                                                         StatModifierRaid25M_Boss_Mana;
-extern float                                                         StatModifierRaid25M_Boss_Armor;
-extern float                                                         StatModifierRaid25M_Boss_Damage;
-extern float                                                         StatModifierRaid25M_Boss_CCDuration;
-
-extern float                                                         StatModifierRaid25MHeroic_Boss_Global;
-extern float                                                         StatModifierRaid25MHeroic_Boss_Health;
-extern float                                                         StatModifierRaid25MHeroic_Boss_Mana;
-extern float                                                         StatModifierRaid25MHeroic_Boss_Armor;
-extern float                                                         StatModifierRaid25MHeroic_Boss_Damage;
-extern float                                                         StatModifierRaid25MHeroic_Boss_CCDuration;
 
-extern float                                                         StatModifierRaid40M_Boss_Global;
-extern float                                                         StatModifierRaid40M_Boss_Health;
-extern float                                                         StatModifierRaid40M_Boss_Mana;
-extern float                                                         StatModifierRaid40M_Boss_Armor;
-extern float                                                         StatModifierRaid40M_Boss_CCDuration;
+extern AutoBalanceScalingSettings                                    ScalingSettings;
 
 #endif
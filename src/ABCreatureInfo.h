@@ -5,11 +5,33 @@
 #ifndef __AB_CREATURE_INFO_H
 #define __AB_CREATURE_INFO_H
 
+#include "ABStatModifiers.h"
 #include "AutoBalance.h"
 
 #include "Creature.h"
 #include "DataMap.h"
 
+#include <algorithm>
+#include <array>
+
+//
+// What the config and the creature's summon context say about a creature, resolved once when it spawns
+// Read this instead of searching the config lists and walking the summoner on every check
+//
+struct AutoBalanceCreaturePolicy
+{
+    uint32      entry                  = 0;       // The entry the policy was resolved for (0 until resolved)
+    uint64_t    globalConfigTime       = 0;       // The config the policy was resolved with
+    int32       forcedNumPlayers       = -1;      // AutoBalance.ForcedID*/DisabledID value for the entry, -1 if not listed
+    bool        hasStatOverride        = false;   // Whether AutoBalance.StatModifier.PerCreature lists the entry
+    AutoBalanceStatModifiers statOverride;        // The entry's per-creature stat modifiers (-1 for those not set)
+    bool        isBoss                 = false;   // Whether the creature is a boss or was summoned by one
+    bool        isNeverClone           = false;   // Whether the entry is in creatureIDsThatAreNotClones
+    bool        isCritter              = false;
+    bool        isTotem                = false;
+    bool        isTrigger              = false;
+};
+
 class AutoBalanceCreatureInfo : public DataMap::Base
 {
 public:
@@ -42,6 +64,10 @@ public:
     bool        isActive               = false;   // Whether or not the current creature is affecting map stats. May change as conditions change.
     bool        wasAliveNowDead        = false;   // Whether or not the creature was alive and is now dead
     bool        isInCreatureList       = false;   // Whether or not the creature is in the map's creature list
+    bool        isInScalableList       = false;   // Whether or not the creature is in the map's scalable creature list
+    bool        isInUpdateQueue        = false;   // Whether or not the creature is waiting in the map's update queue
+    bool        isInSpawnBurst         = false;   // Whether or not the creature is waiting to be scaled with the rest of its map's spawn burst
+    uint32      modifyCount            = 0;       // The number of times this creature has been modified
     bool        isBrandNew             = false;   // Whether or not the creature is brand new to the map (hasn't been added to the world yet)
     bool        neverLevelScale        = false;   // Whether or not the creature should never be level scaled (can still be player scaled)
 
@@ -54,7 +80,91 @@ public:
     bool        isCloneOfSummoner      = false;   // Whether or not the creature is a clone of its summoner
 
     Relevance   relevance              = AUTOBALANCE_RELEVANCE_UNCHECKED; // Whether or not the creature is relevant for scaling
+
+    AutoBalanceCreaturePolicy policy;             // Use GetCreaturePolicy(), which resolves it when needed
+};
+
+#define AUTOBALANCE_CREATURE_STAT_MEMO_SIZE 3 // sets of final stats remembered per creature
+
+//
+// The final stats of a creature for one set of scaling inputs
+//
+struct AutoBalanceCreatureStats
+{
+    // inputs
+    uint32      entry                  = 0;       // The creature's entry when the stats were calculated
+    uint32      mapAdjustedPlayerCount = 0;       // The map's adjusted player count, which the curve multipliers are calculated from
+    uint32      instancePlayerCount    = 0;       // The player count the stats were calculated for (after AutoBalance.ForcedID*)
+    bool        isBoss                 = false;   // Whether the boss curves and stat modifiers were used
+    uint8       unmodifiedLevel        = 0;       // The creature's level before any level scaling
+    uint8       selectedLevel          = 0;       // The level the stats were calculated for
+    uint8       highestPlayerLevel     = 0;       // The map's highest player level (used to smooth level scaled base stats)
+    float       defaultMultiplier      = 1.0f;    // The default multiplier as returned by the OnAfterDefaultMultiplier hooks
+    uint64_t    globalConfigTime       = 0;       // The config the stats were calculated with
+    uint64_t    mapGlobalConfigTime    = 0;       // The config the map's settings were last loaded with
+
+    // outputs
+    uint32      health                 = 0;
+    uint32      mana                   = 0;
+    uint32      armor                  = 0;
+    float       HealthMultiplier       = 1.0f;
+    float       ScaledHealthMultiplier = 1.0f;
+    float       ManaMultiplier         = 1.0f;
+    float       ScaledManaMultiplier   = 1.0f;
+    float       ArmorMultiplier        = 1.0f;
+    float       ScaledArmorMultiplier  = 1.0f;
+    float       DamageMultiplier       = 1.0f;
+    float       ScaledDamageMultiplier = 1.0f;
+    float       CCDurationMultiplier   = 1.0f;
+    float       XPModifier             = 1.0f;
+    float       MoneyModifier          = 1.0f;
+
+    bool HasSameInputs(AutoBalanceCreatureStats const& other) const
+    {
+        return entry == other.entry && mapAdjustedPlayerCount == other.mapAdjustedPlayerCount && instancePlayerCount == other.instancePlayerCount &&
+            isBoss == other.isBoss && unmodifiedLevel == other.unmodifiedLevel && selectedLevel == other.selectedLevel &&
+            highestPlayerLevel == other.highestPlayerLevel && defaultMultiplier == other.defaultMultiplier &&
+            globalConfigTime == other.globalConfigTime && mapGlobalConfigTime == other.mapGlobalConfigTime;
+    }
 };
 
+//
+// The most recently applied stats of a creature, most recent first
+// Stored apart from AutoBalanceCreatureInfo so that it survives the creature being reset
+//
+class AutoBalanceCreatureStatMemo : public DataMap::Base
+{
+public:
+    AutoBalanceCreatureStatMemo() {}
+
+    // returns the entry calculated from the same inputs as `inputs` (and makes it the most recent), or nullptr
+    AutoBalanceCreatureStats const* Find(AutoBalanceCreatureStats const& inputs)
+    {
+        for (uint8 i = 0; i < _count; ++i)
+        {
+            if (_entries[i].HasSameInputs(inputs))
+            {
+                std::rotate(_entries.begin(), _entries.begin() + i, _entries.begin() + i + 1);
+                return &_entries[0];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // adds the stats as the most recent entry, dropping the least recent one when full
+    void Store(AutoBalanceCreatureStats const& stats)
+    {
+        if (_count < AUTOBALANCE_CREATURE_STAT_MEMO_SIZE)
+            ++_count;
+
+        std::rotate(_entries.begin(), _entries.begin() + _count - 1, _entries.begin() + _count);
+        _entries[0] = stats;
+    }
+
+private:
+    std::array<AutoBalanceCreatureStats, AUTOBALANCE_CREATURE_STAT_MEMO_SIZE> _entries;
+    uint8                                                                   _count = 0;
+};
 
 #endif
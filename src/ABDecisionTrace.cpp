@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABDecisionTrace.h"
+
+#include "ABCombatDecision.h"
+
+#include <algorithm>
+#include <fstream>
+
+static_assert((AUTOBALANCE_DECISION_TRACE_SIZE & (AUTOBALANCE_DECISION_TRACE_SIZE - 1)) == 0, "AUTOBALANCE_DECISION_TRACE_SIZE must be a power of two");
+
+void AutoBalanceDecisionTrace::Record(AutoBalanceDecisionTraceEntry const& entry)
+{
+    if (_entries.empty())
+        _entries.resize(AUTOBALANCE_DECISION_TRACE_SIZE);
+
+    uint32 writeCount = _writeCount.load(std::memory_order_relaxed);
+    _entries[writeCount & (AUTOBALANCE_DECISION_TRACE_SIZE - 1)] = entry;
+    _writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+std::vector<AutoBalanceDecisionTraceEntry> AutoBalanceDecisionTrace::Snapshot() const
+{
+    std::vector<AutoBalanceDecisionTraceEntry> snapshot;
+
+    // the ring is only allocated once something was recorded
+    uint32 writeCount = _writeCount.load(std::memory_order_acquire);
+    if (!writeCount)
+        return snapshot;
+
+    uint32 count = std::min<uint32>(writeCount, AUTOBALANCE_DECISION_TRACE_SIZE);
+    snapshot.reserve(count);
+
+    // the map keeps recording while we copy, so the oldest entries may already be newer than the rest
+    for (uint32 i = writeCount - count; i != writeCount; ++i)
+        snapshot.push_back(_entries[i & (AUTOBALANCE_DECISION_TRACE_SIZE - 1)]);
+
+    return snapshot;
+}
+
+char const* GetDecisionTraceReasonName(uint8 reason)
+{
+    return getDecisionTraceReasonName(reason);
+}
+
+bool WriteDecisionTrace(std::vector<AutoBalanceDecisionTraceEntry> const& entries, std::string const& fileName)
+{
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    file << "timestamp,reason,spell_id,source_entry,target_entry,amount_in,amount_out,multiplier\n";
+
+    for (AutoBalanceDecisionTraceEntry const& entry : entries)
+    {
+        file << entry.timestamp << ','
+             << GetDecisionTraceReasonName(entry.reason) << ','
+             << entry.spellId << ','
+             << entry.sourceEntry << ','
+             << entry.targetEntry << ','
+             << entry.amountIn << ','
+             << entry.amountOut << ','
+             << entry.multiplier << '\n';
+    }
+
+    return file.good();
+}
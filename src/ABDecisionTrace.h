@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_DECISION_TRACE_H
+#define __AB_DECISION_TRACE_H
+
+#include "AutoBalance.h"
+
+#include "Define.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#define AUTOBALANCE_DECISION_TRACE_SIZE 1024 // entries kept per instance, must be a power of two
+
+struct AutoBalanceDecisionTraceEntry
+{
+    uint32 timestamp            = 0;     // getMSTime() when the decision was made
+    uint32 spellId              = 0;     // The spell being modified (0 for melee)
+    uint32 sourceEntry          = 0;     // The source's creature entry (0 for players)
+    uint32 targetEntry          = 0;     // The target's creature entry (0 for players)
+    int32  amountIn             = 0;     // The amount (or aura duration) before AutoBalance
+    int32  amountOut            = 0;     // The amount (or aura duration) after AutoBalance
+    float  multiplier           = 1.0f;  // The multiplier that was applied
+    uint8  reason               = 0;     // Decision_Trace_Reason
+    uint8  padding[3]           = {};
+};
+
+//
+// Fixed-size ring of the most recent damage, healing and CC decisions made in an instance
+// Only the map's own update thread records, so a write is a handful of stores and an index bump
+//
+class AutoBalanceDecisionTrace
+{
+public:
+    AutoBalanceDecisionTrace() {}
+
+    void Record(AutoBalanceDecisionTraceEntry const& entry);
+
+    // copies the recorded entries, oldest first
+    std::vector<AutoBalanceDecisionTraceEntry> Snapshot() const;
+
+private:
+    std::vector<AutoBalanceDecisionTraceEntry> _entries;         // Allocated on the first record
+    std::atomic<uint32>                        _writeCount = 0;  // The number of entries ever recorded
+};
+
+char const* GetDecisionTraceReasonName(uint8 reason);
+bool WriteDecisionTrace(std::vector<AutoBalanceDecisionTraceEntry> const& entries, std::string const& fileName);
+
+#endif
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABEncounterTelemetry.h"
+
+#include "ABConfig.h"
+#include "ABMapInfo.h"
+#include "ABUtils.h"
+
+#include "Log.h"
+#include "Player.h"
+#include "Timer.h"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <thread>
+
+static_assert((AUTOBALANCE_TELEMETRY_QUEUE_SIZE & (AUTOBALANCE_TELEMETRY_QUEUE_SIZE - 1)) == 0, "AUTOBALANCE_TELEMETRY_QUEUE_SIZE must be a power of two");
+
+static char const* encounterTelemetryEventNames[AUTOBALANCE_TELEMETRY_EVENT_COUNT] =
+{
+    "combat_start",
+    "combat_end",
+    "encounter"
+};
+
+//
+// Bounded multi-producer ring; each cell's sequence says whether it is free for the producer at that
+// position or holds a record for the consumer at that position
+//
+struct AutoBalanceEncounterQueueCell
+{
+    std::atomic<size_t>        sequence { 0 };
+    AutoBalanceEncounterRecord record;
+};
+
+static std::unique_ptr<AutoBalanceEncounterQueueCell[]> telemetryQueue;            // Allocated the first time telemetry is enabled, never resized
+static std::atomic<size_t>                              telemetryEnqueuePosition  { 0 };
+static size_t                                           telemetryDequeuePosition  = 0;   // Only used by the writer thread
+static std::atomic<bool>                                telemetryActive           { false };
+static std::atomic<uint64>                              telemetryDropped          { 0 };
+static std::atomic<uint64>                              telemetryWritten          { 0 };
+
+static std::thread                                      telemetryThread;
+static std::atomic<bool>                                telemetryThreadRunning    { false };
+static std::string                                      telemetryFileName;
+
+static bool _PushEncounterRecord(AutoBalanceEncounterRecord const& record)
+{
+    size_t position = telemetryEnqueuePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        AutoBalanceEncounterQueueCell& cell = telemetryQueue[position & (AUTOBALANCE_TELEMETRY_QUEUE_SIZE - 1)];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0)
+        {
+            // the cell is free, claim it
+            if (telemetryEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell.record = record;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the writer hasn't caught up with this cell yet, the queue is full
+            return false;
+        }
+        else
+        {
+            // another map thread claimed this position first
+            position = telemetryEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+static bool _PopEncounterRecord(AutoBalanceEncounterRecord& record)
+{
+    AutoBalanceEncounterQueueCell& cell = telemetryQueue[telemetryDequeuePosition & (AUTOBALANCE_TELEMETRY_QUEUE_SIZE - 1)];
+
+    if (cell.sequence.load(std::memory_order_acquire) != telemetryDequeuePosition + 1)
+        return false;
+
+    record = cell.record;
+    cell.sequence.store(telemetryDequeuePosition + AUTOBALANCE_TELEMETRY_QUEUE_SIZE, std::memory_order_release);
+    ++telemetryDequeuePosition;
+
+    return true;
+}
+
+static void _WriteEncounterRecords(std::ofstream& file)
+{
+    AutoBalanceEncounterRecord record;
+    uint32 count = 0;
+
+    while (_PopEncounterRecord(record))
+    {
+        file << record.time << ','
+             << encounterTelemetryEventNames[record.event] << ','
+             << record.mapId << ','
+             << record.instanceId << ','
+             << (uint32)record.difficulty << ','
+             << (uint32)record.playerCount << ','
+             << (uint32)record.adjustedPlayerCount << ','
+             << (uint32)record.mapLevel << ','
+             << (uint32)record.alivePlayers << ','
+             << record.combatTime << ','
+             << (uint32)record.combatEncounters << ','
+             << record.creditEntry << ','
+             << (uint32)record.dungeonCompleted << ','
+             << record.creatureHealthPercent << ','
+             << record.creatureDamagePercent << ','
+             << record.bossHealthPercent << ','
+             << record.bossDamagePercent << '\n';
+
+        ++count;
+    }
+
+    if (!count)
+        return;
+
+    file.flush();
+    telemetryWritten.fetch_add(count, std::memory_order_relaxed);
+}
+
+static void _EncounterTelemetryWriter(std::string fileName)
+{
+    // append so a restart or config reload doesn't lose earlier encounters
+    std::ofstream file(fileName, std::ios::out | std::ios::app);
+    if (!file.is_open())
+    {
+        LOG_ERROR("module.AutoBalance", "AutoBalance::EncounterTelemetryWriter: Could not open telemetry file `{}`. Queued records will be dropped.", fileName);
+        telemetryActive = false;
+        return;
+    }
+
+    if (file.tellp() == 0)
+        file << "time,event,map,instance,difficulty,players,adjusted_players,map_level,alive_players,combat_ms,combat_encounters,credit_entry,dungeon_completed,creature_health_pct,creature_damage_pct,boss_health_pct,boss_damage_pct\n";
+
+    uint64 reportedDropped = telemetryDropped.load(std::memory_order_relaxed);
+
+    while (telemetryThreadRunning.load(std::memory_order_acquire))
+    {
+        _WriteEncounterRecords(file);
+
+        uint64 dropped = telemetryDropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped)
+        {
+            LOG_WARN("module.AutoBalance", "AutoBalance::EncounterTelemetryWriter: The telemetry queue was full, {} records dropped ({} total).", dropped - reportedDropped, dropped);
+            reportedDropped = dropped;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(AUTOBALANCE_TELEMETRY_WRITE_INTERVAL));
+    }
+
+    // write whatever was queued before we were stopped
+    _WriteEncounterRecords(file);
+}
+
+static void _StopEncounterTelemetry()
+{
+    telemetryActive = false;
+
+    if (!telemetryThread.joinable())
+        return;
+
+    telemetryThreadRunning.store(false, std::memory_order_release);
+    telemetryThread.join();
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::CloseEncounterTelemetry: Closed telemetry file `{}` after {} records ({} dropped).",
+        telemetryFileName,
+        telemetryWritten.load(std::memory_order_relaxed),
+        telemetryDropped.load(std::memory_order_relaxed)
+    );
+}
+
+void OpenEncounterTelemetry()
+{
+    // keep the current writer if nothing changed on a config reload
+    if (EncounterTelemetryEnable && telemetryActive && telemetryFileName == EncounterTelemetryFile)
+        return;
+
+    _StopEncounterTelemetry();
+
+    if (!EncounterTelemetryEnable)
+        return;
+
+    if (!telemetryQueue)
+    {
+        telemetryQueue = std::make_unique<AutoBalanceEncounterQueueCell[]>(AUTOBALANCE_TELEMETRY_QUEUE_SIZE);
+
+        for (size_t i = 0; i < AUTOBALANCE_TELEMETRY_QUEUE_SIZE; ++i)
+            telemetryQueue[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    telemetryFileName = EncounterTelemetryFile;
+    telemetryWritten  = 0;
+    telemetryDropped  = 0;
+
+    // the writer turns this back off if it can't open the file
+    telemetryActive = true;
+
+    telemetryThreadRunning.store(true, std::memory_order_release);
+    telemetryThread = std::thread(_EncounterTelemetryWriter, telemetryFileName);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::OpenEncounterTelemetry: Writing encounter telemetry to `{}`.", telemetryFileName);
+}
+
+void CloseEncounterTelemetry()
+{
+    _StopEncounterTelemetry();
+}
+
+void RecordEncounterTelemetry(Map* map, Encounter_Telemetry_Event event, uint32 creditEntry, bool dungeonCompleted)
+{
+    // acquire so the queue allocated by OpenEncounterTelemetry is visible
+    if (!telemetryActive.load(std::memory_order_acquire))
+        return;
+
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+    if (!mapABInfo->enabled)
+        return;
+
+    AutoBalanceEncounterRecord record;
+    record.time                = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    record.mapId               = map->GetId();
+    record.instanceId          = map->GetInstanceId();
+    record.creditEntry         = creditEntry;
+    record.combatTime          = mapABInfo->combatLocked ? getMSTimeDiff(mapABInfo->combatLockStartTime, getMSTime()) : 0;
+    record.event               = event;
+    record.difficulty          = map->GetDifficulty();
+    record.playerCount         = mapABInfo->playerCount;
+    record.adjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+    record.mapLevel            = mapABInfo->mapLevel;
+    record.combatEncounters    = mapABInfo->combatLockEncounters;
+    record.dungeonCompleted    = dungeonCompleted;
+
+    for (Player* player : mapABInfo->allMapPlayers)
+        if (player && !player->IsGameMaster() && player->IsAlive())
+            ++record.alivePlayers;
+
+    StatMultiplierDisplay const& creatureStats = GetMapDisplayMultipliers(map, false);
+    StatMultiplierDisplay const& bossStats     = GetMapDisplayMultipliers(map, true);
+    record.creatureHealthPercent = creatureStats.healthPercent;
+    record.creatureDamagePercent = creatureStats.damagePercent;
+    record.bossHealthPercent     = bossStats.healthPercent;
+    record.bossDamagePercent     = bossStats.damagePercent;
+
+    if (!_PushEncounterRecord(record))
+        telemetryDropped.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_ENCOUNTER_TELEMETRY_H
+#define __AB_ENCOUNTER_TELEMETRY_H
+
+#include "AutoBalance.h"
+
+#include "Define.h"
+#include "Map.h"
+
+#define AUTOBALANCE_TELEMETRY_QUEUE_SIZE     4096 // records waiting for the writer, must be a power of two
+#define AUTOBALANCE_TELEMETRY_WRITE_INTERVAL 250  // milliseconds between the writer's passes over the queue
+
+//
+// One encounter outcome or combat lock transition, with the instance's scaling at the time
+//
+struct AutoBalanceEncounterRecord
+{
+    uint64 time                  = 0;     // Milliseconds since the Unix epoch
+    uint32 mapId                 = 0;
+    uint32 instanceId            = 0;
+    uint32 creditEntry           = 0;     // The credited creature or spell (encounter events only)
+    uint32 combatTime            = 0;     // Milliseconds since the current combat lock started (0 if not locked)
+    float  creatureHealthPercent = 100.0f;
+    float  creatureDamagePercent = 100.0f;
+    float  bossHealthPercent     = 100.0f;
+    float  bossDamagePercent     = 100.0f;
+    uint8  event                 = 0;     // Encounter_Telemetry_Event
+    uint8  difficulty            = 0;
+    uint8  playerCount           = 0;     // Non-GM players in the instance
+    uint8  adjustedPlayerCount   = 0;     // The player count the instance is scaled to
+    uint8  alivePlayers          = 0;     // Non-GM players still alive; 0 at the end of combat is a wipe
+    uint8  mapLevel              = 0;
+    uint8  combatEncounters      = 0;     // Encounters credited during the current combat lock
+    uint8  dungeonCompleted      = 0;     // Whether the credit completed the dungeon
+};
+
+//
+// Encounter records are queued by the map threads and appended to a CSV file by a background writer
+// The queue is a fixed-size lock-free ring: a map thread never waits on the writer or the file, and
+// a record that doesn't fit is dropped and counted instead
+//
+
+// start, restart or stop the writer to match the config; called from the world thread
+void OpenEncounterTelemetry();
+// stop the writer after it has written everything queued
+void CloseEncounterTelemetry();
+// queue a record of the instance's current state; called from the map's own update
+void RecordEncounterTelemetry(Map* map, Encounter_Telemetry_Event event, uint32 creditEntry = 0, bool dungeonCompleted = false);
+
+#endif
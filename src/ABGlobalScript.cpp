@@ -1,15 +1,29 @@
 #include "ABGlobalScript.h"
 
 #include "ABConfig.h"
+#include "ABEncounterTelemetry.h"
 #include "ABMapInfo.h"
 #include "ABUtils.h"
 
-void AutoBalance_GlobalScript::OnAfterUpdateEncounterState(Map* map, EncounterCreditType type, uint32 /*creditEntry*/, Unit* /*source*/, Difficulty /*difficulty_fixed*/, DungeonEncounterList const* /*encounters*/, uint32 /*dungeonCompleted*/, bool updated)
+void AutoBalance_GlobalScript::OnAfterUpdateEncounterState(Map* map, EncounterCreditType type, uint32 creditEntry, Unit* /*source*/, Difficulty /*difficulty_fixed*/, DungeonEncounterList const* /*encounters*/, uint32 dungeonCompleted, bool updated)
 {
     //if (!dungeonCompleted)
     //    return;
 
-    if (!rewardEnabled || !updated)
+    if (!updated)
+        return;
+
+    if (map->IsDungeon() && map->GetInstanceId())
+    {
+        AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+        if (mapABInfo->combatLocked && mapABInfo->combatLockEncounters < 255)
+            mapABInfo->combatLockEncounters++;
+
+        RecordEncounterTelemetry(map, AUTOBALANCE_TELEMETRY_ENCOUNTER, creditEntry, dungeonCompleted);
+    }
+
+    if (!rewardEnabled)
         return;
 
     AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
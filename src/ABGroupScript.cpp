@@ -0,0 +1,144 @@
+#include "ABGroupScript.h"
+
+#include "ABConfig.h"
+#include "ABMapInfo.h"
+#include "ABUtils.h"
+
+#include "Log.h"
+#include "Map.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+
+#include <algorithm>
+#include <vector>
+
+void AutoBalance_GroupScript::OnAddMember(Group* group, ObjectGuid /*guid*/)
+{
+    _Update_Group_Size(group);
+}
+
+void AutoBalance_GroupScript::OnRemoveMember(Group* group, ObjectGuid guid, RemoveMethod /*method*/, ObjectGuid /*kicker*/, const char* /*reason*/)
+{
+    _Update_Group_Size(group, guid);
+}
+
+void AutoBalance_GroupScript::OnDisband(Group* group)
+{
+    if (!EnableGlobal || !UseGroupSizeForDifficulty || !group)
+        return;
+
+    // the members are still in the group here; fall back to the in-map player count for any map that followed it
+    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+    {
+        Player* member = itr->GetSource();
+        if (!member || !member->IsInWorld())
+            continue;
+
+        Map* map = member->GetMap();
+        if (!map || !map->IsDungeon() || !map->GetInstanceId())
+            continue;
+
+        AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+        if (mapABInfo->groupGuid != group->GetGUID())
+            continue;
+
+        uint8 oldAdjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+
+        mapABInfo->groupGuid.Clear();
+        mapABInfo->groupSize = 0;
+
+        UpdateMapPlayerStats(map);
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_GroupScript::OnDisband: Map {} ({}{}) | Group disbanded, adjustedPlayerCount ({}->{}).",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            oldAdjustedPlayerCount,
+            mapABInfo->adjustedPlayerCount);
+
+        // only mark the map out of date when falling back to the in-map count changed the difficulty
+        if (mapABInfo->adjustedPlayerCount != oldAdjustedPlayerCount)
+            mapABInfo->mapConfigTime = 1;
+    }
+}
+
+void AutoBalance_GroupScript::_Update_Group_Size(Group* group, ObjectGuid leavingMember)
+{
+    if (!EnableGlobal || !UseGroupSizeForDifficulty || !group)
+        return;
+
+    //
+    // Group changes are handled on the world thread between map updates,
+    // so the maps of the online members can be updated directly
+    //
+
+    std::vector<Map*> updatedMaps;
+
+    auto addMemberMap = [&updatedMaps](Player* member)
+    {
+        if (!member || !member->IsInWorld())
+            return;
+
+        Map* map = member->GetMap();
+        if (!map || !map->IsDungeon() || !map->GetInstanceId())
+            return;
+
+        // several members usually share a map
+        if (std::find(updatedMaps.begin(), updatedMaps.end(), map) == updatedMaps.end())
+            updatedMaps.push_back(map);
+    };
+
+    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+        addMemberMap(itr->GetSource());
+
+    // the leaving member may already be gone from the member list
+    Player* leavingPlayer = leavingMember ? ObjectAccessor::FindConnectedPlayer(leavingMember) : nullptr;
+    addMemberMap(leavingPlayer);
+
+    for (Map* map : updatedMaps)
+    {
+        AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+        if (!mapABInfo->enabled)
+            continue;
+
+        uint8      oldGroupSize = mapABInfo->groupSize;
+        ObjectGuid oldGroupGuid = mapABInfo->groupGuid;
+
+        if (!mapABInfo->groupGuid)
+        {
+            // a player in the map formed or joined a group; the count already includes the new member
+            TrackMapGroup(map);
+        }
+        else if (mapABInfo->groupGuid == group->GetGUID())
+        {
+            // the leaving member may have been the map's last player in the group, pick the map's group again
+            if (leavingPlayer && leavingPlayer->GetMap() == map)
+                TrackMapGroup(map, leavingMember);
+            else
+                mapABInfo->groupSize = GetGroupSizeForDifficulty(group, leavingMember);
+        }
+
+        //
+        // Only mark the map out of date when the difficulty input actually changed
+        //
+
+        if (mapABInfo->groupSize == oldGroupSize && mapABInfo->groupGuid == oldGroupGuid)
+            continue;
+
+        uint8 oldAdjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+
+        UpdateMapPlayerStats(map);
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_GroupScript::_Update_Group_Size: Map {} ({}{}) | groupSize ({}->{}), adjustedPlayerCount ({}->{}).",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            oldGroupSize,
+            mapABInfo->groupSize,
+            oldAdjustedPlayerCount,
+            mapABInfo->adjustedPlayerCount);
+
+        if (mapABInfo->adjustedPlayerCount != oldAdjustedPlayerCount)
+            mapABInfo->mapConfigTime = 1;
+    }
+}
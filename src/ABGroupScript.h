@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_GROUP_SCRIPT_H
+#define __AB_GROUP_SCRIPT_H
+
+#include "Group.h"
+#include "ScriptMgr.h"
+
+class AutoBalance_GroupScript : public GroupScript
+{
+public:
+    AutoBalance_GroupScript()
+        : GroupScript("AutoBalance_GroupScript", {
+            GROUPHOOK_ON_ADD_MEMBER,
+            GROUPHOOK_ON_REMOVE_MEMBER,
+            GROUPHOOK_ON_DISBAND
+        })
+    {
+    }
+
+    void OnAddMember(Group* group, ObjectGuid guid) override;
+    void OnRemoveMember(Group* group, ObjectGuid guid, RemoveMethod method, ObjectGuid kicker, const char* reason) override;
+    void OnDisband(Group* group) override;
+
+private:
+    // leavingMember is set when the hook runs for a member that is being removed from the group
+    void _Update_Group_Size(Group* group, ObjectGuid leavingMember = ObjectGuid::Empty);
+};
+
+#endif /* __AB_GROUP_SCRIPT_H */
@@ -5,9 +5,7 @@
 #ifndef __AB_INFLECTION_POINT_SETTINGS_H
 #define __AB_INFLECTION_POINT_SETTINGS_H
 
-#include "DataMap.h"
-
-class AutoBalanceInflectionPointSettings : public DataMap::Base
+class AutoBalanceInflectionPointSettings
 {
 public:
     AutoBalanceInflectionPointSettings() {}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABInstanceRegistry.h"
+
+#include "ABMapInfo.h"
+#include "ABUtils.h"
+
+#include <mutex>
+#include <unordered_map>
+
+// instances publish from their own map update threads while commands read from the world thread
+static std::mutex                                               instanceRegistryLock;
+static std::unordered_map<uint32, AutoBalanceInstanceSummary>   instanceRegistry;     // keyed by instance ID
+
+void PublishInstanceSummary(Map* map)
+{
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    if (!mapABInfo->enabled)
+    {
+        RemoveInstanceSummary(map);
+        return;
+    }
+
+    // build the summary before taking the lock
+    AutoBalanceInstanceSummary summary;
+    summary.mapId               = map->GetId();
+    summary.instanceId          = map->GetInstanceId();
+    summary.playerCount         = mapABInfo->playerCount;
+    summary.adjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+    summary.mapLevel            = mapABInfo->mapLevel;
+    summary.combatLocked        = mapABInfo->combatLocked;
+
+    if (InstanceMap* instanceMap = map->ToInstanceMap())
+        summary.maxPlayers = instanceMap->GetMaxPlayers();
+
+    // the multipliers the last map refresh calculated; a count change publishes here first and the refresh it
+    // schedules publishes the new multipliers, so this never calculates them itself
+    StatMultiplierDisplay const& creatureStats = mapABInfo->displayMultipliers[false];
+    StatMultiplierDisplay const& bossStats     = mapABInfo->displayMultipliers[true];
+    summary.creatureHealthPercent = creatureStats.healthPercent;
+    summary.creatureDamagePercent = creatureStats.damagePercent;
+    summary.bossHealthPercent     = bossStats.healthPercent;
+    summary.bossDamagePercent     = bossStats.damagePercent;
+
+    std::lock_guard<std::mutex> guard(instanceRegistryLock);
+
+    // the name only needs to be copied when the instance joins
+    auto [registryIterator, joined] = instanceRegistry.try_emplace(summary.instanceId);
+    if (joined)
+        summary.mapName = map->GetMapName();
+    else
+        summary.mapName.swap(registryIterator->second.mapName);
+
+    registryIterator->second = std::move(summary);
+}
+
+void RemoveInstanceSummary(Map* map)
+{
+    if (!map || !map->GetInstanceId())
+        return;
+
+    std::lock_guard<std::mutex> guard(instanceRegistryLock);
+    instanceRegistry.erase(map->GetInstanceId());
+}
+
+std::vector<AutoBalanceInstanceSummary> GetInstanceSummaries()
+{
+    std::vector<AutoBalanceInstanceSummary> summaries;
+
+    std::lock_guard<std::mutex> guard(instanceRegistryLock);
+    summaries.reserve(instanceRegistry.size());
+
+    for (auto const& [instanceId, summary] : instanceRegistry)
+        summaries.push_back(summary);
+
+    return summaries;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_INSTANCE_REGISTRY_H
+#define __AB_INSTANCE_REGISTRY_H
+
+#include "Define.h"
+#include "Map.h"
+
+#include <string>
+#include <vector>
+
+//
+// A read-only copy of an enabled instance's AutoBalance state
+// Published by the instance's own update thread whenever its map data changes, so readers never touch the map
+//
+struct AutoBalanceInstanceSummary
+{
+    uint32      mapId                   = 0;
+    uint32      instanceId              = 0;
+    std::string mapName;
+    uint8       maxPlayers              = 0;     // The instance's player limit
+    uint8       playerCount             = 0;     // Non-GM players in the instance
+    uint8       adjustedPlayerCount     = 0;     // The player count the instance is scaled to
+    uint8       mapLevel                = 0;     // The level the instance's creatures are scaled to
+    bool        combatLocked            = false;
+    float       creatureHealthPercent   = 100.0f;
+    float       creatureDamagePercent   = 100.0f;
+    float       bossHealthPercent       = 100.0f;
+    float       bossDamagePercent       = 100.0f;
+};
+
+// add or refresh the instance's summary, or remove it if the instance is no longer enabled; called from the map's own update
+void PublishInstanceSummary(Map* map);
+// remove the instance's summary; called when the instance is unloaded
+void RemoveInstanceSummary(Map* map);
+// copies the summaries of every enabled instance
+std::vector<AutoBalanceInstanceSummary> GetInstanceSummaries();
+
+#endif
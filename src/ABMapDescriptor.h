@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_MAP_DESCRIPTOR_H
+#define __AB_MAP_DESCRIPTOR_H
+
+#include "ABInflectionPointSettings.h"
+#include "ABStatModifiers.h"
+
+#include "DataMap.h"
+#include "Define.h"
+
+class AutoBalanceMapDescriptor : public DataMap::Base
+{
+public:
+    AutoBalanceMapDescriptor() {}
+
+    uint32   mapId                        = 0;     // The map ID this descriptor was built for
+    uint8    difficulty                   = 0;     // The map difficulty this descriptor was built for
+    uint32   maxPlayers                   = 0;     // The maximum number of players for this map and difficulty
+    bool     isHeroic                     = false; // Whether this map and difficulty is heroic
+    bool     isRaid                       = false; // Whether this map is a raid
+
+    uint8    lfgMinLevel                  = 0;     // The minimum level for the map according to LFG
+    uint8    lfgTargetLevel               = 0;     // The target level for the map according to LFG
+    uint8    lfgMaxLevel                  = 0;     // The maximum level for the map according to LFG
+
+    bool     enabled                      = false; // Whether the configuration allows AutoBalance on this map and difficulty
+    uint8    minPlayers                   = 1;     // The minimum player count, already clamped to maxPlayers
+
+    bool     hasDungeonOverride           = false; // Whether AutoBalance.InflectionPoint.PerInstance is set for this map
+    bool     hasBossOverride              = false; // Whether AutoBalance.InflectionPoint.Boss.PerInstance is set for this map
+    AutoBalanceInflectionPointSettings dungeonOverride; // Copy of the per-instance inflection point override
+    AutoBalanceInflectionPointSettings bossOverride;    // Copy of the per-instance boss inflection point override
+
+    bool     hasStatModifierOverride      = false; // Whether AutoBalance.StatModifier.PerInstance is set for this map
+    bool     hasStatModifierBossOverride  = false; // Whether AutoBalance.StatModifier.Boss.PerInstance is set for this map
+    AutoBalanceStatModifiers statModifierOverride;      // Copy of the per-instance stat modifier override
+    AutoBalanceStatModifiers statModifierBossOverride;  // Copy of the per-instance boss stat modifier override
+
+    uint8    levelScalingSkipHigherLevels = 0;     // Skip level scaling when creatures are this many levels above the players
+    uint8    levelScalingSkipLowerLevels  = 0;     // Skip level scaling when creatures are this many levels below the players
+    uint8    levelScalingDynamicCeiling   = 0;     // How many levels MORE than the highestPlayerLevel creatures should be scaled to
+    uint8    levelScalingDynamicFloor     = 0;     // How many levels LESS than the highestPlayerLevel creatures should be scaled to
+};
+
+#endif
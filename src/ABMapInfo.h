@@ -5,12 +5,98 @@
 #ifndef __AB_MAP_INFO_H
 #define __AB_MAP_INFO_H
 
+#include "ABDecisionTrace.h"
+#include "ABMapDescriptor.h"
+#include "ABMetrics.h"
+#include "ABScalingBatch.h"
+#include "ABScalingCore.h"
+
 #include "Creature.h"
 #include "DataMap.h"
 #include "Player.h"
 
+#include <array>
+#include <unordered_map>
 #include <vector>
 
+//
+// A player-count change that happened while the map was combat locked
+// Joins above the combat floor raise it right away; everything else is collapsed into the final player count and applied once when combat ends
+//
+struct AutoBalancePendingChange
+{
+    bool     pending                            = false; // Whether a change is waiting to be applied
+    uint8    playerCount                        = 0;     // The most recent player count seen while combat locked
+    uint32   joins                              = 0;     // The number of players that joined while combat locked (without raising the floor)
+    uint32   leaves                             = 0;     // The number of players that left while combat locked
+};
+
+//
+// Counts of the map's non-GM players at each level
+// Kept up to date as players enter, leave and level up, so the map refresh can read the range without walking the players
+//
+struct AutoBalancePlayerLevels
+{
+    std::array<uint16, 256> counts              = {};    // The number of players at each level
+    uint32   total                              = 0;     // The number of players counted
+    uint8    lowest                             = 0;     // The lowest counted level (0 when empty)
+    uint8    highest                            = 0;     // The highest counted level (0 when empty)
+
+    void Add(uint8 level)
+    {
+        ++counts[level];
+        ++total;
+
+        if (!lowest || level < lowest)
+            lowest = level;
+        if (level > highest)
+            highest = level;
+    }
+
+    void Remove(uint8 level)
+    {
+        if (!counts[level])
+            return;
+
+        --counts[level];
+        --total;
+
+        if (!total)
+        {
+            lowest  = 0;
+            highest = 0;
+            return;
+        }
+
+        // only search for a new bound when the last player at the old one left
+        while (!counts[lowest])
+            ++lowest;
+        while (!counts[highest])
+            --highest;
+    }
+
+    void Clear()
+    {
+        counts.fill(0);
+        total   = 0;
+        lowest  = 0;
+        highest = 0;
+    }
+};
+
+//
+// A difficulty change held back by AutoBalance.PlayerCountDebounce.Window
+// The change is only applied once the player count has been stable for the whole window
+//
+struct AutoBalancePlayerCountDebounce
+{
+    bool     pending                            = false; // Whether a change is waiting for the window to pass
+    uint8    adjustedPlayerCount                = 0;     // The adjusted player count waiting to be applied
+    uint32   stableTime                         = 0;     // Milliseconds the waiting count has been stable
+    uint32   suppressedChanges                  = 0;     // Changes that were reverted before the window passed (rescales avoided)
+    uint32   appliedChanges                     = 0;     // Changes that were applied after the window passed
+};
+
 class AutoBalanceMapInfo : public DataMap::Base
 {
 public:
@@ -18,16 +104,44 @@ public:
 
     std::vector<Creature*> allMapCreatures;              // All creatures in the map, active and non-active
     std::vector<Player*>   allMapPlayers;                // All players that are currently in the map
+    std::unordered_map<Player*, uint8> allMapPlayerLevels; // The players in allMapPlayers and the level each was counted at (0 if not counted)
+    AutoBalancePlayerLevels playerLevels;                // Level counts of the non-GM players in the map
+    std::vector<Creature*> allScalableCreatures;         // All creatures in the map that AutoBalance may modify (includes summons and untracked creatures)
+    std::vector<Creature*> creatureUpdateQueue;          // Creatures waiting to be reset and modified on the next map update
+    AutoBalanceCreatureBatch creatureBatch;              // The update queue's multiplier inputs and results, kept to reuse its storage
+
+    bool     allCreaturesNeedUpdate             = false; // Set when the map's data changes; every scalable creature will be updated
+
+    bool     spawnBurstActive                   = false; // Creatures spawned since the last map update are only registered, then scaled together
+    uint32   spawnBurstCreatureCount            = 0;     // The number of creatures registered during the current spawn burst
+    uint32   spawnBurstTotalCount               = 0;     // The number of spawn bursts this map has scaled
+    uint32   spawnBurstTotalCreatures           = 0;     // The number of creatures registered across those spawn bursts
+    uint32   spawnBurstTotalModifications       = 0;     // The creature modifications made when those spawn bursts ended
+    uint32   modifyCreatureAttributesCount      = 0;     // The number of times creatures in this map have been modified
+    AutoBalanceMapMetrics metrics;                       // Counters exported by AutoBalance.Metrics.*
+
+    AutoBalanceDecisionTrace decisionTrace;              // The most recent damage/healing/CC decisions, when AutoBalance.Trace.Enable is set
+    uint32   debugEventCount                    = 0;     // Damage/healing/CC events that passed the debug filters, used for 1-in-N sampling
+    float    debugTokens                        = 0;     // Tokens left in this map's debug logging bucket
+    uint32   debugTokenTime                     = 0;     // getMSTime() when the debug logging bucket was last refilled
 
     bool     enabled                            = false; // Should AutoBalance make any changes to this map or its creatures?
+    AutoBalanceMapDescriptor const* descriptor  = nullptr; // The static settings for this map and difficulty, built at load time
 
     uint64_t globalConfigTime                   = 1;     // The last global config time that this map was updated
     uint64_t mapConfigTime                      = 1;     // The last map config time that this map was updated
 
+    StatMultiplierDisplay displayMultipliers[2];         // The multipliers announced to players, indexed by isBoss
+    uint64_t displayMultipliersConfigTime       = 0;     // The mapConfigTime that displayMultipliers were calculated for
+    uint8    displayMultipliersPlayerCount      = 0;     // The adjustedPlayerCount that displayMultipliers were calculated for
+
     uint8    playerCount                        = 0;     // The actual number of non-GM players in the map
     uint8    adjustedPlayerCount                = 0;     // The currently difficulty level expressed as number of players
     uint8    minPlayers                         = 1;     // Will be set by the config
 
+    ObjectGuid groupGuid;                                // The group whose size sets the difficulty, when AutoBalance.UseGroupSizeForDifficulty is set
+    uint8    groupSize                          = 0;     // That group's member count, kept current by AutoBalance_GroupScript
+
     uint8    mapLevel                           = 0;     // Calculated from the avgCreatureLevel
     uint8    lowestPlayerLevel                  = 0;     // The lowest-level player in the map
     uint8    highestPlayerLevel                 = 0;     // The highest-level player in the map
@@ -44,12 +158,23 @@ public:
     bool     combatLocked                       = false; // Whether or not the map is combat locked
     bool     combatLockTripped                  = false; // Set to true when combat locking was needed during this current combat (some tried to leave)
     uint8    combatLockMinPlayers               = 0;     // The instance cannot be set to less than this number of players until combat ends
+    uint32   combatLockStartTime                = 0;     // getMSTime() when the current combat lock started
+    uint8    combatLockEncounters               = 0;     // Encounters credited during the current combat lock
+    AutoBalancePendingChange pendingCombatChange;        // Player-count change deferred until combat ends
+    AutoBalancePlayerCountDebounce playerCountDebounce;  // Player-count change deferred by AutoBalance.PlayerCountDebounce.Window
 
     uint8    highestCreatureLevel               = 0;     // The highest-level creature in the map
     uint8    lowestCreatureLevel                = 0;     // The lowest-level creature in the map
     float    avgCreatureLevel                   = 0;     // The average level of all active creatures in the map (continuously updated)
     uint32   activeCreatureCount                = 0;     // The number of creatures in the map that are included in the map's stats (not necessarily alive)
 
+    bool     hasLevelProfile                    = false; // Whether the creature level stats were seeded from the startup spawn profile
+    uint8    profileHighestCreatureLevel        = 0;     // The highest-level spawned creature according to the spawn profile
+    uint8    profileLowestCreatureLevel         = 0;     // The lowest-level spawned creature according to the spawn profile
+    float    profileAvgCreatureLevel            = 0;     // The average level of spawned creatures according to the spawn profile
+    uint32   profileCreatureCount               = 0;     // The number of spawns that contributed to the spawn profile
+    uint32   profileBossCount                   = 0;     // The number of boss entries spawned in this map and difficulty
+
     bool     isLevelScalingEnabled              = false; // Whether level scaling is enabled on this map
     uint8    levelScalingSkipHigherLevels       = 0;     // Used to determine if this map should scale or not
     uint8    levelScalingSkipLowerLevels        = 0;     // Used to determine if this map should scale or not
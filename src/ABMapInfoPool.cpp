@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABMapInfoPool.h"
+
+#include "Log.h"
+
+#include <utility>
+
+static AutoBalanceMapStoragePool mapInfoPool;
+
+// move the map info's containers in or out of storage; swapping never allocates
+static void _SwapMapInfoStorage(AutoBalanceMapInfo* mapABInfo, AutoBalanceMapStorage& storage)
+{
+    mapABInfo->allMapCreatures.swap(storage.allMapCreatures);
+    mapABInfo->allMapPlayers.swap(storage.allMapPlayers);
+    mapABInfo->allMapPlayerLevels.swap(storage.allMapPlayerLevels);
+    mapABInfo->allScalableCreatures.swap(storage.allScalableCreatures);
+    mapABInfo->creatureUpdateQueue.swap(storage.creatureUpdateQueue);
+    std::swap(mapABInfo->creatureBatch, storage.creatureBatch);
+}
+
+void AcquireMapInfoStorage(Map* map, AutoBalanceMapInfo* mapABInfo)
+{
+    if (!map || !mapABInfo || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    InstanceMap* instanceMap = map->ToInstanceMap();
+
+    AutoBalanceMapStorage storage;
+    _SwapMapInfoStorage(mapABInfo, storage);
+
+    bool reused = mapInfoPool.Acquire(map->GetId(), instanceMap ? instanceMap->GetMaxPlayers() : 0, storage);
+
+    _SwapMapInfoStorage(mapABInfo, storage);
+
+    if (reused)
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::AcquireMapInfoStorage: Map {} ({}-{}) | reusing storage for ({}) creatures.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId(),
+            mapABInfo->allMapCreatures.capacity()
+        );
+}
+
+void ReleaseMapInfoStorage(Map* map)
+{
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    // don't create map info for instances AutoBalance never saw
+    AutoBalanceMapInfo* mapABInfo = map->CustomData.Get<AutoBalanceMapInfo>("AutoBalanceMapInfo");
+    if (!mapABInfo)
+        return;
+
+    // anything the pool doesn't keep is freed along with storage
+    AutoBalanceMapStorage storage;
+    _SwapMapInfoStorage(mapABInfo, storage);
+
+    mapInfoPool.Release(map->GetId(), storage);
+}
+
+AutoBalanceMapInfoPoolStats GetMapInfoPoolStats()
+{
+    return mapInfoPool.GetStats();
+}
@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_MAP_INFO_POOL_H
+#define __AB_MAP_INFO_POOL_H
+
+#include "ABMapInfo.h"
+#include "ABMapStoragePool.h"
+
+#include "Map.h"
+
+//
+// Recycles the container storage of unloaded instances for new instances of the same map
+// The map info itself is owned by the map's CustomData, so only its containers are pooled, by an AutoBalanceMapStoragePool
+//
+
+// give a newly initialized instance the storage of an unloaded one, or reserve the map's observed sizes
+void AcquireMapInfoStorage(Map* map, AutoBalanceMapInfo* mapABInfo);
+// keep the storage of an instance that is being unloaded for the next instance of the same map
+void ReleaseMapInfoStorage(Map* map);
+// copies the pool's counters
+AutoBalanceMapInfoPoolStats GetMapInfoPoolStats();
+
+#endif
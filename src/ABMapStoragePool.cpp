@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABMapStoragePool.h"
+
+#include <algorithm>
+
+void AutoBalanceMapStorage::Clear()
+{
+    allMapCreatures.clear();
+    allMapPlayers.clear();
+    allMapPlayerLevels.clear();
+    allScalableCreatures.clear();
+    creatureUpdateQueue.clear();
+    creatureBatch.Clear();
+}
+
+void AutoBalanceMapStorage::Swap(AutoBalanceMapStorage& other)
+{
+    allMapCreatures.swap(other.allMapCreatures);
+    allMapPlayers.swap(other.allMapPlayers);
+    allMapPlayerLevels.swap(other.allMapPlayerLevels);
+    allScalableCreatures.swap(other.allScalableCreatures);
+    creatureUpdateQueue.swap(other.creatureUpdateQueue);
+    std::swap(creatureBatch, other.creatureBatch);
+}
+
+bool AutoBalanceMapStoragePool::Acquire(uint32_t mapId, uint32_t maxPlayers, AutoBalanceMapStorage& storage)
+{
+    std::size_t peakCreatureCount = 0;
+    std::size_t peakScalableCount = 0;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        auto poolIterator = pools.find(mapId);
+        if (poolIterator != pools.end())
+        {
+            MapPool& pool = poolIterator->second;
+
+            if (!pool.storage.empty())
+            {
+                storage.Swap(pool.storage.back());
+                pool.storage.pop_back();
+                ++stats.reused;
+                return true;
+            }
+
+            peakCreatureCount = pool.peakCreatureCount;
+            peakScalableCount = pool.peakScalableCount;
+        }
+
+        if (peakCreatureCount)
+            ++stats.reserved;
+        else
+            ++stats.cold;
+    }
+
+    // nothing to reuse (first instance of this map, or more instances open than were released), size for what we've seen
+    storage.allMapPlayers.reserve(maxPlayers);
+    storage.allMapPlayerLevels.reserve(maxPlayers);
+    storage.allMapCreatures.reserve(peakCreatureCount);
+    storage.allScalableCreatures.reserve(peakScalableCount);
+    storage.creatureUpdateQueue.reserve(peakScalableCount);
+    storage.creatureBatch.Reserve(peakScalableCount);
+
+    return false;
+}
+
+void AutoBalanceMapStoragePool::Release(uint32_t mapId, AutoBalanceMapStorage& storage)
+{
+    storage.Clear();
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    // the vectors never shrink, so their capacity is the most this instance ever held
+    MapPool& pool = pools[mapId];
+    pool.peakCreatureCount = std::max(pool.peakCreatureCount, storage.allMapCreatures.capacity());
+    pool.peakScalableCount = std::max(pool.peakScalableCount, storage.allScalableCreatures.capacity());
+
+    if (pool.storage.size() >= AUTOBALANCE_MAP_INFO_POOL_SIZE)
+    {
+        ++stats.dropped;
+        return;
+    }
+
+    if (pool.storage.empty())
+        pool.storage.reserve(AUTOBALANCE_MAP_INFO_POOL_SIZE);
+
+    pool.storage.emplace_back();
+    pool.storage.back().Swap(storage);
+    ++stats.released;
+}
+
+AutoBalanceMapInfoPoolStats AutoBalanceMapStoragePool::GetStats() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return stats;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_MAP_STORAGE_POOL_H
+#define __AB_MAP_STORAGE_POOL_H
+
+#include "ABScalingBatch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#define AUTOBALANCE_MAP_INFO_POOL_SIZE 4 // released container sets kept per map ID
+
+class Creature;
+class Player;
+
+//
+// The containers an instance's map info grows while it is loaded, and a pool that recycles them for the next
+// instance of the same map
+// The pool only ever holds the containers, never the creatures or players they pointed at, so it needs nothing
+// from the game and is built into ab_core
+//
+
+struct AutoBalanceMapStorage
+{
+    std::vector<Creature*>               allMapCreatures;
+    std::vector<Player*>                 allMapPlayers;
+    std::unordered_map<Player*, uint8_t> allMapPlayerLevels;
+    std::vector<Creature*>               allScalableCreatures;
+    std::vector<Creature*>               creatureUpdateQueue;
+    AutoBalanceCreatureBatch             creatureBatch;
+
+    // empties every container but keeps its capacity
+    void Clear();
+    void Swap(AutoBalanceMapStorage& other);
+};
+
+// Counts of what the pool did since startup, shown by `.ab instances`
+struct AutoBalanceMapInfoPoolStats
+{
+    uint64_t    reused                  = 0;     // Instances that took the storage of an unloaded instance
+    uint64_t    reserved                = 0;     // Instances that allocated storage sized from an earlier instance of the map
+    uint64_t    cold                    = 0;     // Instances that allocated storage with no earlier instance to size it from
+    uint64_t    released                = 0;     // Unloaded instances whose storage was kept
+    uint64_t    dropped                 = 0;     // Unloaded instances whose storage was freed because the map's pool was full
+};
+
+class AutoBalanceMapStoragePool
+{
+public:
+    // Swaps the storage of an unloaded instance of the map into storage and returns true, or reserves the sizes seen
+    // in the map's earlier instances (and maxPlayers for the player containers) and returns false
+    bool Acquire(uint32_t mapId, uint32_t maxPlayers, AutoBalanceMapStorage& storage);
+
+    // Keeps storage's containers, emptied, for the map's next instance and leaves storage with none
+    // When the map's pool is full, storage keeps its containers and they are freed along with it
+    void Release(uint32_t mapId, AutoBalanceMapStorage& storage);
+
+    AutoBalanceMapInfoPoolStats GetStats() const;
+
+private:
+    struct MapPool
+    {
+        std::vector<AutoBalanceMapStorage> storage;                  // Released storage, ready to be handed out
+        std::size_t                        peakCreatureCount  = 0;   // The most creatures seen in one instance of this map
+        std::size_t                        peakScalableCount  = 0;   // The most scalable creatures seen in one instance of this map
+    };
+
+    // instances of different maps are created and unloaded from different map update threads
+    mutable std::mutex                      lock;
+    std::unordered_map<uint32_t, MapPool>   pools;
+    AutoBalanceMapInfoPoolStats             stats;
+};
+
+#endif
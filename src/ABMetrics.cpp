@@ -0,0 +1,366 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABMetrics.h"
+
+#include "ABConfig.h"
+#include "ABMapInfo.h"
+#include "ABUtils.h"
+
+#include "Log.h"
+#include "Map.h"
+#include "MapMgr.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static uint32 metricsExportTimer = 0;
+
+AutoBalanceMetricsTimer::AutoBalanceMetricsTimer(Map* map, Map_Metric_Type type) : _type(type)
+{
+    if (!ProfilingEnable || !map || !map->IsDungeon())
+        return;
+
+    _metrics   = &GetMapInfo(map)->metrics;
+    _startTime = std::chrono::steady_clock::now();
+}
+
+AutoBalanceMetricsTimer::~AutoBalanceMetricsTimer()
+{
+    if (!_metrics)
+        return;
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _startTime);
+
+    _metrics->timeUs[_type].fetch_add(elapsed.count(), std::memory_order_relaxed);
+
+    if (_type == AUTOBALANCE_METRIC_HOOKS)
+        _metrics->hookCalls.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UpdateMapMetricsWindow(AutoBalanceMapMetrics& metrics, uint32 diff, uint32 rescaleCount)
+{
+    metrics.bucketTimer += diff;
+
+    if (metrics.bucketTimer < AUTOBALANCE_METRICS_WINDOW_BUCKET_MS)
+        return;
+
+    metrics.bucketTimer = 0;
+
+    // close the current bucket, overwriting the oldest one
+    for (uint8 type = 0; type < AUTOBALANCE_METRIC_COUNT; ++type)
+    {
+        uint64 timeUs = metrics.timeUs[type].load(std::memory_order_relaxed);
+
+        metrics.windowTimeUs[metrics.bucketIndex][type] = timeUs - metrics.bucketStartTimeUs[type];
+        metrics.bucketStartTimeUs[type] = timeUs;
+    }
+
+    metrics.windowRescales[metrics.bucketIndex] = rescaleCount - metrics.bucketStartRescales;
+    metrics.bucketStartRescales = rescaleCount;
+
+    metrics.bucketIndex = (metrics.bucketIndex + 1) % AUTOBALANCE_METRICS_WINDOW_BUCKETS;
+}
+
+uint64 GetMapMetricsWindowTimeUs(AutoBalanceMapMetrics const& metrics, Map_Metric_Type type)
+{
+    // the closed buckets plus whatever the current bucket has collected so far
+    uint64 timeUs = metrics.timeUs[type].load(std::memory_order_relaxed) - metrics.bucketStartTimeUs[type];
+
+    for (uint8 bucket = 0; bucket < AUTOBALANCE_METRICS_WINDOW_BUCKETS; ++bucket)
+        timeUs += metrics.windowTimeUs[bucket][type];
+
+    return timeUs;
+}
+
+uint32 GetMapMetricsWindowRescales(AutoBalanceMapMetrics const& metrics, uint32 rescaleCount)
+{
+    uint32 rescales = rescaleCount - metrics.bucketStartRescales;
+
+    for (uint8 bucket = 0; bucket < AUTOBALANCE_METRICS_WINDOW_BUCKETS; ++bucket)
+        rescales += metrics.windowRescales[bucket];
+
+    return rescales;
+}
+
+//
+// The export's series, in the order they're written; each row holds one value per series
+//
+enum Metrics_Series
+{
+    AUTOBALANCE_METRICS_SERIES_PLAYER_COUNT = 0,
+    AUTOBALANCE_METRICS_SERIES_ADJUSTED_PLAYER_COUNT,
+    AUTOBALANCE_METRICS_SERIES_MAP_LEVEL,
+    AUTOBALANCE_METRICS_SERIES_WORLD_DAMAGE_HEALING_MULTIPLIER,
+    AUTOBALANCE_METRICS_SERIES_WORLD_HEALTH_MULTIPLIER,
+    AUTOBALANCE_METRICS_SERIES_COMBAT_LOCKED,
+    AUTOBALANCE_METRICS_SERIES_CREATURE_COUNT,
+    AUTOBALANCE_METRICS_SERIES_ACTIVE_CREATURE_COUNT,
+    AUTOBALANCE_METRICS_SERIES_RESCALES,
+    AUTOBALANCE_METRICS_SERIES_SPAWN_BURSTS,
+    AUTOBALANCE_METRICS_SERIES_SPAWN_BURST_CREATURES,
+    AUTOBALANCE_METRICS_SERIES_SPAWN_BURST_RESCALES,
+    AUTOBALANCE_METRICS_SERIES_HOOK_CALLS,
+    AUTOBALANCE_METRICS_SERIES_HOOK_SECONDS,
+    AUTOBALANCE_METRICS_SERIES_CREATURE_SECONDS,
+    AUTOBALANCE_METRICS_SERIES_SCALING_SECONDS,
+    AUTOBALANCE_METRICS_SERIES_MAP_UPDATE_SECONDS,
+    AUTOBALANCE_METRICS_SERIES_COUNT
+};
+
+struct AutoBalanceMetricsSeries
+{
+    char const* name;
+    char const* type;
+    char const* help;
+};
+
+static AutoBalanceMetricsSeries const metricsSeries[AUTOBALANCE_METRICS_SERIES_COUNT] =
+{
+    // gauges
+    { "player_count",                    "gauge",   "Non-GM players in the instance." },
+    { "adjusted_player_count",           "gauge",   "Player count the instance is scaled to." },
+    { "map_level",                       "gauge",   "Level the instance's creatures are scaled to." },
+    { "world_damage_healing_multiplier", "gauge",   "Damage/healing multiplier for non-creature sources." },
+    { "world_health_multiplier",         "gauge",   "Health multiplier for destructible objects." },
+    { "combat_locked",                   "gauge",   "1 if the instance is combat locked." },
+    { "creature_count",                  "gauge",   "Creatures tracked in the instance." },
+    { "active_creature_count",           "gauge",   "Creatures included in the instance's level stats." },
+
+    // counters
+    { "rescales_total",                  "counter", "Creature stat modifications in the instance." },
+    { "spawn_bursts_total",              "counter", "Spawn bursts scaled in the instance." },
+    { "spawn_burst_creatures_total",     "counter", "Creatures registered during spawn bursts in the instance." },
+    { "spawn_burst_rescales_total",      "counter", "Creature stat modifications made when spawn bursts ended in the instance." },
+    { "hook_calls_total",                "counter", "Damage, healing and CC hook calls in the instance." },
+    { "hook_seconds_total",              "counter", "Time spent in the damage, healing and CC hooks in the instance." },
+    { "creature_seconds_total",          "counter", "Time spent in the creature level selection and add/remove world hooks in the instance." },
+    { "scaling_seconds_total",           "counter", "Time spent modifying creature stats in the instance." },
+    { "map_update_seconds_total",        "counter", "Time spent in the map update hook in the instance." }
+};
+
+// one instance's values, copied on the world thread so the writer never touches the map
+struct AutoBalanceMetricsRow
+{
+    uint32 mapId                                    = 0;
+    uint32 instanceId                               = 0;
+    double values[AUTOBALANCE_METRICS_SERIES_COUNT] = {};
+};
+
+//
+// The world thread collects a snapshot and hands it to the writer thread, which formats and writes the file
+// Only the latest snapshot is kept: one the writer hasn't picked up yet is replaced by the next
+//
+static std::vector<AutoBalanceMetricsRow>               metricsPendingRows;                 // Guarded by metricsLock
+static bool                                             metricsPending          = false;    // Guarded by metricsLock
+static bool                                             metricsThreadRunning    = false;    // Guarded by metricsLock
+static std::mutex                                       metricsLock;
+static std::condition_variable                          metricsCondition;
+static std::thread                                      metricsThread;
+static std::string                                      metricsFileName;
+static uint32                                           metricsMaxInstances     = 0;
+static std::atomic<uint64>                              metricsSkipped          { 0 };      // Snapshots replaced before they were written
+
+static void _WriteMetric(std::ofstream& file, std::vector<AutoBalanceMetricsRow> const& rows, Metrics_Series series)
+{
+    file << "# HELP autobalance_" << metricsSeries[series].name << ' ' << metricsSeries[series].help << '\n';
+    file << "# TYPE autobalance_" << metricsSeries[series].name << ' ' << metricsSeries[series].type << '\n';
+
+    for (AutoBalanceMetricsRow const& row : rows)
+        file << "autobalance_" << metricsSeries[series].name << "{map=\"" << row.mapId << "\",instance=\"" << row.instanceId << "\"} " << row.values[series] << '\n';
+}
+
+static bool _WriteMetricsFile(std::string const& fileName, std::vector<AutoBalanceMetricsRow> const& rows, uint32 droppedInstances)
+{
+    // write next to the target and rename so the collector never reads a partial file
+    std::string tempFileName = fileName + ".tmp";
+
+    {
+        std::ofstream file(tempFileName, std::ios::out | std::ios::trunc);
+        if (!file.is_open())
+            return false;
+
+        for (uint8 series = 0; series < AUTOBALANCE_METRICS_SERIES_COUNT; ++series)
+            _WriteMetric(file, rows, Metrics_Series(series));
+
+        file << "# HELP autobalance_instances_dropped Instances left out because of AutoBalance.Metrics.MaxInstances.\n";
+        file << "# TYPE autobalance_instances_dropped gauge\n";
+        file << "autobalance_instances_dropped " << droppedInstances << '\n';
+
+        if (!file.good())
+            return false;
+    }
+
+#ifdef _WIN32
+    // rename doesn't replace an existing file on Windows
+    std::remove(fileName.c_str());
+#endif
+
+    return std::rename(tempFileName.c_str(), fileName.c_str()) == 0;
+}
+
+static void _MetricsWriter(std::string fileName, uint32 maxInstances)
+{
+    std::vector<AutoBalanceMetricsRow> rows;
+    uint64 reportedSkipped = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> guard(metricsLock);
+            metricsCondition.wait(guard, [] { return metricsPending || !metricsThreadRunning; });
+
+            // anything collected before we were stopped is still written
+            if (!metricsPending)
+                return;
+
+            // hand the previous buffer back so the world thread can reuse its storage
+            rows.swap(metricsPendingRows);
+            metricsPending = false;
+        }
+
+        // keep the busiest instances when there are more than the configured limit
+        uint32 droppedInstances = 0;
+
+        if (maxInstances && rows.size() > maxInstances)
+        {
+            std::partial_sort(rows.begin(), rows.begin() + maxInstances, rows.end(),
+                [](AutoBalanceMetricsRow const& a, AutoBalanceMetricsRow const& b)
+                {
+                    return a.values[AUTOBALANCE_METRICS_SERIES_PLAYER_COUNT] > b.values[AUTOBALANCE_METRICS_SERIES_PLAYER_COUNT];
+                });
+
+            droppedInstances = rows.size() - maxInstances;
+            rows.resize(maxInstances);
+        }
+
+        if (!_WriteMetricsFile(fileName, rows, droppedInstances))
+            LOG_ERROR("module.AutoBalance", "AutoBalance::MetricsWriter: Could not write metrics to `{}`.", fileName);
+
+        uint64 skipped = metricsSkipped.load(std::memory_order_relaxed);
+        if (skipped != reportedSkipped)
+        {
+            LOG_WARN("module.AutoBalance", "AutoBalance::MetricsWriter: Writing `{}` fell behind, {} snapshots replaced before they were written ({} total).", fileName, skipped - reportedSkipped, skipped);
+            reportedSkipped = skipped;
+        }
+    }
+}
+
+static void _StopMetricsExport()
+{
+    if (!metricsThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(metricsLock);
+        metricsThreadRunning = false;
+    }
+
+    metricsCondition.notify_one();
+    metricsThread.join();
+}
+
+void OpenMetricsExport()
+{
+    // keep the current writer if nothing changed on a config reload
+    if (MetricsEnable && metricsThread.joinable() && metricsFileName == MetricsFile && metricsMaxInstances == MetricsMaxInstances)
+        return;
+
+    _StopMetricsExport();
+
+    // export on the first world update after being enabled
+    metricsExportTimer = 0;
+
+    if (!MetricsEnable)
+        return;
+
+    metricsFileName     = MetricsFile;
+    metricsMaxInstances = MetricsMaxInstances;
+    metricsSkipped      = 0;
+
+    {
+        std::lock_guard<std::mutex> guard(metricsLock);
+        metricsPending       = false;
+        metricsThreadRunning = true;
+    }
+
+    metricsThread = std::thread(_MetricsWriter, metricsFileName, metricsMaxInstances);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::OpenMetricsExport: Writing metrics to `{}` every {}s.", metricsFileName, MetricsInterval);
+}
+
+void CloseMetricsExport()
+{
+    _StopMetricsExport();
+}
+
+void UpdateMetricsExport(uint32 diff)
+{
+    if (!MetricsEnable || !metricsThread.joinable())
+        return;
+
+    if (metricsExportTimer > diff)
+    {
+        metricsExportTimer -= diff;
+        return;
+    }
+
+    metricsExportTimer = MetricsInterval * IN_MILLISECONDS;
+
+    // this runs on the world thread between map updates, so the maps' data isn't changing underneath us
+    static std::vector<AutoBalanceMetricsRow> rows;
+    rows.clear();
+
+    sMapMgr->DoForAllMaps([](Map* map)
+    {
+        if (!map->IsDungeon() || !map->GetInstanceId())
+            return;
+
+        // don't create map info for instances AutoBalance hasn't seen yet
+        AutoBalanceMapInfo* mapABInfo = map->CustomData.Get<AutoBalanceMapInfo>("AutoBalanceMapInfo");
+        if (!mapABInfo)
+            return;
+
+        AutoBalanceMetricsRow& row = rows.emplace_back();
+        row.mapId      = map->GetId();
+        row.instanceId = map->GetInstanceId();
+
+        double* values = row.values;
+        values[AUTOBALANCE_METRICS_SERIES_PLAYER_COUNT]                    = mapABInfo->playerCount;
+        values[AUTOBALANCE_METRICS_SERIES_ADJUSTED_PLAYER_COUNT]           = mapABInfo->adjustedPlayerCount;
+        values[AUTOBALANCE_METRICS_SERIES_MAP_LEVEL]                       = mapABInfo->mapLevel;
+        values[AUTOBALANCE_METRICS_SERIES_WORLD_DAMAGE_HEALING_MULTIPLIER] = mapABInfo->scaledWorldDamageHealingMultiplier;
+        values[AUTOBALANCE_METRICS_SERIES_WORLD_HEALTH_MULTIPLIER]         = mapABInfo->worldHealthMultiplier;
+        values[AUTOBALANCE_METRICS_SERIES_COMBAT_LOCKED]                   = mapABInfo->combatLocked ? 1.0 : 0.0;
+        values[AUTOBALANCE_METRICS_SERIES_CREATURE_COUNT]                  = mapABInfo->allMapCreatures.size();
+        values[AUTOBALANCE_METRICS_SERIES_ACTIVE_CREATURE_COUNT]           = mapABInfo->activeCreatureCount;
+        values[AUTOBALANCE_METRICS_SERIES_RESCALES]                        = mapABInfo->modifyCreatureAttributesCount;
+        values[AUTOBALANCE_METRICS_SERIES_SPAWN_BURSTS]                    = mapABInfo->spawnBurstTotalCount;
+        values[AUTOBALANCE_METRICS_SERIES_SPAWN_BURST_CREATURES]           = mapABInfo->spawnBurstTotalCreatures;
+        values[AUTOBALANCE_METRICS_SERIES_SPAWN_BURST_RESCALES]            = mapABInfo->spawnBurstTotalModifications;
+        values[AUTOBALANCE_METRICS_SERIES_HOOK_CALLS]                      = mapABInfo->metrics.hookCalls.load(std::memory_order_relaxed);
+        values[AUTOBALANCE_METRICS_SERIES_HOOK_SECONDS]                    = mapABInfo->metrics.timeUs[AUTOBALANCE_METRIC_HOOKS].load(std::memory_order_relaxed) / 1000000.0;
+        values[AUTOBALANCE_METRICS_SERIES_CREATURE_SECONDS]                = mapABInfo->metrics.timeUs[AUTOBALANCE_METRIC_CREATURES].load(std::memory_order_relaxed) / 1000000.0;
+        values[AUTOBALANCE_METRICS_SERIES_SCALING_SECONDS]                 = mapABInfo->metrics.timeUs[AUTOBALANCE_METRIC_SCALING].load(std::memory_order_relaxed) / 1000000.0;
+        values[AUTOBALANCE_METRICS_SERIES_MAP_UPDATE_SECONDS]              = mapABInfo->metrics.timeUs[AUTOBALANCE_METRIC_MAP_UPDATE].load(std::memory_order_relaxed) / 1000000.0;
+    });
+
+    // the formatting and the file are left to the writer; only the swap happens under the lock
+    {
+        std::lock_guard<std::mutex> guard(metricsLock);
+
+        if (metricsPending)
+            metricsSkipped.fetch_add(1, std::memory_order_relaxed);
+
+        rows.swap(metricsPendingRows);
+        metricsPending = true;
+    }
+
+    metricsCondition.notify_one();
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_METRICS_H
+#define __AB_METRICS_H
+
+#include "AutoBalance.h"
+
+#include "Define.h"
+#include "Map.h"
+
+#include <atomic>
+#include <chrono>
+
+#define AUTOBALANCE_METRICS_WINDOW_BUCKETS   6     // closed buckets kept for the sliding window
+#define AUTOBALANCE_METRICS_WINDOW_BUCKET_MS 10000 // length of each bucket
+
+//
+// Per-instance counters that are read from outside the map's own update thread
+//
+struct AutoBalanceMapMetrics
+{
+    std::atomic<uint64> hookCalls           { 0 }; // The number of damage/healing/CC hook calls in this map
+    std::atomic<uint64> timeUs[AUTOBALANCE_METRIC_COUNT] = {}; // Microseconds spent in each Map_Metric_Type in this map
+
+    // sliding window, only written by the map's update and read between map updates
+    uint64   windowTimeUs[AUTOBALANCE_METRICS_WINDOW_BUCKETS][AUTOBALANCE_METRIC_COUNT] = {}; // Time spent during each closed bucket
+    uint32   windowRescales[AUTOBALANCE_METRICS_WINDOW_BUCKETS] = {};                         // Creature modifications during each closed bucket
+    uint64   bucketStartTimeUs[AUTOBALANCE_METRIC_COUNT] = {};                                // timeUs when the current bucket started
+    uint32   bucketStartRescales    = 0;       // modifyCreatureAttributesCount when the current bucket started
+    uint32   bucketIndex            = 0;       // The bucket that will be closed next
+    uint32   bucketTimer            = 0;       // Milliseconds spent in the current bucket
+};
+
+//
+// Adds the time spent in a scope to the map's metrics, when AutoBalance.Profiling.Enable or AutoBalance.Metrics.Enable is set
+//
+class AutoBalanceMetricsTimer
+{
+public:
+    AutoBalanceMetricsTimer(Map* map, Map_Metric_Type type);
+    ~AutoBalanceMetricsTimer();
+
+private:
+    AutoBalanceMapMetrics*                _metrics = nullptr;
+    Map_Metric_Type                       _type;
+    std::chrono::steady_clock::time_point _startTime;
+};
+
+// close the current window bucket once it is old enough; called from the map's own update
+void UpdateMapMetricsWindow(AutoBalanceMapMetrics& metrics, uint32 diff, uint32 rescaleCount);
+// the time spent in the given category over the sliding window
+uint64 GetMapMetricsWindowTimeUs(AutoBalanceMapMetrics const& metrics, Map_Metric_Type type);
+// the creature modifications over the sliding window
+uint32 GetMapMetricsWindowRescales(AutoBalanceMapMetrics const& metrics, uint32 rescaleCount);
+
+// start, restart or stop the metrics writer to match the config; called from the world thread
+void OpenMetricsExport();
+// stop the writer after it has written the last collected snapshot
+void CloseMetricsExport();
+// collect every instance's metrics once per AutoBalance.Metrics.Interval and hand them to the writer; called from the world thread
+void UpdateMetricsExport(uint32 diff);
+
+#endif
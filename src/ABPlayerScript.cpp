@@ -1,7 +1,10 @@
 #include <string>
 
+#include "ABAllCreatureScript.h"
 #include "ABConfig.h"
 #include "ABCreatureInfo.h"
+#include "ABEncounterTelemetry.h"
+#include "ABInstanceRegistry.h"
 #include "ABMapInfo.h"
 #include "ABPlayerScript.h"
 #include "ABUtils.h"
@@ -28,12 +31,31 @@ void AutoBalance_PlayerScript::OnPlayerLevelChanged(Player* player, uint8 oldlev
     if (!map || !map->IsDungeon())
         return;
 
-    // update the map's player stats
-    UpdateMapPlayerStats(map);
-
-    // schedule all creatures for an update
     AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
-    mapABInfo->mapConfigTime = GetCurrentConfigTime();
+    uint8 oldHighestPlayerLevel   = mapABInfo->highestPlayerLevel;
+
+    // move the player to their new level in the map's level counts, then update the map's player stats
+    UpdateMapPlayerLevel(map, player);
+    UpdateMapPlayerStats(map, false);
+
+    // creatures only follow the highest player level; the lowest is informational
+    if (mapABInfo->highestPlayerLevel == oldHighestPlayerLevel)
+    {
+        // the map level didn't move, so only the player stats need publishing
+        PublishInstanceSummary(map);
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance_PlayerScript::OnLevelChanged: Map {} ({}{}) | Highest player level unchanged ({}), no rescale needed.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            oldHighestPlayerLevel);
+
+        return;
+    }
+
+    // move the map level and world multipliers, then rescale only the creatures that follow the players' level
+    UpdateMapLevel(map, true);
+    AutoBalance_AllCreatureScript::RescaleCreaturesForPlayerLevel(map);
 }
 
 void AutoBalance_PlayerScript::OnPlayerGiveXP(Player* player, uint32& amount, Unit* victim, uint8 /*xpSource*/)
@@ -46,7 +68,7 @@ void AutoBalance_PlayerScript::OnPlayerGiveXP(Player* player, uint32& amount, Un
 
     AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
 
-    if (victim && RewardScalingXP && mapABInfo->enabled)
+    if (victim && ScalingSettings.rewardScalingXP && mapABInfo->enabled)
     {
         Map* map = player->GetMap();
 
@@ -54,13 +76,13 @@ void AutoBalance_PlayerScript::OnPlayerGiveXP(Player* player, uint32& amount, Un
 
         if (map->IsDungeon())
         {
-            if (RewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+            if (ScalingSettings.rewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
             {
                 LOG_DEBUG("module.AutoBalance", "AutoBalance_PlayerScript::OnGiveXP: Distributing XP from '{}' to '{}' in dynamic mode - {}->{}",
                     victim->GetName(), player->GetName(), amount, uint32(amount * creatureABInfo->XPModifier));
                 amount = uint32(amount * creatureABInfo->XPModifier);
             }
-            else if (RewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
+            else if (ScalingSettings.rewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
             {
                 // Ensure that the players always get the same XP, even when entering the dungeon alone
                 auto maxPlayerCount = map->ToInstanceMap()->GetMaxPlayers();
@@ -84,7 +106,7 @@ void AutoBalance_PlayerScript::OnPlayerBeforeLootMoney(Player* player, Loot* loo
     AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
     ObjectGuid sourceGuid = loot->sourceWorldObjectGUID;
 
-    if (mapABInfo->enabled && RewardScalingMoney)
+    if (mapABInfo->enabled && ScalingSettings.rewardScalingMoney)
     {
         // if the loot source is a creature, honor the modifiers for that creature
         if (sourceGuid.IsCreature())
@@ -93,14 +115,14 @@ void AutoBalance_PlayerScript::OnPlayerBeforeLootMoney(Player* player, Loot* loo
             AutoBalanceCreatureInfo* creatureABInfo = sourceCreature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
             // Dynamic Mode
-            if (RewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+            if (ScalingSettings.rewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
             {
                 LOG_DEBUG("module.AutoBalance", "AutoBalance_PlayerScript::OnBeforeLootMoney: Distributing money from '{}' in dynamic mode - {}->{}",
                     sourceCreature->GetName(), loot->gold, uint32(loot->gold * creatureABInfo->MoneyModifier));
                 loot->gold = uint32(loot->gold * creatureABInfo->MoneyModifier);
             }
             // Fixed Mode
-            else if (RewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
+            else if (ScalingSettings.rewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
             {
                 // Ensure that the players always get the same money, even when entering the dungeon alone
                 auto maxPlayerCount = map->ToInstanceMap()->GetMaxPlayers();
@@ -147,6 +169,8 @@ void AutoBalance_PlayerScript::OnPlayerEnterCombat(Player* player, Unit* /*enemy
     {
         mapABInfo->combatLocked = true;
         mapABInfo->combatLockMinPlayers = mapABInfo->playerCount;
+        mapABInfo->combatLockStartTime = getMSTime();
+        mapABInfo->combatLockEncounters = 0;
 
         LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance_PlayerScript::OnPlayerEnterCombat: Map {} ({}{}) | Locking difficulty to no less than ({}) as {} enters combat.",
             map->GetMapName(),
@@ -155,6 +179,35 @@ void AutoBalance_PlayerScript::OnPlayerEnterCombat(Player* player, Unit* /*enemy
             mapABInfo->combatLockMinPlayers,
             player->GetName()
         );
+
+        // a change still waiting out the debounce window must not be applied mid-fight, defer it until combat ends instead
+        AutoBalancePlayerCountDebounce& debounce = mapABInfo->playerCountDebounce;
+
+        if (debounce.pending)
+        {
+            AutoBalancePendingChange& pendingChange = mapABInfo->pendingCombatChange;
+
+            if (debounce.adjustedPlayerCount > mapABInfo->adjustedPlayerCount)
+                pendingChange.joins  += debounce.adjustedPlayerCount - mapABInfo->adjustedPlayerCount;
+            else
+                pendingChange.leaves += mapABInfo->adjustedPlayerCount - debounce.adjustedPlayerCount;
+
+            pendingChange.pending     = true;
+            pendingChange.playerCount = mapABInfo->playerCount;
+
+            debounce.pending = false;
+
+            LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance_PlayerScript::OnPlayerEnterCombat: Map {} ({}{}) | Debounced change ({}->{}) deferred until combat ends.",
+                map->GetMapName(),
+                map->GetId(),
+                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                mapABInfo->adjustedPlayerCount,
+                debounce.adjustedPlayerCount
+            );
+        }
+
+        PublishInstanceSummary(map);
+        RecordEncounterTelemetry(map, AUTOBALANCE_TELEMETRY_COMBAT_START);
     }
 }
 
@@ -200,11 +253,12 @@ void AutoBalance_PlayerScript::OnPlayerLeaveCombat(Player* player)
         }
     }
 
-    auto locale = player->GetSession()->GetSessionDbLocaleIndex();
-
     // if no players are in combat, unlock the map
     if (!anyPlayersInCombat && mapABInfo->combatLocked)
     {
+        // record while the lock's duration and encounters are still known
+        RecordEncounterTelemetry(map, AUTOBALANCE_TELEMETRY_COMBAT_END);
+
         mapABInfo->combatLocked = false;
         mapABInfo->combatLockMinPlayers = 0;
 
@@ -215,28 +269,51 @@ void AutoBalance_PlayerScript::OnPlayerLeaveCombat(Player* player)
             player->GetName()
         );
 
+        PublishInstanceSummary(map);
+
         // if the combat lock needed to be used, notify the players of it lifting
         if (mapABInfo->combatLockTripped)
         {
+            ABLocaleMessageCache combatChangeMessage(AB_MSG_LEAVING_INSTANCE_COMBAT_CHANGE);
+
             for (auto player : mapABInfo->allMapPlayers)
             {
                 if (player && player->GetSession())
-                    ChatHandler(player->GetSession()).PSendSysMessage(ABGetLocaleText(locale, "leaving_instance_combat_change").c_str());
+                    ChatHandler(player->GetSession()).SendSysMessage(combatChangeMessage.Get(player->GetSession()->GetSessionDbLocaleIndex()));
             }
         }
 
-        // if the number of players changed while combat was in progress, schedule the map for an update
-        if (mapABInfo->combatLockTripped && mapABInfo->playerCount != mapABInfo->combatLockMinPlayers)
+        // if the number of players changed while combat was in progress, apply the final player count once
+        AutoBalancePendingChange& pendingChange = mapABInfo->pendingCombatChange;
+
+        if (pendingChange.pending)
         {
-            mapABInfo->mapConfigTime = 1;
-            LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance_PlayerScript::OnPlayerLeaveCombat: Map {} ({}{}) | Reset map config time to ({}).",
+            LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance_PlayerScript::OnPlayerLeaveCombat: Map {} ({}{}) | Applying deferred player count ({}) after {} join(s) and {} leave(s) during combat.",
                 map->GetMapName(),
                 map->GetId(),
                 map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                mapABInfo->mapConfigTime
+                pendingChange.playerCount,
+                pendingChange.joins,
+                pendingChange.leaves
             );
 
-            mapABInfo->combatLockTripped = false;
+            // store the previous difficulty for comparison
+            uint8 prevAdjustedPlayerCount = mapABInfo->adjustedPlayerCount;
+
+            // recalculate the difficulty now that the map is unlocked; the change is still pending so it isn't debounced again
+            // an unchanged difficulty was already published above, a changed one is published by the map refresh
+            UpdateMapPlayerStats(map, false);
+
+            pendingChange = AutoBalancePendingChange();
+
+            // rescale every creature in one batched pass rather than letting each one catch up on its own update tick
+            if (prevAdjustedPlayerCount != mapABInfo->adjustedPlayerCount)
+            {
+                UpdateMapDataIfNeeded(map, true);
+                AutoBalance_AllCreatureScript::RescaleMapCreatures(map);
+            }
         }
+
+        mapABInfo->combatLockTripped = false;
     }
 }
@@ -0,0 +1,458 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABPrecomputeCache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//
+// Hasher
+//
+
+void AutoBalanceCacheHasher::Add(void const* data, std::size_t size)
+{
+    uint8_t const* bytes = static_cast<uint8_t const*>(data);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+void AutoBalanceCacheHasher::Add(std::string const& value)
+{
+    // the length keeps "ab" + "c" and "a" + "bc" apart
+    Add(static_cast<uint64_t>(value.size()));
+    Add(value.data(), value.size());
+}
+
+//
+// Builder
+//
+
+void AutoBalancePrecomputeCacheBuilder::AddLevelProfileSpawn(AutoBalanceProfileSpawn const& spawn)
+{
+    LevelProfile& profile = levelProfiles[spawn.key];
+
+    profile.levelHistogram[spawn.level]++;
+    profile.creatureCount++;
+
+    if (spawn.isBoss)
+        profile.bossEntries.insert(spawn.entry);
+}
+
+void AutoBalancePrecomputeCacheBuilder::AddMultiplierTable(uint32_t key, AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map)
+{
+    std::vector<StatMultiplierDisplay>& rows = multiplierTables[key];
+    rows.clear();
+    rows.reserve(map.maxPlayers * 2);
+
+    for (uint32_t playerCount = 1; playerCount <= map.maxPlayers; ++playerCount)
+    {
+        rows.push_back(calculateDisplayMultipliers(settings, map, false, (float)playerCount));
+        rows.push_back(calculateDisplayMultipliers(settings, map, true, (float)playerCount));
+    }
+}
+
+void AutoBalancePrecomputeCacheBuilder::SetBaseValues(uint32_t classIndex, uint8_t level, AutoBalanceCachedBaseValues const& values)
+{
+    if (classIndex >= AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT)
+        return;
+
+    baseValues[classIndex * AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT + level] = values;
+}
+
+template<typename T>
+static void _AppendSection(std::vector<uint8_t>& data, std::vector<T> const& section)
+{
+    uint8_t const* bytes = reinterpret_cast<uint8_t const*>(section.data());
+    data.insert(data.end(), bytes, bytes + section.size() * sizeof(T));
+}
+
+std::vector<uint8_t> AutoBalancePrecomputeCacheBuilder::Build(uint64_t keyHash) const
+{
+    //
+    // Flatten the sections, both maps are already sorted by key
+    //
+
+    std::vector<AutoBalanceCachedLevelProfile> profileSection;
+    std::vector<AutoBalanceCachedLevelBucket> bucketSection;
+
+    for (auto const& [key, profile] : levelProfiles)
+    {
+        AutoBalanceCachedLevelProfile cachedProfile;
+        cachedProfile.key           = key;
+        cachedProfile.creatureCount = profile.creatureCount;
+        cachedProfile.bossCount     = (uint32_t)profile.bossEntries.size();
+        cachedProfile.firstBucket   = (uint32_t)bucketSection.size();
+        cachedProfile.bucketCount   = (uint32_t)profile.levelHistogram.size();
+        profileSection.push_back(cachedProfile);
+
+        for (auto const& [level, count] : profile.levelHistogram)
+        {
+            AutoBalanceCachedLevelBucket bucket;
+            bucket.level = level;
+            bucket.count = count;
+            bucketSection.push_back(bucket);
+        }
+    }
+
+    std::vector<AutoBalanceCachedMultiplierTable> tableSection;
+    std::vector<StatMultiplierDisplay> rowSection;
+
+    for (auto const& [key, rows] : multiplierTables)
+    {
+        AutoBalanceCachedMultiplierTable table;
+        table.key        = key;
+        table.maxPlayers = (uint32_t)(rows.size() / 2);
+        table.firstRow   = (uint32_t)rowSection.size();
+        tableSection.push_back(table);
+
+        rowSection.insert(rowSection.end(), rows.begin(), rows.end());
+    }
+
+    //
+    // Header, then the sections in file order
+    //
+
+    std::vector<uint8_t> data(sizeof(AutoBalancePrecomputeCacheHeader));
+    _AppendSection(data, profileSection);
+    _AppendSection(data, bucketSection);
+    _AppendSection(data, tableSection);
+    _AppendSection(data, rowSection);
+    _AppendSection(data, baseValues);
+
+    AutoBalancePrecomputeCacheHeader header;
+    header.keyHash              = keyHash;
+    header.payloadSize          = data.size() - sizeof(header);
+    header.levelProfileCount    = (uint32_t)profileSection.size();
+    header.levelBucketCount     = (uint32_t)bucketSection.size();
+    header.multiplierTableCount = (uint32_t)tableSection.size();
+    header.multiplierRowCount   = (uint32_t)rowSection.size();
+
+    AutoBalanceCacheHasher checksum;
+    checksum.Add(data.data() + sizeof(header), header.payloadSize);
+    header.checksum = checksum.GetHash();
+
+    std::memcpy(data.data(), &header, sizeof(header));
+
+    return data;
+}
+
+//
+// Cache
+//
+
+bool AutoBalancePrecomputeCache::Attach(uint8_t const* data, std::size_t dataSize, uint64_t keyHash, std::string& error)
+{
+    //
+    // Header
+    //
+
+    if (dataSize < sizeof(AutoBalancePrecomputeCacheHeader))
+    {
+        error = "the file is too small to hold a header";
+        return false;
+    }
+
+    AutoBalancePrecomputeCacheHeader const* fileHeader = reinterpret_cast<AutoBalancePrecomputeCacheHeader const*>(data);
+
+    if (fileHeader->magic != AUTOBALANCE_PRECOMPUTE_CACHE_MAGIC)
+    {
+        error = "the file is not a precompute cache";
+        return false;
+    }
+
+    if (fileHeader->version != AUTOBALANCE_PRECOMPUTE_CACHE_VERSION)
+    {
+        error = "the file is version " + std::to_string(fileHeader->version) + ", expected version " + std::to_string(AUTOBALANCE_PRECOMPUTE_CACHE_VERSION);
+        return false;
+    }
+
+    if (fileHeader->keyHash != keyHash)
+    {
+        error = "the file was built for a different config or world data";
+        return false;
+    }
+
+    //
+    // Sections
+    //
+
+    uint64_t expectedPayloadSize =
+        (uint64_t)fileHeader->levelProfileCount    * sizeof(AutoBalanceCachedLevelProfile) +
+        (uint64_t)fileHeader->levelBucketCount     * sizeof(AutoBalanceCachedLevelBucket) +
+        (uint64_t)fileHeader->multiplierTableCount * sizeof(AutoBalanceCachedMultiplierTable) +
+        (uint64_t)fileHeader->multiplierRowCount   * sizeof(StatMultiplierDisplay) +
+        (uint64_t)AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT * AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT * sizeof(AutoBalanceCachedBaseValues);
+
+    if (fileHeader->payloadSize != dataSize - sizeof(AutoBalancePrecomputeCacheHeader) || fileHeader->payloadSize != expectedPayloadSize)
+    {
+        error = "the file is truncated or its section sizes don't match";
+        return false;
+    }
+
+    AutoBalanceCacheHasher checksum;
+    checksum.Add(data + sizeof(AutoBalancePrecomputeCacheHeader), fileHeader->payloadSize);
+    if (checksum.GetHash() != fileHeader->checksum)
+    {
+        error = "the file's checksum doesn't match its contents";
+        return false;
+    }
+
+    uint8_t const* section = data + sizeof(AutoBalancePrecomputeCacheHeader);
+
+    AutoBalanceCachedLevelProfile const* fileLevelProfiles = reinterpret_cast<AutoBalanceCachedLevelProfile const*>(section);
+    section += fileHeader->levelProfileCount * sizeof(AutoBalanceCachedLevelProfile);
+
+    AutoBalanceCachedLevelBucket const* fileLevelBuckets = reinterpret_cast<AutoBalanceCachedLevelBucket const*>(section);
+    section += fileHeader->levelBucketCount * sizeof(AutoBalanceCachedLevelBucket);
+
+    AutoBalanceCachedMultiplierTable const* fileMultiplierTables = reinterpret_cast<AutoBalanceCachedMultiplierTable const*>(section);
+    section += fileHeader->multiplierTableCount * sizeof(AutoBalanceCachedMultiplierTable);
+
+    StatMultiplierDisplay const* fileMultiplierRows = reinterpret_cast<StatMultiplierDisplay const*>(section);
+    section += fileHeader->multiplierRowCount * sizeof(StatMultiplierDisplay);
+
+    AutoBalanceCachedBaseValues const* fileBaseValues = reinterpret_cast<AutoBalanceCachedBaseValues const*>(section);
+
+    //
+    // The lookups index by these without checking again
+    //
+
+    for (uint32_t i = 0; i < fileHeader->levelProfileCount; ++i)
+    {
+        AutoBalanceCachedLevelProfile const& profile = fileLevelProfiles[i];
+
+        if ((uint64_t)profile.firstBucket + profile.bucketCount > fileHeader->levelBucketCount || (i && profile.key <= fileLevelProfiles[i - 1].key))
+        {
+            error = "the file's level profiles are out of range or out of order";
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < fileHeader->multiplierTableCount; ++i)
+    {
+        AutoBalanceCachedMultiplierTable const& table = fileMultiplierTables[i];
+
+        if ((uint64_t)table.firstRow + (uint64_t)table.maxPlayers * 2 > fileHeader->multiplierRowCount || (i && table.key <= fileMultiplierTables[i - 1].key))
+        {
+            error = "the file's multiplier tables are out of range or out of order";
+            return false;
+        }
+    }
+
+    header           = fileHeader;
+    levelProfiles    = fileLevelProfiles;
+    levelBuckets     = fileLevelBuckets;
+    multiplierTables = fileMultiplierTables;
+    multiplierRows   = fileMultiplierRows;
+    baseValues       = fileBaseValues;
+    size             = dataSize;
+
+    return true;
+}
+
+bool AutoBalancePrecomputeCache::Map(std::string const& fileName, uint64_t keyHash, std::string& error)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        error = GetLastError() == ERROR_FILE_NOT_FOUND ? "the file doesn't exist" : "the file could not be opened";
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || !fileSize.QuadPart)
+    {
+        CloseHandle(file);
+        error = "the file is empty";
+        return false;
+    }
+
+    HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = fileMapping ? MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    // the view keeps the file mapped on its own
+    if (fileMapping)
+        CloseHandle(fileMapping);
+    CloseHandle(file);
+
+    if (!view)
+    {
+        error = "the file could not be mapped";
+        return false;
+    }
+
+    std::size_t viewSize = (std::size_t)fileSize.QuadPart;
+#else
+    int file = open(fileName.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        error = errno == ENOENT ? "the file doesn't exist" : std::string("the file could not be opened: ") + std::strerror(errno);
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(file);
+        error = "the file is empty";
+        return false;
+    }
+
+    std::size_t viewSize = (std::size_t)fileStat.st_size;
+    void* view = mmap(nullptr, viewSize, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // the mapping keeps the file open on its own
+    close(file);
+
+    if (view == MAP_FAILED)
+    {
+        error = std::string("the file could not be mapped: ") + std::strerror(errno);
+        return false;
+    }
+#endif
+
+    mapping = view;
+    size    = viewSize;
+
+    if (!Attach(static_cast<uint8_t const*>(view), viewSize, keyHash, error))
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+bool AutoBalancePrecomputeCache::Load(std::vector<uint8_t> data, uint64_t keyHash, std::string& error)
+{
+    Close();
+
+    buffer = std::move(data);
+
+    if (!Attach(buffer.data(), buffer.size(), keyHash, error))
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void AutoBalancePrecomputeCache::Close()
+{
+    if (mapping)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping);
+#else
+        munmap(mapping, size);
+#endif
+        mapping = nullptr;
+    }
+
+    buffer.clear();
+    buffer.shrink_to_fit();
+    size = 0;
+
+    header           = nullptr;
+    levelProfiles    = nullptr;
+    levelBuckets     = nullptr;
+    multiplierTables = nullptr;
+    multiplierRows   = nullptr;
+    baseValues       = nullptr;
+}
+
+AutoBalanceCachedLevelProfile const* AutoBalancePrecomputeCache::FindLevelProfile(uint32_t key) const
+{
+    if (!header)
+        return nullptr;
+
+    AutoBalanceCachedLevelProfile const* end = levelProfiles + header->levelProfileCount;
+    AutoBalanceCachedLevelProfile const* profile = std::lower_bound(levelProfiles, end, key,
+        [](AutoBalanceCachedLevelProfile const& candidate, uint32_t searchKey) { return candidate.key < searchKey; });
+
+    return (profile != end && profile->key == key) ? profile : nullptr;
+}
+
+StatMultiplierDisplay const* AutoBalancePrecomputeCache::FindDisplayMultipliers(uint32_t key, uint32_t playerCount, bool isBoss) const
+{
+    if (!header)
+        return nullptr;
+
+    AutoBalanceCachedMultiplierTable const* end = multiplierTables + header->multiplierTableCount;
+    AutoBalanceCachedMultiplierTable const* table = std::lower_bound(multiplierTables, end, key,
+        [](AutoBalanceCachedMultiplierTable const& candidate, uint32_t searchKey) { return candidate.key < searchKey; });
+
+    if (table == end || table->key != key || playerCount < 1 || playerCount > table->maxPlayers)
+        return nullptr;
+
+    return &multiplierRows[table->firstRow + (playerCount - 1) * 2 + (isBoss ? 1 : 0)];
+}
+
+AutoBalanceCachedBaseValues const* AutoBalancePrecomputeCache::GetBaseValues(uint32_t classIndex, uint8_t level) const
+{
+    if (!header || classIndex >= AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT)
+        return nullptr;
+
+    return &baseValues[classIndex * AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT + level];
+}
+
+//
+// File
+//
+
+bool writePrecomputeCache(std::string const& fileName, std::vector<uint8_t> const& data, std::string& error)
+{
+    std::string temporaryFileName = fileName + ".tmp";
+
+    FILE* file = fopen(temporaryFileName.c_str(), "wb");
+    if (!file)
+    {
+        error = "could not open `" + temporaryFileName + "` for writing: " + std::strerror(errno);
+        return false;
+    }
+
+    bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    written = (fclose(file) == 0) && written;
+
+    if (!written)
+    {
+        error = "could not write `" + temporaryFileName + "`";
+        std::remove(temporaryFileName.c_str());
+        return false;
+    }
+
+#ifdef _WIN32
+    // rename doesn't replace an existing file on Windows
+    std::remove(fileName.c_str());
+#endif
+
+    if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0)
+    {
+        error = "could not rename `" + temporaryFileName + "` to `" + fileName + "`: " + std::strerror(errno);
+        std::remove(temporaryFileName.c_str());
+        return false;
+    }
+
+    return true;
+}
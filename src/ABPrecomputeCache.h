@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_PRECOMPUTE_CACHE_H
+#define __AB_PRECOMPUTE_CACHE_H
+
+#include "ABScalingCore.h"
+#include "ABScalingSettings.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//
+// The data AutoBalance builds at startup, as one flat block that can be written to a file and mapped back read-only
+//
+//  - level profiles: each instance map and difficulty's spawn level histogram and boss count
+//  - multiplier tables: each map descriptor's display multipliers for every whole player count, for creatures and bosses
+//  - base values: the creature base health and damage of each class at each level, as used to level scale the world multiplier
+//
+// The file starts with an AutoBalancePrecomputeCacheHeader followed by the sections in that order. The header holds a
+// hash of the config and data the sections were built from, and a checksum of the sections; a file whose version,
+// key or checksum doesn't match is rebuilt. Bump the version when the layout or the math behind the tables changes.
+//
+
+#define AUTOBALANCE_PRECOMPUTE_CACHE_MAGIC       0x43504241 // "ABPC"
+#define AUTOBALANCE_PRECOMPUTE_CACHE_VERSION     1
+#define AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT 4          // warrior, paladin, rogue and mage, the classes with creature base stats
+#define AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT 256
+
+enum Precompute_Cache_Class : uint32_t
+{
+    AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_WARRIOR = 0,
+    AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_PALADIN = 1,
+    AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_ROGUE   = 2,
+    AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_MAGE    = 3
+};
+
+struct AutoBalancePrecomputeCacheHeader
+{
+    uint32_t magic                = AUTOBALANCE_PRECOMPUTE_CACHE_MAGIC;
+    uint32_t version              = AUTOBALANCE_PRECOMPUTE_CACHE_VERSION;
+    uint64_t keyHash              = 0;     // AutoBalanceCacheHasher over the config and data the sections were built from
+    uint64_t checksum             = 0;     // AutoBalanceCacheHasher over everything after the header
+    uint64_t payloadSize          = 0;     // Bytes after the header
+    uint32_t levelProfileCount    = 0;
+    uint32_t levelBucketCount     = 0;
+    uint32_t multiplierTableCount = 0;
+    uint32_t multiplierRowCount   = 0;
+};
+
+struct AutoBalanceCachedLevelProfile
+{
+    uint32_t key                  = 0;     // MAKE_PAIR32(mapId, difficulty), the profiles are sorted by it
+    uint32_t creatureCount        = 0;     // Spawns counted in the histogram
+    uint32_t bossCount            = 0;     // Distinct creature entries flagged as dungeon or world bosses
+    uint32_t firstBucket          = 0;     // The profile's histogram, sorted by level
+    uint32_t bucketCount          = 0;
+};
+
+struct AutoBalanceCachedLevelBucket
+{
+    uint32_t level                = 0;
+    uint32_t count                = 0;     // Spawns at this level
+};
+
+struct AutoBalanceCachedMultiplierTable
+{
+    uint32_t key                  = 0;     // MAKE_PAIR32(mapId, difficulty), the tables are sorted by it
+    uint32_t maxPlayers           = 0;
+    uint32_t firstRow             = 0;     // Rows for 1 to maxPlayers players, creature then boss
+};
+
+struct AutoBalanceCachedBaseValues
+{
+    float    health               = 0.0f;  // getBaseExpansionValueForLevel of the base health at the level
+    float    damage               = 0.0f;  // getBaseExpansionValueForLevel of the base damage at the level
+};
+
+// What the level profiles are built from, one per spawn and difficulty it spawns in
+struct AutoBalanceProfileSpawn
+{
+    uint32_t key                  = 0;     // MAKE_PAIR32(mapId, difficulty)
+    uint32_t entry                = 0;     // The creature template spawned in the difficulty
+    uint8_t  level                = 0;     // The average of the template's min and max level, rounded
+    uint8_t  isBoss               = 0;
+    uint16_t padding              = 0;     // Keeps the struct free of uninitialized padding so it can be hashed as bytes
+};
+
+static_assert(sizeof(AutoBalancePrecomputeCacheHeader) == 48, "AutoBalancePrecomputeCacheHeader must not have padding");
+static_assert(sizeof(StatMultiplierDisplay) == 8, "StatMultiplierDisplay is stored as-is in the multiplier tables");
+static_assert(sizeof(AutoBalanceProfileSpawn) == 12, "AutoBalanceProfileSpawn must not have padding");
+
+// 64-bit FNV-1a, used for both the cache key and the checksum
+class AutoBalanceCacheHasher
+{
+public:
+    void Add(void const* data, std::size_t size);
+    void Add(std::string const& value);
+
+    template<typename T>
+    void Add(T const& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be hashed as bytes");
+        Add(&value, sizeof(value));
+    }
+
+    uint64_t GetHash() const { return hash; }
+
+private:
+    uint64_t hash = 14695981039346656037ULL;
+};
+
+class AutoBalancePrecomputeCacheBuilder
+{
+public:
+    void AddLevelProfileSpawn(AutoBalanceProfileSpawn const& spawn);
+
+    // Calculates the map's display multipliers for 1 to map.maxPlayers players
+    void AddMultiplierTable(uint32_t key, AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map);
+
+    void SetBaseValues(uint32_t classIndex, uint8_t level, AutoBalanceCachedBaseValues const& baseValues);
+
+    // The header and sections, ready to be written or loaded
+    std::vector<uint8_t> Build(uint64_t keyHash) const;
+
+private:
+    struct LevelProfile
+    {
+        std::map<uint8_t, uint32_t> levelHistogram;
+        std::set<uint32_t>          bossEntries;
+        uint32_t                    creatureCount = 0;
+    };
+
+    std::map<uint32_t, LevelProfile>                       levelProfiles;
+    std::map<uint32_t, std::vector<StatMultiplierDisplay>> multiplierTables;
+    std::vector<AutoBalanceCachedBaseValues>               baseValues = std::vector<AutoBalanceCachedBaseValues>(AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT * AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT);
+};
+
+// A validated, read-only view of the cache, either mapped from its file or over a freshly built block
+class AutoBalancePrecomputeCache
+{
+public:
+    AutoBalancePrecomputeCache() {}
+    ~AutoBalancePrecomputeCache() { Close(); }
+
+    AutoBalancePrecomputeCache(AutoBalancePrecomputeCache const&) = delete;
+    AutoBalancePrecomputeCache& operator=(AutoBalancePrecomputeCache const&) = delete;
+
+    // Both fail, with the reason in error, if the data isn't a complete cache built for keyHash
+    bool Map(std::string const& fileName, uint64_t keyHash, std::string& error);
+    bool Load(std::vector<uint8_t> data, uint64_t keyHash, std::string& error);
+    void Close();
+
+    bool        IsLoaded() const { return header != nullptr; }
+    bool        IsMapped() const { return mapping != nullptr; }
+    std::size_t GetSize() const { return size; }
+    uint32_t    GetLevelProfileCount() const { return header ? header->levelProfileCount : 0; }
+    uint32_t    GetMultiplierTableCount() const { return header ? header->multiplierTableCount : 0; }
+
+    AutoBalanceCachedLevelProfile const* FindLevelProfile(uint32_t key) const;
+    AutoBalanceCachedLevelBucket const*  GetLevelBuckets(AutoBalanceCachedLevelProfile const& profile) const { return levelBuckets + profile.firstBucket; }
+
+    // nullptr if the map has no table or playerCount is outside of 1 to its max players
+    StatMultiplierDisplay const*         FindDisplayMultipliers(uint32_t key, uint32_t playerCount, bool isBoss) const;
+
+    AutoBalanceCachedBaseValues const*   GetBaseValues(uint32_t classIndex, uint8_t level) const;
+
+private:
+    bool Attach(uint8_t const* data, std::size_t dataSize, uint64_t keyHash, std::string& error);
+
+    std::vector<uint8_t>                    buffer;                      // The data when it was loaded rather than mapped
+    void*                                   mapping          = nullptr;  // The file's view when it was mapped
+    std::size_t                             size             = 0;
+
+    AutoBalancePrecomputeCacheHeader const* header           = nullptr;
+    AutoBalanceCachedLevelProfile const*    levelProfiles    = nullptr;
+    AutoBalanceCachedLevelBucket const*     levelBuckets     = nullptr;
+    AutoBalanceCachedMultiplierTable const* multiplierTables = nullptr;
+    StatMultiplierDisplay const*            multiplierRows   = nullptr;
+    AutoBalanceCachedBaseValues const*      baseValues       = nullptr;
+};
+
+// Writes to a temporary file and renames it over fileName, so a crash never leaves a partial cache behind
+bool writePrecomputeCache(std::string const& fileName, std::vector<uint8_t> const& data, std::string& error);
+
+#endif
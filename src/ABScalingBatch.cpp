@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingBatch.h"
+
+#if !defined(AUTOBALANCE_BATCH_NO_SIMD) && defined(__AVX2__)
+#define AUTOBALANCE_BATCH_AVX2
+#include <immintrin.h>
+#elif !defined(AUTOBALANCE_BATCH_NO_SIMD) && defined(__SSE2__)
+#define AUTOBALANCE_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+void AutoBalanceCreatureBatch::Clear()
+{
+    for (std::vector<float>* input : { &curveHealth, &curveMana, &curveArmor, &curveDamage, &defaultMultiplier,
+                                       &statModifierGlobal, &statModifierHealth, &statModifierMana, &statModifierArmor, &statModifierDamage, &statModifierCCDuration,
+                                       &baseHealth, &baseMana, &baseArmor, &healthLevelRatio, &manaLevelRatio, &armorLevelRatio, &damageLevelRatio })
+        input->clear();
+}
+
+void AutoBalanceCreatureBatch::Reserve(std::size_t count)
+{
+    for (std::vector<float>* input : { &curveHealth, &curveMana, &curveArmor, &curveDamage, &defaultMultiplier,
+                                       &statModifierGlobal, &statModifierHealth, &statModifierMana, &statModifierArmor, &statModifierDamage, &statModifierCCDuration,
+                                       &baseHealth, &baseMana, &baseArmor, &healthLevelRatio, &manaLevelRatio, &armorLevelRatio, &damageLevelRatio })
+        input->reserve(count);
+}
+
+void AutoBalanceCreatureBatch::Resize(std::size_t count)
+{
+    for (std::vector<float>* input : { &curveHealth, &curveMana, &curveArmor, &curveDamage, &defaultMultiplier,
+                                       &statModifierGlobal, &statModifierHealth, &statModifierMana, &statModifierArmor, &statModifierDamage, &statModifierCCDuration,
+                                       &baseHealth, &baseMana, &baseArmor, &healthLevelRatio, &manaLevelRatio, &armorLevelRatio, &damageLevelRatio })
+        input->resize(count);
+}
+
+void AutoBalanceCreatureBatch::Set(std::size_t index, CreatureCurveMultipliers const& curveMultipliers, AutoBalanceScalingCreature const& creature)
+{
+    curveHealth[index]            = curveMultipliers.health;
+    curveMana[index]              = curveMultipliers.mana;
+    curveArmor[index]             = curveMultipliers.armor;
+    curveDamage[index]            = curveMultipliers.damage;
+    defaultMultiplier[index]      = creature.defaultMultiplier;
+    statModifierGlobal[index]     = creature.statModifiers.global;
+    statModifierHealth[index]     = creature.statModifiers.health;
+    statModifierMana[index]       = creature.statModifiers.mana;
+    statModifierArmor[index]      = creature.statModifiers.armor;
+    statModifierDamage[index]     = creature.statModifiers.damage;
+    statModifierCCDuration[index] = creature.statModifiers.ccduration;
+    baseHealth[index]             = creature.baseHealth;
+    baseMana[index]               = creature.baseMana;
+    baseArmor[index]              = creature.baseArmor;
+    healthLevelRatio[index]       = creature.healthLevelRatio;
+    manaLevelRatio[index]         = creature.manaLevelRatio;
+    armorLevelRatio[index]        = creature.armorLevelRatio;
+    damageLevelRatio[index]       = creature.damageLevelRatio;
+}
+
+AutoBalanceCreatureMultipliers AutoBalanceCreatureBatch::Get(std::size_t index) const
+{
+    AutoBalanceCreatureMultipliers multipliers;
+
+    multipliers.health                 = health[index];
+    multipliers.mana                   = mana[index];
+    multipliers.armor                  = armor[index];
+    multipliers.healthMultiplier       = healthMultiplier[index];
+    multipliers.scaledHealthMultiplier = scaledHealthMultiplier[index];
+    multipliers.manaMultiplier         = manaMultiplier[index];
+    multipliers.scaledManaMultiplier   = scaledManaMultiplier[index];
+    multipliers.armorMultiplier        = armorMultiplier[index];
+    multipliers.scaledArmorMultiplier  = scaledArmorMultiplier[index];
+    multipliers.damageMultiplier       = damageMultiplier[index];
+    multipliers.scaledDamageMultiplier = scaledDamageMultiplier[index];
+    multipliers.ccDurationMultiplier   = ccDurationMultiplier[index];
+    multipliers.xpModifier             = xpModifier[index];
+    multipliers.moneyModifier          = moneyModifier[index];
+
+    return multipliers;
+}
+
+//
+// The creatures from begin onwards, one at a time through the scalar core
+// Used for the creatures that don't fill a whole vector, and for every creature when there is no SIMD support
+//
+
+static void calculateCreatureMultipliersRange(AutoBalanceScalingSettings const& settings, AutoBalanceCreatureBatch& batch, std::size_t begin)
+{
+    for (std::size_t i = begin; i < batch.Size(); ++i)
+    {
+        CreatureCurveMultipliers curveMultipliers = { batch.curveHealth[i], batch.curveMana[i], batch.curveArmor[i], batch.curveDamage[i] };
+
+        AutoBalanceScalingCreature creature;
+        creature.defaultMultiplier = batch.defaultMultiplier[i];
+        creature.statModifiers     = AutoBalanceStatModifiers(batch.statModifierGlobal[i], batch.statModifierHealth[i], batch.statModifierMana[i],
+                                                              batch.statModifierArmor[i], batch.statModifierDamage[i], batch.statModifierCCDuration[i]);
+        creature.baseHealth        = batch.baseHealth[i];
+        creature.baseMana          = batch.baseMana[i];
+        creature.baseArmor         = batch.baseArmor[i];
+        creature.healthLevelRatio  = batch.healthLevelRatio[i];
+        creature.manaLevelRatio    = batch.manaLevelRatio[i];
+        creature.armorLevelRatio   = batch.armorLevelRatio[i];
+        creature.damageLevelRatio  = batch.damageLevelRatio[i];
+
+        AutoBalanceCreatureMultipliers multipliers = calculateCreatureMultipliers(settings, curveMultipliers, creature);
+
+        batch.health[i]                 = multipliers.health;
+        batch.mana[i]                   = multipliers.mana;
+        batch.armor[i]                  = multipliers.armor;
+        batch.healthMultiplier[i]       = multipliers.healthMultiplier;
+        batch.scaledHealthMultiplier[i] = multipliers.scaledHealthMultiplier;
+        batch.manaMultiplier[i]         = multipliers.manaMultiplier;
+        batch.scaledManaMultiplier[i]   = multipliers.scaledManaMultiplier;
+        batch.armorMultiplier[i]        = multipliers.armorMultiplier;
+        batch.scaledArmorMultiplier[i]  = multipliers.scaledArmorMultiplier;
+        batch.damageMultiplier[i]       = multipliers.damageMultiplier;
+        batch.scaledDamageMultiplier[i] = multipliers.scaledDamageMultiplier;
+        batch.ccDurationMultiplier[i]   = multipliers.ccDurationMultiplier;
+        batch.xpModifier[i]             = multipliers.xpModifier;
+        batch.moneyModifier[i]          = multipliers.moneyModifier;
+    }
+}
+
+#if defined(AUTOBALANCE_BATCH_AVX2) || defined(AUTOBALANCE_BATCH_SSE2)
+
+//
+// The few vector operations the kernel needs
+// Comparisons return a mask; Select(mask, a, b) is mask ? a : b per lane
+//
+
+#if defined(AUTOBALANCE_BATCH_AVX2)
+
+struct BatchVector { __m256 v; };
+static constexpr std::size_t batchVectorWidth = 8;
+
+static inline BatchVector Load(float const* values)               { return { _mm256_loadu_ps(values) }; }
+static inline void        Store(float* values, BatchVector a)     { _mm256_storeu_ps(values, a.v); }
+static inline BatchVector Set(float value)                        { return { _mm256_set1_ps(value) }; }
+static inline BatchVector Mul(BatchVector a, BatchVector b)       { return { _mm256_mul_ps(a.v, b.v) }; }
+static inline BatchVector Add(BatchVector a, BatchVector b)       { return { _mm256_add_ps(a.v, b.v) }; }
+static inline BatchVector Sub(BatchVector a, BatchVector b)       { return { _mm256_sub_ps(a.v, b.v) }; }
+static inline BatchVector Div(BatchVector a, BatchVector b)       { return { _mm256_div_ps(a.v, b.v) }; }
+static inline BatchVector LessEqual(BatchVector a, BatchVector b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+static inline BatchVector GreaterEqual(BatchVector a, BatchVector b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+static inline BatchVector Less(BatchVector a, BatchVector b)      { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+static inline BatchVector Greater(BatchVector a, BatchVector b)   { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+static inline BatchVector Equal(BatchVector a, BatchVector b)     { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+static inline BatchVector NotEqual(BatchVector a, BatchVector b)  { return { _mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ) }; }
+static inline BatchVector Select(BatchVector mask, BatchVector a, BatchVector b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+static inline BatchVector Truncate(BatchVector a)                 { return { _mm256_round_ps(a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) }; }
+
+// Truncates to uint32 like a scalar float to uint32 conversion, values of 2^31 and above go through the sign bit
+static inline void StoreUInt32(uint32_t* values, BatchVector a)
+{
+    __m256 const signBit = _mm256_set1_ps(2147483648.0f);
+    __m256 const large   = _mm256_cmp_ps(a.v, signBit, _CMP_GE_OQ);
+    __m256i const low    = _mm256_cvttps_epi32(_mm256_blendv_ps(a.v, _mm256_sub_ps(a.v, signBit), large));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), _mm256_xor_si256(low, _mm256_and_si256(_mm256_castps_si256(large), _mm256_set1_epi32(INT32_MIN))));
+}
+
+#else
+
+struct BatchVector { __m128 v; };
+static constexpr std::size_t batchVectorWidth = 4;
+
+static inline BatchVector Load(float const* values)               { return { _mm_loadu_ps(values) }; }
+static inline void        Store(float* values, BatchVector a)     { _mm_storeu_ps(values, a.v); }
+static inline BatchVector Set(float value)                        { return { _mm_set1_ps(value) }; }
+static inline BatchVector Mul(BatchVector a, BatchVector b)       { return { _mm_mul_ps(a.v, b.v) }; }
+static inline BatchVector Add(BatchVector a, BatchVector b)       { return { _mm_add_ps(a.v, b.v) }; }
+static inline BatchVector Sub(BatchVector a, BatchVector b)       { return { _mm_sub_ps(a.v, b.v) }; }
+static inline BatchVector Div(BatchVector a, BatchVector b)       { return { _mm_div_ps(a.v, b.v) }; }
+static inline BatchVector LessEqual(BatchVector a, BatchVector b) { return { _mm_cmple_ps(a.v, b.v) }; }
+static inline BatchVector GreaterEqual(BatchVector a, BatchVector b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+static inline BatchVector Less(BatchVector a, BatchVector b)      { return { _mm_cmplt_ps(a.v, b.v) }; }
+static inline BatchVector Greater(BatchVector a, BatchVector b)   { return { _mm_cmpgt_ps(a.v, b.v) }; }
+static inline BatchVector Equal(BatchVector a, BatchVector b)     { return { _mm_cmpeq_ps(a.v, b.v) }; }
+static inline BatchVector NotEqual(BatchVector a, BatchVector b)  { return { _mm_cmpneq_ps(a.v, b.v) }; }
+static inline BatchVector Select(BatchVector mask, BatchVector a, BatchVector b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+
+// SSE2 has no round instruction: values of 2^23 and above are already whole, the rest fit in an int32
+static inline BatchVector Truncate(BatchVector a)
+{
+    __m128 const whole = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v), _mm_set1_ps(8388608.0f));
+    return Select({ whole }, a, { _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v)) });
+}
+
+// Truncates to uint32 like a scalar float to uint32 conversion, values of 2^31 and above go through the sign bit
+static inline void StoreUInt32(uint32_t* values, BatchVector a)
+{
+    __m128 const signBit = _mm_set1_ps(2147483648.0f);
+    __m128 const large   = _mm_cmpge_ps(a.v, signBit);
+    __m128i const low    = _mm_cvttps_epi32(Select({ large }, { _mm_sub_ps(a.v, signBit) }, a).v);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm_xor_si128(low, _mm_and_si128(_mm_castps_si128(large), _mm_set1_epi32(INT32_MIN))));
+}
+
+#endif
+
+// std::round: halfway cases away from zero
+// The fraction a - Truncate(a) is exact, so unlike adding 0.5 this is also right just below the halfway point
+static inline BatchVector Round(BatchVector a)
+{
+    BatchVector const zero      = Set(0.0f);
+    BatchVector const truncated = Truncate(a);
+    BatchVector const fraction  = Sub(a, truncated);
+
+    BatchVector step = Select(GreaterEqual(fraction, Set(0.5f)), Set(1.0f), zero);
+    step             = Select(LessEqual(fraction, Set(-0.5f)), Set(-1.0f), step);
+
+    return Add(truncated, step);
+}
+
+//
+// The same steps as calculateCreatureMultipliers, batchVectorWidth creatures at a time
+// Returns the index of the first creature that was not calculated
+//
+
+static std::size_t calculateCreatureMultipliersVector(AutoBalanceScalingSettings const& settings, AutoBalanceCreatureBatch& batch)
+{
+    BatchVector const zero                  = Set(0.0f);
+    BatchVector const one                   = Set(1.0f);
+    BatchVector const two                   = Set(2.0f);
+    BatchVector const unchanged             = Set(-1.0f);
+    BatchVector const minHPModifier         = Set(settings.minHPModifier);
+    BatchVector const minManaModifier       = Set(settings.minManaModifier);
+    BatchVector const minDamageModifier     = Set(settings.minDamageModifier);
+    BatchVector const minCCDurationModifier = Set(settings.minCCDurationModifier);
+    BatchVector const maxCCDurationModifier = Set(settings.maxCCDurationModifier);
+    BatchVector const xpModifier            = Set(settings.rewardScalingXPModifier);
+    BatchVector const moneyModifier         = Set(settings.rewardScalingMoneyModifier);
+
+    std::size_t i = 0;
+
+    for (; i + batchVectorWidth <= batch.Size(); i += batchVectorWidth)
+    {
+        BatchVector global = Load(&batch.statModifierGlobal[i]);
+
+        // Health, can't be less than MinHPModifier
+        BatchVector healthMultiplier = Mul(Mul(Load(&batch.curveHealth[i]), global), Load(&batch.statModifierHealth[i]));
+        healthMultiplier             = Select(LessEqual(healthMultiplier, minHPModifier), minHPModifier, healthMultiplier);
+        BatchVector scaledHealth     = Mul(healthMultiplier, Load(&batch.healthLevelRatio[i]));
+
+        // Mana, can't be less than MinManaModifier; creatures without mana keep none
+        BatchVector hasMana        = NotEqual(Load(&batch.baseMana[i]), zero);
+        BatchVector manaMultiplier = Mul(Mul(Load(&batch.curveMana[i]), global), Load(&batch.statModifierMana[i]));
+        manaMultiplier             = Select(LessEqual(manaMultiplier, minManaModifier), minManaModifier, manaMultiplier);
+        BatchVector scaledMana     = Select(hasMana, Mul(manaMultiplier, Load(&batch.manaLevelRatio[i])), zero);
+        manaMultiplier             = Select(hasMana, manaMultiplier, zero);
+
+        // Armor, no minimum
+        BatchVector armorMultiplier = Mul(Mul(Load(&batch.curveArmor[i]), global), Load(&batch.statModifierArmor[i]));
+        BatchVector scaledArmor     = Mul(armorMultiplier, Load(&batch.armorLevelRatio[i]));
+
+        // Damage, can't be less than MinDamageModifier
+        BatchVector damageMultiplier = Mul(Mul(Load(&batch.curveDamage[i]), global), Load(&batch.statModifierDamage[i]));
+        damageMultiplier             = Select(LessEqual(damageMultiplier, minDamageModifier), minDamageModifier, damageMultiplier);
+        BatchVector scaledDamage     = Mul(damageMultiplier, Load(&batch.damageLevelRatio[i]));
+
+        // Crowd Control Debuff Duration, clamped; a modifier of -1 leaves durations unchanged
+        BatchVector ccModifier    = Load(&batch.statModifierCCDuration[i]);
+        BatchVector ccMultiplier  = Mul(Load(&batch.defaultMultiplier[i]), ccModifier);
+        BatchVector ccDuration    = Select(Greater(ccMultiplier, maxCCDurationModifier), maxCCDurationModifier, ccMultiplier);
+        ccDuration                = Select(Less(ccMultiplier, minCCDurationModifier), minCCDurationModifier, ccDuration);
+        ccDuration                = Select(Equal(ccModifier, unchanged), one, ccDuration);
+
+        // Reward Scaling, from the average of the level scaled health and damage multipliers
+        BatchVector avgHealthDamageMultipliers = Div(Add(scaledHealth, scaledDamage), two);
+        BatchVector xp                         = one;
+        BatchVector money                      = one;
+
+        if (settings.rewardScalingXP)
+        {
+            if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
+                xp = xpModifier;
+            else if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+                xp = Mul(avgHealthDamageMultipliers, xpModifier);
+        }
+
+        if (settings.rewardScalingMoney)
+        {
+            if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
+                money = moneyModifier;
+            else if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+                money = Mul(avgHealthDamageMultipliers, moneyModifier);
+        }
+
+        // Final values; creatures without mana have a scaled mana multiplier of 0 so they keep 0 mana
+        StoreUInt32(&batch.health[i], Round(Mul(Load(&batch.baseHealth[i]), scaledHealth)));
+        StoreUInt32(&batch.mana[i], Round(Mul(Load(&batch.baseMana[i]), scaledMana)));
+        StoreUInt32(&batch.armor[i], Round(Mul(Load(&batch.baseArmor[i]), scaledArmor)));
+
+        Store(&batch.healthMultiplier[i], healthMultiplier);
+        Store(&batch.scaledHealthMultiplier[i], scaledHealth);
+        Store(&batch.manaMultiplier[i], manaMultiplier);
+        Store(&batch.scaledManaMultiplier[i], scaledMana);
+        Store(&batch.armorMultiplier[i], armorMultiplier);
+        Store(&batch.scaledArmorMultiplier[i], scaledArmor);
+        Store(&batch.damageMultiplier[i], damageMultiplier);
+        Store(&batch.scaledDamageMultiplier[i], scaledDamage);
+        Store(&batch.ccDurationMultiplier[i], ccDuration);
+        Store(&batch.xpModifier[i], xp);
+        Store(&batch.moneyModifier[i], money);
+    }
+
+    return i;
+}
+
+#endif
+
+void calculateCreatureMultipliersBatch(AutoBalanceScalingSettings const& settings, AutoBalanceCreatureBatch& batch)
+{
+    std::size_t count = batch.Size();
+
+    for (std::vector<uint32_t>* output : { &batch.health, &batch.mana, &batch.armor })
+        output->resize(count);
+
+    for (std::vector<float>* output : { &batch.healthMultiplier, &batch.scaledHealthMultiplier, &batch.manaMultiplier, &batch.scaledManaMultiplier,
+                                        &batch.armorMultiplier, &batch.scaledArmorMultiplier, &batch.damageMultiplier, &batch.scaledDamageMultiplier,
+                                        &batch.ccDurationMultiplier, &batch.xpModifier, &batch.moneyModifier })
+        output->resize(count);
+
+#if defined(AUTOBALANCE_BATCH_AVX2) || defined(AUTOBALANCE_BATCH_SSE2)
+    calculateCreatureMultipliersRange(settings, batch, calculateCreatureMultipliersVector(settings, batch));
+#else
+    calculateCreatureMultipliersRange(settings, batch, 0);
+#endif
+}
+
+char const* getCreatureBatchKernelName()
+{
+#if defined(AUTOBALANCE_BATCH_AVX2)
+    return "avx2";
+#elif defined(AUTOBALANCE_BATCH_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_SCALING_BATCH_H
+#define __AB_SCALING_BATCH_H
+
+#include "ABScalingCore.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//
+// calculateCreatureMultipliers for many creatures at once
+// The inputs and outputs are kept as one array per field so the kernel can work on 4 (SSE2) or 8 (AVX2) creatures per step
+// The results are identical to calling calculateCreatureMultipliers for each creature
+//
+
+class AutoBalanceCreatureBatch
+{
+public:
+    void Clear();
+    void Reserve(std::size_t count);
+    void Resize(std::size_t count);
+    std::size_t Size() const { return baseHealth.size(); }
+
+    // Fill the inputs of the creature at index, which must be less than Size()
+    void Set(std::size_t index, CreatureCurveMultipliers const& curveMultipliers, AutoBalanceScalingCreature const& creature);
+
+    // The results for the creature at index, once calculateCreatureMultipliersBatch has run
+    AutoBalanceCreatureMultipliers Get(std::size_t index) const;
+
+    // inputs
+    std::vector<float>    curveHealth;
+    std::vector<float>    curveMana;
+    std::vector<float>    curveArmor;
+    std::vector<float>    curveDamage;
+    std::vector<float>    defaultMultiplier;
+    std::vector<float>    statModifierGlobal;
+    std::vector<float>    statModifierHealth;
+    std::vector<float>    statModifierMana;
+    std::vector<float>    statModifierArmor;
+    std::vector<float>    statModifierDamage;
+    std::vector<float>    statModifierCCDuration;
+    std::vector<float>    baseHealth;
+    std::vector<float>    baseMana;
+    std::vector<float>    baseArmor;
+    std::vector<float>    healthLevelRatio;
+    std::vector<float>    manaLevelRatio;
+    std::vector<float>    armorLevelRatio;
+    std::vector<float>    damageLevelRatio;
+
+    // outputs
+    std::vector<uint32_t> health;
+    std::vector<uint32_t> mana;
+    std::vector<uint32_t> armor;
+    std::vector<float>    healthMultiplier;
+    std::vector<float>    scaledHealthMultiplier;
+    std::vector<float>    manaMultiplier;
+    std::vector<float>    scaledManaMultiplier;
+    std::vector<float>    armorMultiplier;
+    std::vector<float>    scaledArmorMultiplier;
+    std::vector<float>    damageMultiplier;
+    std::vector<float>    scaledDamageMultiplier;
+    std::vector<float>    ccDurationMultiplier;
+    std::vector<float>    xpModifier;
+    std::vector<float>    moneyModifier;
+};
+
+void calculateCreatureMultipliersBatch(AutoBalanceScalingSettings const& settings, AutoBalanceCreatureBatch& batch);
+
+// The kernel this build uses: "avx2", "sse2" or "scalar" (define AUTOBALANCE_BATCH_NO_SIMD to force the scalar one)
+char const* getCreatureBatchKernelName();
+
+#endif
@@ -0,0 +1,533 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingCore.h"
+
+#include <algorithm>
+#include <cmath>
+
+uint32_t getBaseExpansionValueForLevel(const uint32_t baseValues[3], uint8_t targetLevel)
+{
+    // convert baseValues from an array of uint32 to an array of float
+    float floatBaseValues[3];
+
+    for (int i = 0; i < 3; i++)
+        floatBaseValues[i] = (float)baseValues[i];
+
+    // return the result
+    return getBaseExpansionValueForLevel(floatBaseValues, targetLevel);
+}
+
+float getBaseExpansionValueForLevel(const float baseValues[3], uint8_t targetLevel)
+{
+    // the database holds multiple base values depending on the expansion
+    // this function returns the correct base value for the given level and
+    // smooths the transition between expansions
+
+    float vanillaValue = baseValues[0];
+    float bcValue      = baseValues[1];
+    float wotlkValue   = baseValues[2];
+
+    float returnValue;
+
+    // vanilla
+    if (targetLevel <= 60)
+    {
+        returnValue = vanillaValue;
+        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning Vanilla = {}", returnValue);
+    }
+    // transition from vanilla to BC
+    else if (targetLevel < 63)
+    {
+        float vanillaMultiplier = (63 - targetLevel) / 3.0;
+        float bcMultiplier      = 1.0f - vanillaMultiplier;
+
+        returnValue = (vanillaValue * vanillaMultiplier) + (bcValue * bcMultiplier);
+        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning Vanilla/BC = {}", returnValue);
+    }
+    // BC
+    else if (targetLevel <= 70)
+    {
+        returnValue = bcValue;
+        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning BC = {}", returnValue);
+    }
+    // transition from BC to WotLK
+    else if (targetLevel < 73)
+    {
+        float bcMultiplier    = (73 - targetLevel) / 3.0f;
+        float wotlkMultiplier = 1.0f - bcMultiplier;
+
+        returnValue = (bcValue * bcMultiplier) + (wotlkValue * wotlkMultiplier);
+        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning BC/WotLK = {}", returnValue);
+    }
+    // WotLK
+    else
+    {
+        returnValue = wotlkValue;
+        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning WotLK = {}", returnValue);
+    }
+
+    return returnValue;
+}
+
+// Helper function to calculate normalized value using tanh formula
+static float calculateTanFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+{
+    return ((tanh((adjustedPlayerCount - inflectionValue) / diff) + 1.0f) / 2.0f);
+}
+
+// Helper function to calculate normalized value using logarithmic formula
+static float calculateLogFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+{
+    // Calculate normalized input similar to tanh: (adjustedPlayerCount - inflectionValue) / diff
+    float normalized = (adjustedPlayerCount - inflectionValue) / diff;
+    // For logarithmic scaling, we want a curve that starts slow and accelerates
+    // Use sigmoid-like logarithmic function that maps [-inf, inf] to [0, 1]
+    // Shift and scale to match tanh's effective range
+    float shifted = normalized + 5.0f; // Shift to positive range
+    // Apply logarithmic scaling: log(1 + shifted) normalized
+    // The division factor controls the steepness of the curve
+    float logValue = log1p(shifted) / log1p(10.0f);
+    return std::max(0.0f, std::min(1.0f, logValue));
+}
+
+// Helper function to calculate normalized value using exponential formula
+static float calculateExpFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+{
+    // Calculate normalized input similar to tanh: (adjustedPlayerCount - inflectionValue) / diff
+    float normalized = (adjustedPlayerCount - inflectionValue) / diff;
+    // For exponential scaling, we want a curve that starts fast and decelerates
+    // Use inverse sigmoid-like exponential function that maps [-inf, inf] to [0, 1]
+    // Shift to handle negative values
+    float shifted = normalized + 5.0f; // Shift to positive range
+    // Apply exponential scaling: (exp(shifted/k) - 1) / (exp(max/k) - 1)
+    // k controls the steepness - smaller k = steeper curve
+    float k = 3.0f;
+    float expValue = (exp(shifted / k) - 1.0f) / (exp(10.0f / k) - 1.0f);
+    return std::max(0.0f, std::min(1.0f, expValue));
+}
+
+// Helper function to calculate normalized value using polynomial formula
+static float calculatePolFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+{
+    // Calculate normalized input: player count normalized to [0, 1] range
+    float normalized = adjustedPlayerCount / maxPlayers;
+    
+    // For polynomial scaling, the inflectionValue is passed as (maxPlayers * configValue)
+    // We need to extract the original config value by dividing by maxPlayers
+    // This is because other formulas use inflectionValue as an absolute offset,
+    // but for POL we use it as the exponent/power directly
+    float power = inflectionValue / maxPlayers;
+    
+    // Apply polynomial scaling: normalized^power
+    // Higher power = steeper curve, power of 2 gives moderate curve
+    float polValue = pow(std::max(0.0f, normalized), power);
+    
+    //LOG_INFO("module.AutoBalance", "calculatePolFormula: adjustedPlayerCount={}, inflectionValue={}, maxPlayers={}, normalized={}, power={} (extracted from inflectionValue/maxPlayers), polValue={}",
+    //    adjustedPlayerCount, inflectionValue, maxPlayers, normalized, power, polValue);
+    
+    return polValue;
+}
+
+float calculateCurveMultiplier(float adjustedPlayerCount, uint32_t maxNumberOfPlayers, AutoBalanceInflectionPointSettings const& inflectionPointSettings, FormulaType formulaType)
+{
+    // You can visually see the effects of this function by using this spreadsheet:
+    // https://docs.google.com/spreadsheets/d/100cmKIJIjCZ-ncWd0K9ykO8KUgwFTcwg4h2nfE_UeCc/copy
+
+    //
+    // #maththings
+    //
+    float diff = ((float)maxNumberOfPlayers/5)*1.5f;
+
+    //
+    // Calculate the normalized value [0, 1] based on the selected formula
+    //
+    float normalizedValue = 0.0f;
+    
+    switch (formulaType)
+    {
+        case AUTOBALANCE_FORMULA_LOG:
+            normalizedValue = calculateLogFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
+            break;
+        case AUTOBALANCE_FORMULA_EXP:
+            normalizedValue = calculateExpFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
+            break;
+        case AUTOBALANCE_FORMULA_POL:
+            normalizedValue = calculatePolFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
+            break;
+        case AUTOBALANCE_FORMULA_TAN:
+        default:
+            normalizedValue = calculateTanFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
+            break;
+    }
+
+    //
+    // For tanh formula, apply the curveCeiling adjustment for backwards compatibility
+    // For other formulas, use a simpler approach
+    //
+    float curveCeilingAdjustment = 1.0f;
+    if (formulaType == AUTOBALANCE_FORMULA_TAN)
+    {
+        // For math reasons that I do not understand, curveCeiling needs to be adjusted to bring the actual multiplier
+        // closer to the curveCeiling setting. Create an adjustment based on how much the ceiling should be changed at
+        // the max players multiplier.
+        float maxNormalizedValue = calculateTanFormula((float)maxNumberOfPlayers, inflectionPointSettings.value, maxNumberOfPlayers, diff);
+        float maxMultiplier = maxNormalizedValue * (inflectionPointSettings.curveCeiling - inflectionPointSettings.curveFloor) + inflectionPointSettings.curveFloor;
+        if (maxMultiplier > 0.0f)
+            curveCeilingAdjustment = inflectionPointSettings.curveCeiling / maxMultiplier;
+    }
+
+    //
+    // Adjust the multiplier based on the configured floor and ceiling values
+    //
+    float defaultMultiplier =
+        normalizedValue *
+        (inflectionPointSettings.curveCeiling * curveCeilingAdjustment - inflectionPointSettings.curveFloor) +
+        inflectionPointSettings.curveFloor;
+
+    /*LOG_INFO("module.AutoBalance", "getDefaultMultiplier: finalMultiplier={} (normalizedValue={} * range={} + floor={}) * adjustment={}",
+        defaultMultiplier, normalizedValue, (inflectionPointSettings.curveCeiling * curveCeilingAdjustment - inflectionPointSettings.curveFloor),
+        inflectionPointSettings.curveFloor, curveCeilingAdjustment);*/
+
+    return defaultMultiplier;
+}
+
+float calculateCCDurationMultiplier(float defaultMultiplier, float ccDurationModifier, float minCCDurationModifier, float maxCCDurationModifier)
+{
+    //
+    // -1 means the CC duration is not changed
+    //
+    if (ccDurationModifier == -1.0f)
+        return 1.0f;
+
+    float ccDurationMultiplier = defaultMultiplier * ccDurationModifier;
+
+    //
+    // Min/Max checking
+    //
+    if (ccDurationMultiplier < minCCDurationModifier)
+        ccDurationMultiplier = minCCDurationModifier;
+    else if (ccDurationMultiplier > maxCCDurationModifier)
+        ccDurationMultiplier = maxCCDurationModifier;
+
+    return ccDurationMultiplier;
+}
+
+Scaling_Tier getScalingTier(bool isHeroic, uint32_t maxPlayers)
+{
+    if (isHeroic)
+    {
+        if (maxPlayers <= 5)
+            return AUTOBALANCE_TIER_HEROIC_DUNGEON;
+        else if (maxPlayers <= 10)
+            return AUTOBALANCE_TIER_HEROIC_RAID_10M;
+        else if (maxPlayers <= 25)
+            return AUTOBALANCE_TIER_HEROIC_RAID_25M;
+
+        return AUTOBALANCE_TIER_HEROIC_RAID;
+    }
+
+    if (maxPlayers <= 5)
+        return AUTOBALANCE_TIER_DUNGEON;
+    else if (maxPlayers <= 10)
+        return AUTOBALANCE_TIER_RAID_10M;
+    else if (maxPlayers <= 15)
+        return AUTOBALANCE_TIER_RAID_15M;
+    else if (maxPlayers <= 20)
+        return AUTOBALANCE_TIER_RAID_20M;
+    else if (maxPlayers <= 25)
+        return AUTOBALANCE_TIER_RAID_25M;
+    else if (maxPlayers <= 40)
+        return AUTOBALANCE_TIER_RAID_40M;
+
+    return AUTOBALANCE_TIER_RAID;
+}
+
+char const* getScalingTierName(Scaling_Tier tier)
+{
+    switch (tier)
+    {
+        case AUTOBALANCE_TIER_DUNGEON:         return "1 to 5 Player Normal";
+        case AUTOBALANCE_TIER_RAID_10M:        return "10 Player Normal";
+        case AUTOBALANCE_TIER_RAID_15M:        return "15 Player Normal";
+        case AUTOBALANCE_TIER_RAID_20M:        return "20 Player Normal";
+        case AUTOBALANCE_TIER_RAID_25M:        return "25 Player Normal";
+        case AUTOBALANCE_TIER_RAID_40M:        return "40 Player Normal";
+        case AUTOBALANCE_TIER_RAID:            return "?? Player Normal";
+        case AUTOBALANCE_TIER_HEROIC_DUNGEON:  return "1 to 5 Player Heroic";
+        case AUTOBALANCE_TIER_HEROIC_RAID_10M: return "10 Player Heroic";
+        case AUTOBALANCE_TIER_HEROIC_RAID_25M: return "25 Player Heroic";
+        case AUTOBALANCE_TIER_HEROIC_RAID:     return "?? Player Heroic";
+        default:                               return "??";
+    }
+}
+
+AutoBalanceInflectionPointSettings selectInflectionPointSettings(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, StatType statType)
+{
+    AutoBalanceInflectionPointTier const& tier = settings.inflectionPoints[getScalingTier(map.isHeroic, map.maxPlayers)];
+
+    float inflectionValue = (float)map.maxPlayers;
+    float curveFloor      = tier.curveFloor;
+    float curveCeiling    = tier.curveCeiling;
+
+    //
+    // A stat-specific inflection point replaces the tier's inflection point
+    //
+
+    if (tier.statInflectionPoint[statType] >= 0.0f)
+        inflectionValue *= tier.statInflectionPoint[statType];
+    else
+        inflectionValue *= tier.inflectionPoint;
+
+    //
+    // Per map ID overrides alter the above settings, if set
+    //
+
+    if (map.dungeonOverride)
+    {
+        if (map.dungeonOverride->value != -1)
+        {
+            inflectionValue  = (float)map.maxPlayers; // Starting over
+            inflectionValue *= map.dungeonOverride->value;
+        }
+
+        if (map.dungeonOverride->curveFloor   != -1)
+            curveFloor   = map.dungeonOverride->curveFloor;
+        if (map.dungeonOverride->curveCeiling != -1)
+            curveCeiling = map.dungeonOverride->curveCeiling;
+    }
+
+    //
+    // Boss Inflection Point
+    // The boss override's value, if set, wins; then the boss stat-specific inflection, the boss inflection and the boss modifier
+    //
+
+    if (isBoss)
+    {
+        if (map.bossOverride && map.bossOverride->value != -1)
+            inflectionValue *= map.bossOverride->value;
+        else if (tier.bossStatInflectionPoint[statType] >= 0.0f)
+        {
+            inflectionValue  = (float)map.maxPlayers; // Start over
+            inflectionValue *= tier.bossStatInflectionPoint[statType];
+        }
+        else if (tier.bossInflectionPoint >= 0.0f)
+        {
+            inflectionValue  = (float)map.maxPlayers; // Start over
+            inflectionValue *= tier.bossInflectionPoint;
+        }
+        else
+            inflectionValue *= tier.bossModifier;
+    }
+
+    return AutoBalanceInflectionPointSettings(inflectionValue, curveFloor, curveCeiling);
+}
+
+static void applyStatModifierOverride(AutoBalanceStatModifiers& statModifiers, AutoBalanceStatModifiers const& statModifierOverride)
+{
+    if (statModifierOverride.global != -1)
+        statModifiers.global = statModifierOverride.global;
+
+    if (statModifierOverride.health != -1)
+        statModifiers.health = statModifierOverride.health;
+
+    if (statModifierOverride.mana != -1)
+        statModifiers.mana = statModifierOverride.mana;
+
+    if (statModifierOverride.armor != -1)
+        statModifiers.armor = statModifierOverride.armor;
+
+    if (statModifierOverride.damage != -1)
+        statModifiers.damage = statModifierOverride.damage;
+
+    if (statModifierOverride.ccduration != -1)
+        statModifiers.ccduration = statModifierOverride.ccduration;
+}
+
+AutoBalanceStatModifiers selectStatModifiers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, AutoBalanceStatModifiers const* creatureOverride)
+{
+    //
+    // AutoBalance.StatModifier*(.Boss).<stat>
+    //
+
+    AutoBalanceStatModifiers statModifiers = settings.statModifiers[getScalingTier(map.isHeroic, map.maxPlayers)][isBoss];
+
+    //
+    // AutoBalance.StatModifier.Boss.PerInstance, or else AutoBalance.StatModifier.PerInstance
+    //
+
+    if (isBoss && map.statModifierBossOverride)
+        applyStatModifierOverride(statModifiers, *map.statModifierBossOverride);
+    else if (map.statModifierOverride)
+        applyStatModifierOverride(statModifiers, *map.statModifierOverride);
+
+    //
+    // AutoBalance.StatModifier.PerCreature, applied last
+    //
+
+    if (creatureOverride)
+        applyStatModifierOverride(statModifiers, *creatureOverride);
+
+    return statModifiers;
+}
+
+CreatureCurveMultipliers calculateCurveMultipliers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, float adjustedPlayerCount)
+{
+    FormulaType const* formulaTypes = settings.formulaTypes[isBoss];
+
+    CreatureCurveMultipliers curveMultipliers;
+    curveMultipliers.health = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, isBoss, AUTOBALANCE_STAT_HEALTH), formulaTypes[AUTOBALANCE_STAT_HEALTH]);
+    curveMultipliers.mana   = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, isBoss, AUTOBALANCE_STAT_MANA),   formulaTypes[AUTOBALANCE_STAT_MANA]);
+    curveMultipliers.armor  = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, isBoss, AUTOBALANCE_STAT_ARMOR),  formulaTypes[AUTOBALANCE_STAT_ARMOR]);
+    curveMultipliers.damage = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, isBoss, AUTOBALANCE_STAT_DAMAGE), formulaTypes[AUTOBALANCE_STAT_DAMAGE]);
+
+    return curveMultipliers;
+}
+
+float calculateWorldMultiplier(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, BaseValueType baseValueType, float adjustedPlayerCount)
+{
+    StatType statType = (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) ? AUTOBALANCE_STAT_HEALTH : AUTOBALANCE_STAT_DAMAGE;
+
+    float defaultMultiplier = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, false, statType), settings.formulaTypes[false][statType]);
+
+    AutoBalanceStatModifiers statModifiers = selectStatModifiers(settings, map, false);
+
+    if (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) // health
+        return defaultMultiplier * statModifiers.global * statModifiers.health;
+    else // damage
+        return defaultMultiplier * statModifiers.global * statModifiers.damage;
+}
+
+bool isWorldMultiplierLevelScaled(bool levelScaling, float avgCreatureLevel, uint8_t highestPlayerLevel, uint8_t skipHigherLevels, uint8_t skipLowerLevels)
+{
+    // a skip range of 0 always scales
+    return levelScaling &&
+        (
+            (avgCreatureLevel > highestPlayerLevel + skipHigherLevels || skipHigherLevels == 0) ||
+            (avgCreatureLevel < highestPlayerLevel - skipLowerLevels || skipLowerLevels == 0)
+        );
+}
+
+StatMultiplierDisplay calculateDisplayMultipliers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, float adjustedPlayerCount)
+{
+    AutoBalanceStatModifiers const& statModifiers = settings.statModifiers[getScalingTier(map.isHeroic, map.maxPlayers)][isBoss];
+    FormulaType const* formulaTypes               = settings.formulaTypes[isBoss];
+
+    float healthMultiplier = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, isBoss, AUTOBALANCE_STAT_HEALTH), formulaTypes[AUTOBALANCE_STAT_HEALTH]) * statModifiers.global * statModifiers.health;
+    float damageMultiplier = calculateCurveMultiplier(adjustedPlayerCount, map.maxPlayers, selectInflectionPointSettings(settings, map, isBoss, AUTOBALANCE_STAT_DAMAGE), formulaTypes[AUTOBALANCE_STAT_DAMAGE]) * statModifiers.global * statModifiers.damage;
+
+    // Apply minimum caps
+    if (healthMultiplier <= settings.minHPModifier)
+        healthMultiplier = settings.minHPModifier;
+    if (damageMultiplier <= settings.minDamageModifier)
+        damageMultiplier = settings.minDamageModifier;
+
+    StatMultiplierDisplay result;
+    result.healthPercent = healthMultiplier * 100.0f;
+    result.damagePercent = damageMultiplier * 100.0f;
+
+    return result;
+}
+
+AutoBalanceCreatureMultipliers calculateCreatureMultipliers(AutoBalanceScalingSettings const& settings, CreatureCurveMultipliers const& curveMultipliers, AutoBalanceScalingCreature const& creature)
+{
+    AutoBalanceStatModifiers const& statModifiers = creature.statModifiers;
+    AutoBalanceCreatureMultipliers multipliers;
+
+    //
+    // Health, can't be less than MinHPModifier
+    //
+
+    multipliers.healthMultiplier = curveMultipliers.health * statModifiers.global * statModifiers.health;
+
+    if (multipliers.healthMultiplier <= settings.minHPModifier)
+        multipliers.healthMultiplier = settings.minHPModifier;
+
+    multipliers.scaledHealthMultiplier = multipliers.healthMultiplier * creature.healthLevelRatio;
+    multipliers.health                 = std::round(creature.baseHealth * multipliers.scaledHealthMultiplier);
+
+    //
+    // Mana, can't be less than MinManaModifier; creatures without mana keep none
+    //
+
+    if (creature.baseMana)
+    {
+        multipliers.manaMultiplier = curveMultipliers.mana * statModifiers.global * statModifiers.mana;
+
+        if (multipliers.manaMultiplier <= settings.minManaModifier)
+            multipliers.manaMultiplier = settings.minManaModifier;
+
+        multipliers.scaledManaMultiplier = multipliers.manaMultiplier * creature.manaLevelRatio;
+        multipliers.mana                 = std::round(creature.baseMana * multipliers.scaledManaMultiplier);
+    }
+    else
+    {
+        multipliers.manaMultiplier       = 0.0f;
+        multipliers.scaledManaMultiplier = 0.0f;
+        multipliers.mana                 = 0;
+    }
+
+    //
+    // Armor, no minimum
+    //
+
+    multipliers.armorMultiplier       = curveMultipliers.armor * statModifiers.global * statModifiers.armor;
+    multipliers.scaledArmorMultiplier = multipliers.armorMultiplier * creature.armorLevelRatio;
+    multipliers.armor                 = std::round(creature.baseArmor * multipliers.scaledArmorMultiplier);
+
+    //
+    // Damage, can't be less than MinDamageModifier
+    //
+
+    multipliers.damageMultiplier = curveMultipliers.damage * statModifiers.global * statModifiers.damage;
+
+    if (multipliers.damageMultiplier <= settings.minDamageModifier)
+        multipliers.damageMultiplier = settings.minDamageModifier;
+
+    multipliers.scaledDamageMultiplier = multipliers.damageMultiplier * creature.damageLevelRatio;
+
+    //
+    // Crowd Control Debuff Duration
+    //
+
+    multipliers.ccDurationMultiplier = calculateCCDurationMultiplier(creature.defaultMultiplier, statModifiers.ccduration, settings.minCCDurationModifier, settings.maxCCDurationModifier);
+
+    //
+    // Reward Scaling, from the average of the level scaled health and damage multipliers
+    //
+
+    float avgHealthDamageMultipliers = (multipliers.scaledHealthMultiplier + multipliers.scaledDamageMultiplier) / 2.0f;
+
+    if (settings.rewardScalingXP)
+    {
+        if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
+            multipliers.xpModifier = settings.rewardScalingXPModifier;
+        else if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+            multipliers.xpModifier = avgHealthDamageMultipliers * settings.rewardScalingXPModifier;
+    }
+
+    if (settings.rewardScalingMoney)
+    {
+        if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_FIXED)
+            multipliers.moneyModifier = settings.rewardScalingMoneyModifier;
+        else if (settings.rewardScalingMethod == AUTOBALANCE_SCALING_DYNAMIC)
+            multipliers.moneyModifier = avgHealthDamageMultipliers * settings.rewardScalingMoneyModifier;
+    }
+
+    return multipliers;
+}
+
+AutoBalanceCreatureMultipliers calculateMapMultipliers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, float adjustedPlayerCount)
+{
+    CreatureCurveMultipliers curveMultipliers = calculateCurveMultipliers(settings, map, isBoss, adjustedPlayerCount);
+
+    AutoBalanceScalingCreature creature;
+    creature.defaultMultiplier = curveMultipliers.health;
+    creature.statModifiers     = selectStatModifiers(settings, map, isBoss);
+    creature.baseHealth        = 1.0f;
+    creature.baseMana          = 1.0f;
+    creature.baseArmor         = 1.0f;
+
+    return calculateCreatureMultipliers(settings, curveMultipliers, creature);
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_SCALING_CORE_H
+#define __AB_SCALING_CORE_H
+
+#include "ABInflectionPointSettings.h"
+#include "ABScalingSettings.h"
+#include "ABStatModifiers.h"
+#include "AutoBalance.h"
+
+#include <cstdint>
+
+//
+// Scaling math that works on plain values only
+// Nothing in here reads Map, Creature, Player or the config; callers resolve those first and pass the settings in
+//
+
+// What the scaling math needs to know about a map and difficulty
+struct AutoBalanceScalingMap
+{
+    uint32_t                                  maxPlayers               = 5;
+    bool                                      isHeroic                 = false;
+    AutoBalanceInflectionPointSettings const* dungeonOverride          = nullptr; // AutoBalance.InflectionPoint.PerInstance, if set for the map
+    AutoBalanceInflectionPointSettings const* bossOverride             = nullptr; // AutoBalance.InflectionPoint.Boss.PerInstance, if set for the map
+    AutoBalanceStatModifiers const*           statModifierOverride     = nullptr; // AutoBalance.StatModifier.PerInstance, if set for the map
+    AutoBalanceStatModifiers const*           statModifierBossOverride = nullptr; // AutoBalance.StatModifier.Boss.PerInstance, if set for the map
+};
+
+// Per-stat curve multipliers, shared by every creature in a map with the same boss status
+struct CreatureCurveMultipliers
+{
+    float health;
+    float mana;
+    float armor;
+    float damage;
+};
+
+// Health and damage percentages shown to players, for either normal creatures or bosses
+struct StatMultiplierDisplay
+{
+    float    healthPercent                      = 100.0f;
+    float    damagePercent                      = 100.0f;
+};
+
+// What the multiplier math needs to know about a creature
+// The base values are the creature's at its unmodified level; the level ratios are 1 when it isn't level scaled
+struct AutoBalanceScalingCreature
+{
+    float                    defaultMultiplier = 1.0f;  // The health curve multiplier as returned by the OnAfterDefaultMultiplier hooks
+    AutoBalanceStatModifiers statModifiers;             // As returned by selectStatModifiers
+    float                    baseHealth        = 0.0f;
+    float                    baseMana          = 0.0f;  // 0 for creatures without mana
+    float                    baseArmor         = 0.0f;
+    float                    healthLevelRatio  = 1.0f;  // Health at the selected level / health at the unmodified level
+    float                    manaLevelRatio    = 1.0f;
+    float                    armorLevelRatio   = 1.0f;
+    float                    damageLevelRatio  = 1.0f;
+};
+
+struct AutoBalanceCreatureMultipliers
+{
+    uint32_t health                 = 0;
+    uint32_t mana                   = 0;
+    uint32_t armor                  = 0;
+    float    healthMultiplier       = 1.0f;
+    float    scaledHealthMultiplier = 1.0f;
+    float    manaMultiplier         = 1.0f;
+    float    scaledManaMultiplier   = 1.0f;
+    float    armorMultiplier        = 1.0f;
+    float    scaledArmorMultiplier  = 1.0f;
+    float    damageMultiplier       = 1.0f;
+    float    scaledDamageMultiplier = 1.0f;
+    float    ccDurationMultiplier   = 1.0f;
+    float    xpModifier             = 1.0f;
+    float    moneyModifier          = 1.0f;
+};
+
+uint32_t getBaseExpansionValueForLevel(const uint32_t baseValues[3], uint8_t targetLevel);
+float getBaseExpansionValueForLevel(const float baseValues[3], uint8_t targetLevel);
+
+// The [curveFloor, curveCeiling] multiplier for the given player count on the selected curve
+float calculateCurveMultiplier(float adjustedPlayerCount, uint32_t maxNumberOfPlayers, AutoBalanceInflectionPointSettings const& inflectionPointSettings, FormulaType formulaType);
+
+// The CC duration multiplier, clamped to the configured range (a modifier of -1 leaves durations unchanged)
+float calculateCCDurationMultiplier(float defaultMultiplier, float ccDurationModifier, float minCCDurationModifier, float maxCCDurationModifier);
+
+Scaling_Tier getScalingTier(bool isHeroic, uint32_t maxPlayers);
+char const* getScalingTierName(Scaling_Tier tier);
+
+// The tier's inflection point for the stat, after the map's inflection point and boss overrides
+AutoBalanceInflectionPointSettings selectInflectionPointSettings(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, StatType statType);
+
+// The tier's stat modifiers, after the map's overrides and then the creature's (creatureOverride may be null)
+AutoBalanceStatModifiers selectStatModifiers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, AutoBalanceStatModifiers const* creatureOverride = nullptr);
+
+CreatureCurveMultipliers calculateCurveMultipliers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, float adjustedPlayerCount);
+
+// The world health or damage multiplier before level scaling, for a non-boss creature without overrides of its own
+float calculateWorldMultiplier(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, BaseValueType baseValueType, float adjustedPlayerCount);
+
+// Whether the world multipliers are scaled from the average creature level to the highest player level
+bool isWorldMultiplierLevelScaled(bool levelScaling, float avgCreatureLevel, uint8_t highestPlayerLevel, uint8_t skipHigherLevels, uint8_t skipLowerLevels);
+
+// The multipliers announced to players; these use the tier's stat modifiers, not the per-instance stat modifier overrides
+StatMultiplierDisplay calculateDisplayMultipliers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, float adjustedPlayerCount);
+
+AutoBalanceCreatureMultipliers calculateCreatureMultipliers(AutoBalanceScalingSettings const& settings, CreatureCurveMultipliers const& curveMultipliers, AutoBalanceScalingCreature const& creature);
+
+// The multipliers calculateCreatureMultipliers gives a creature of the map with mana, no stat modifiers of its own and no level scaling
+// The stat values in the result are for base values of 1 and carry no meaning
+AutoBalanceCreatureMultipliers calculateMapMultipliers(AutoBalanceScalingSettings const& settings, AutoBalanceScalingMap const& map, bool isBoss, float adjustedPlayerCount);
+
+#endif
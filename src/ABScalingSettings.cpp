@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingSettings.h"
+
+static char const* statNames[AUTOBALANCE_STAT_COUNT] = { "Health", "Mana", "Armor", "Damage" };
+
+//
+// The config key prefixes of each tier
+// The sized raid tiers fall back to the values of their parent tier, so they are listed after it
+//
+
+struct AutoBalanceTierKeys
+{
+    Scaling_Tier tier;
+    Scaling_Tier parent;             // The tier unset keys fall back to, the tier itself for the base tiers
+    char const*  inflectionPointKey;
+    char const*  statModifierKey;
+};
+
+static AutoBalanceTierKeys const tierKeys[AUTOBALANCE_TIER_COUNT] =
+{
+    { AUTOBALANCE_TIER_DUNGEON,         AUTOBALANCE_TIER_DUNGEON,        "AutoBalance.InflectionPoint",              "AutoBalance.StatModifier"              },
+    { AUTOBALANCE_TIER_HEROIC_DUNGEON,  AUTOBALANCE_TIER_HEROIC_DUNGEON, "AutoBalance.InflectionPointHeroic",        "AutoBalance.StatModifierHeroic"        },
+    { AUTOBALANCE_TIER_RAID,            AUTOBALANCE_TIER_RAID,           "AutoBalance.InflectionPointRaid",          "AutoBalance.StatModifierRaid"          },
+    { AUTOBALANCE_TIER_HEROIC_RAID,     AUTOBALANCE_TIER_HEROIC_RAID,    "AutoBalance.InflectionPointRaidHeroic",    "AutoBalance.StatModifierRaidHeroic"    },
+    { AUTOBALANCE_TIER_RAID_10M,        AUTOBALANCE_TIER_RAID,           "AutoBalance.InflectionPointRaid10M",       "AutoBalance.StatModifierRaid10M"       },
+    { AUTOBALANCE_TIER_RAID_15M,        AUTOBALANCE_TIER_RAID,           "AutoBalance.InflectionPointRaid15M",       "AutoBalance.StatModifierRaid15M"       },
+    { AUTOBALANCE_TIER_RAID_20M,        AUTOBALANCE_TIER_RAID,           "AutoBalance.InflectionPointRaid20M",       "AutoBalance.StatModifierRaid20M"       },
+    { AUTOBALANCE_TIER_RAID_25M,        AUTOBALANCE_TIER_RAID,           "AutoBalance.InflectionPointRaid25M",       "AutoBalance.StatModifierRaid25M"       },
+    { AUTOBALANCE_TIER_RAID_40M,        AUTOBALANCE_TIER_RAID,           "AutoBalance.InflectionPointRaid40M",       "AutoBalance.StatModifierRaid40M"       },
+    { AUTOBALANCE_TIER_HEROIC_RAID_10M, AUTOBALANCE_TIER_HEROIC_RAID,    "AutoBalance.InflectionPointRaid10MHeroic", "AutoBalance.StatModifierRaid10MHeroic" },
+    { AUTOBALANCE_TIER_HEROIC_RAID_25M, AUTOBALANCE_TIER_HEROIC_RAID,    "AutoBalance.InflectionPointRaid25MHeroic", "AutoBalance.StatModifierRaid25MHeroic" }
+};
+
+struct AutoBalanceStatModifierKey
+{
+    char const*                     name;
+    float AutoBalanceStatModifiers::* field;
+    char const*                     deprecatedKey; // `AutoBalance.rate.*`, read as the default of the base tiers
+};
+
+static AutoBalanceStatModifierKey const statModifierKeys[] =
+{
+    { "Global",     &AutoBalanceStatModifiers::global,     "AutoBalance.rate.global" },
+    { "Health",     &AutoBalanceStatModifiers::health,     "AutoBalance.rate.health" },
+    { "Mana",       &AutoBalanceStatModifiers::mana,       "AutoBalance.rate.mana"   },
+    { "Armor",      &AutoBalanceStatModifiers::armor,      "AutoBalance.rate.armor"  },
+    { "Damage",     &AutoBalanceStatModifiers::damage,     "AutoBalance.rate.damage" },
+    { "CCDuration", &AutoBalanceStatModifiers::ccduration, nullptr                   }  // -1 leaves CC durations unchanged
+};
+
+AutoBalanceScalingSettings::AutoBalanceScalingSettings()
+{
+    for (AutoBalanceStatModifiers (&tierStatModifiers)[2] : statModifiers)
+        for (AutoBalanceStatModifiers& tierStatModifier : tierStatModifiers)
+            tierStatModifier.ccduration = -1.0f;
+
+    for (FormulaType (&bossFormulaTypes)[AUTOBALANCE_STAT_COUNT] : formulaTypes)
+        for (FormulaType& formulaType : bossFormulaTypes)
+            formulaType = AUTOBALANCE_FORMULA_TAN;
+}
+
+FormulaType ParseFormulaType(std::string const& formulaType)
+{
+    if (formulaType == "log")
+        return AUTOBALANCE_FORMULA_LOG;
+    else if (formulaType == "exp")
+        return AUTOBALANCE_FORMULA_EXP;
+    else if (formulaType == "pol")
+        return AUTOBALANCE_FORMULA_POL;
+
+    return AUTOBALANCE_FORMULA_TAN; // default
+}
+
+static void LoadInflectionPointTier(AutoBalanceScalingSettings& settings, AutoBalanceConfigSource const& config, AutoBalanceTierKeys const& keys)
+{
+    std::string prefix = keys.inflectionPointKey;
+    bool isBaseTier    = keys.tier == keys.parent;
+
+    AutoBalanceInflectionPointTier defaults;
+
+    if (isBaseTier)
+        defaults.bossModifier = config.GetFloat("AutoBalance.BossInflectionMult", 1.0f); // `AutoBalance.BossInflectionMult` for backwards compatibility
+    else
+        defaults = settings.inflectionPoints[keys.parent];
+
+    AutoBalanceInflectionPointTier& tier = settings.inflectionPoints[keys.tier];
+
+    tier.inflectionPoint     = config.GetFloat(prefix, defaults.inflectionPoint);
+    tier.curveFloor          = config.GetFloat(prefix + ".CurveFloor", defaults.curveFloor);
+    tier.curveCeiling        = config.GetFloat(prefix + ".CurveCeiling", defaults.curveCeiling);
+    tier.bossModifier        = config.GetFloat(prefix + ".BossModifier", defaults.bossModifier);
+    tier.bossInflectionPoint = config.GetFloat(prefix + ".BossInflection", defaults.bossInflectionPoint);
+
+    for (uint8_t stat = 0; stat < AUTOBALANCE_STAT_COUNT; ++stat)
+    {
+        tier.statInflectionPoint[stat] = config.GetFloat(prefix + "." + statNames[stat], defaults.statInflectionPoint[stat]);
+
+        // only the base tiers have boss stat-specific inflection points
+        tier.bossStatInflectionPoint[stat] = isBaseTier ? config.GetFloat(prefix + ".Boss." + statNames[stat], -1.0f) : -1.0f;
+    }
+}
+
+static void LoadStatModifierTier(AutoBalanceScalingSettings& settings, AutoBalanceConfigSource const& config, AutoBalanceTierKeys const& keys)
+{
+    bool isBaseTier = keys.tier == keys.parent;
+
+    for (uint8_t isBoss = 0; isBoss < 2; ++isBoss)
+    {
+        std::string prefix = std::string(keys.statModifierKey) + (isBoss ? ".Boss." : ".");
+
+        AutoBalanceStatModifiers const& parent = settings.statModifiers[keys.parent][isBoss];
+        AutoBalanceStatModifiers&       tier   = settings.statModifiers[keys.tier][isBoss];
+
+        for (AutoBalanceStatModifierKey const& key : statModifierKeys)
+        {
+            float defaultValue;
+
+            if (!isBaseTier)
+                defaultValue = parent.*key.field;
+            else if (key.deprecatedKey)
+                defaultValue = config.GetFloat(key.deprecatedKey, 1.0f); // `AutoBalance.rate.*` for backwards compatibility
+            else
+                defaultValue = -1.0f;
+
+            tier.*key.field = config.GetFloat(prefix + key.name, defaultValue);
+        }
+    }
+}
+
+void LoadScalingSettings(AutoBalanceScalingSettings& settings, AutoBalanceConfigSource const& config, std::vector<std::string>& errors)
+{
+    //
+    // InflectionPoint* and StatModifier*
+    //
+
+    for (AutoBalanceTierKeys const& keys : tierKeys)
+    {
+        LoadInflectionPointTier(settings, config, keys);
+        LoadStatModifierTier(settings, config, keys);
+    }
+
+    //
+    // FormulaType* (Health, Mana, Armor, and Damage formula selection)
+    //
+
+    for (uint8_t stat = 0; stat < AUTOBALANCE_STAT_COUNT; ++stat)
+    {
+        settings.formulaTypes[false][stat] = ParseFormulaType(config.GetString(std::string("AutoBalance.FormulaType.") + statNames[stat], "tan"));
+        settings.formulaTypes[true][stat]  = ParseFormulaType(config.GetString(std::string("AutoBalance.FormulaType.Boss.") + statNames[stat], "tan"));
+    }
+
+    //
+    // Modifier Min/Max
+    //
+
+    settings.minHPModifier         = config.GetFloat("AutoBalance.MinHPModifier", 0.1f);
+    settings.minManaModifier       = config.GetFloat("AutoBalance.MinManaModifier", 0.01f);
+    settings.minDamageModifier     = config.GetFloat("AutoBalance.MinDamageModifier", 0.01f);
+    settings.minCCDurationModifier = config.GetFloat("AutoBalance.MinCCDurationModifier", 0.25f);
+    settings.maxCCDurationModifier = config.GetFloat("AutoBalance.MaxCCDurationModifier", 1.0f);
+
+    //
+    // RewardScaling.*
+    //
+
+    std::string rewardScalingMethod = config.GetString("AutoBalance.RewardScaling.Method", "dynamic");
+
+    if (rewardScalingMethod == "fixed")
+        settings.rewardScalingMethod = AUTOBALANCE_SCALING_FIXED;
+    else if (rewardScalingMethod == "dynamic")
+        settings.rewardScalingMethod = AUTOBALANCE_SCALING_DYNAMIC;
+    else
+    {
+        errors.push_back("invalid value `" + rewardScalingMethod + "` for `AutoBalance.RewardScaling.Method` defined in `AutoBalance.conf`. Defaulting to a value of `dynamic`.");
+        settings.rewardScalingMethod = AUTOBALANCE_SCALING_DYNAMIC;
+    }
+
+    settings.rewardScalingXP            = config.GetBool("AutoBalance.RewardScaling.XP", config.GetBool("AutoBalance.DungeonScaleDownXP", true)); // `AutoBalance.DungeonScaleDownXP` for backwards compatibility
+    settings.rewardScalingXPModifier    = config.GetFloat("AutoBalance.RewardScaling.XP.Modifier", 1.0f);
+
+    settings.rewardScalingMoney         = config.GetBool("AutoBalance.RewardScaling.Money", config.GetBool("AutoBalance.DungeonScaleDownMoney", true)); // `AutoBalance.DungeonScaleDownMoney` for backwards compatibility
+    settings.rewardScalingMoneyModifier = config.GetFloat("AutoBalance.RewardScaling.Money.Modifier", 1.0f);
+}
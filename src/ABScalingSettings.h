@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#ifndef __AB_SCALING_SETTINGS_H
+#define __AB_SCALING_SETTINGS_H
+
+#include "ABStatModifiers.h"
+#include "AutoBalance.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// The config values the scaling math reads, resolved per instance tier
+// Loaded once per config (re)load and passed to the scaling core by value or reference
+//
+
+// AutoBalance.InflectionPoint*
+struct AutoBalanceInflectionPointTier
+{
+    float inflectionPoint                                 = 0.5f;
+    float curveFloor                                      = 0.0f;
+    float curveCeiling                                    = 1.0f;
+    float bossModifier                                    = 1.0f;
+    float bossInflectionPoint                             = -1.0f; // -1 when not set
+    float statInflectionPoint[AUTOBALANCE_STAT_COUNT]     = { -1.0f, -1.0f, -1.0f, -1.0f }; // indexed by StatType, -1 when not set
+    float bossStatInflectionPoint[AUTOBALANCE_STAT_COUNT] = { -1.0f, -1.0f, -1.0f, -1.0f }; // indexed by StatType, only read for the base tiers
+};
+
+struct AutoBalanceScalingSettings
+{
+    AutoBalanceScalingSettings();
+
+    AutoBalanceInflectionPointTier inflectionPoints[AUTOBALANCE_TIER_COUNT];
+    AutoBalanceStatModifiers       statModifiers[AUTOBALANCE_TIER_COUNT][2];      // AutoBalance.StatModifier*(.Boss), indexed by tier and isBoss
+    FormulaType                    formulaTypes[2][AUTOBALANCE_STAT_COUNT];       // AutoBalance.FormulaType(.Boss).*, indexed by isBoss and StatType
+
+    float                          minHPModifier              = 0.1f;
+    float                          minManaModifier            = 0.01f;
+    float                          minDamageModifier          = 0.01f;
+    float                          minCCDurationModifier      = 0.25f;
+    float                          maxCCDurationModifier      = 1.0f;
+
+    ScalingMethod                  rewardScalingMethod        = AUTOBALANCE_SCALING_DYNAMIC;
+    bool                           rewardScalingXP            = true;
+    bool                           rewardScalingMoney         = true;
+    float                          rewardScalingXPModifier    = 1.0f;
+    float                          rewardScalingMoneyModifier = 1.0f;
+};
+
+// Where LoadScalingSettings reads its values from: the worldserver config, or a config file read by the offline tools
+class AutoBalanceConfigSource
+{
+public:
+    virtual ~AutoBalanceConfigSource() = default;
+
+    virtual bool        GetBool(std::string const& name, bool defaultValue) const = 0;
+    virtual float       GetFloat(std::string const& name, float defaultValue) const = 0;
+    virtual std::string GetString(std::string const& name, std::string const& defaultValue) const = 0;
+};
+
+// Read every scaling setting, including the deprecated fallbacks; invalid values are described in errors and replaced by their default
+void LoadScalingSettings(AutoBalanceScalingSettings& settings, AutoBalanceConfigSource const& config, std::vector<std::string>& errors);
+
+FormulaType ParseFormulaType(std::string const& formulaType);
+
+#endif
@@ -5,9 +5,7 @@
 #ifndef __AB_MODULE_STAT_MODIFIERS_H
 #define __AB_MODULE_STAT_MODIFIERS_H
 
-#include "DataMap.h"
-
-class AutoBalanceStatModifiers : public DataMap::Base
+class AutoBalanceStatModifiers
 {
 public:
     AutoBalanceStatModifiers() {}
@@ -1,86 +1,118 @@
 #include "ABUnitScript.h"
 
+#include "ABCombatCapture.h"
 #include "ABConfig.h"
 #include "ABCreatureInfo.h"
 #include "ABMapInfo.h"
+#include "ABMetrics.h"
 #include "ABUtils.h"
 
+#include "Log.h"
+#include "Timer.h"
+
 void AutoBalance_UnitScript::ModifyPeriodicDamageAurasTick(Unit* target, Unit* source, uint32& amount, SpellInfo const* spellInfo)
 {
+    AutoBalanceMetricsTimer metricsTimer(target->GetMap(), AUTOBALANCE_METRIC_HOOKS);
+
     // if the spell is negative (damage), we need to flip the sign
     // if the spell is positive (healing or other) we keep it the same
     int32 adjustedAmount = !spellInfo->IsPositive() ? amount * -1 : amount;
 
-    // only debug if the source or target is a player
-    bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
-    _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
+    // decide whether this event is logged before any debug output is formatted
+    bool _debug_damage_and_healing = _Should_Debug_Damage_Healing(target, source, spellInfo->Id);
 
     if (_debug_damage_and_healing)
         _Debug_Output("ModifyPeriodicDamageAurasTick", target, source, adjustedAmount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_BEFORE, spellInfo->SpellName[0], spellInfo->Id);
 
+    int32 capturedAmount = adjustedAmount;
+
     // set amount to the absolute value of the function call
     // the provided amount doesn't indicate whether it's a positive or negative value
-    adjustedAmount = _Modify_Damage_Healing(target, source, adjustedAmount, spellInfo);
+    AutoBalanceCombatDecision decision;
+    adjustedAmount = _Modify_Damage_Healing(target, source, adjustedAmount, decision, spellInfo, _debug_damage_and_healing);
     amount = abs(adjustedAmount);
 
+    if (IsCombatCaptureActive())
+        CaptureCombatEvent(AUTOBALANCE_CAPTURE_HOOK_PERIODIC_DAMAGE_AURAS_TICK, target, source, spellInfo->Id, decision, capturedAmount, adjustedAmount);
+
     if (_debug_damage_and_healing)
         _Debug_Output("ModifyPeriodicDamageAurasTick", target, source, adjustedAmount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_AFTER, spellInfo->SpellName[0], spellInfo->Id);
 }
 
 void AutoBalance_UnitScript::ModifySpellDamageTaken(Unit* target, Unit* source, int32& amount, SpellInfo const* spellInfo)
 {
+    AutoBalanceMetricsTimer metricsTimer(target->GetMap(), AUTOBALANCE_METRIC_HOOKS);
+
     // if the spell is negative (damage), we need to flip the sign to negative
     // if the spell is positive (healing or other) we keep it the same (positive)
     int32 adjustedAmount = !spellInfo->IsPositive() ? amount * -1 : amount;
 
-    // only debug if the source or target is a player
-    bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
-    _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
+    // decide whether this event is logged before any debug output is formatted
+    bool _debug_damage_and_healing = _Should_Debug_Damage_Healing(target, source, spellInfo->Id);
 
     if (_debug_damage_and_healing)
         _Debug_Output("ModifySpellDamageTaken", target, source, adjustedAmount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_BEFORE, spellInfo->SpellName[0], spellInfo->Id);
 
+    int32 capturedAmount = adjustedAmount;
+
     // set amount to the absolute value of the function call
     // the provided amount doesn't indicate whether it's a positive or negative value
-    adjustedAmount = _Modify_Damage_Healing(target, source, adjustedAmount, spellInfo);
+    AutoBalanceCombatDecision decision;
+    adjustedAmount = _Modify_Damage_Healing(target, source, adjustedAmount, decision, spellInfo, _debug_damage_and_healing);
     amount = abs(adjustedAmount);
 
+    if (IsCombatCaptureActive())
+        CaptureCombatEvent(AUTOBALANCE_CAPTURE_HOOK_SPELL_DAMAGE_TAKEN, target, source, spellInfo->Id, decision, capturedAmount, adjustedAmount);
+
     if (_debug_damage_and_healing)
         _Debug_Output("ModifySpellDamageTaken", target, source, adjustedAmount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_AFTER, spellInfo->SpellName[0], spellInfo->Id);
 }
 
 void AutoBalance_UnitScript::ModifyMeleeDamage(Unit* target, Unit* source, uint32& amount)
 {
+    AutoBalanceMetricsTimer metricsTimer(target->GetMap(), AUTOBALANCE_METRIC_HOOKS);
+
     // melee damage is always negative, so we need to flip the sign to negative
     int32 adjustedAmount = amount * -1;
 
-    // only debug if the source or target is a player
-    bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
-    _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
+    // decide whether this event is logged before any debug output is formatted
+    bool _debug_damage_and_healing = _Should_Debug_Damage_Healing(target, source, 0);
 
     if (_debug_damage_and_healing)
         _Debug_Output("ModifyMeleeDamage", target, source, adjustedAmount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_BEFORE, "Melee");
 
+    int32 capturedAmount = adjustedAmount;
+
     // set amount to the absolute value of the function call
-    adjustedAmount = _Modify_Damage_Healing(target, source, adjustedAmount);
+    AutoBalanceCombatDecision decision;
+    adjustedAmount = _Modify_Damage_Healing(target, source, adjustedAmount, decision, nullptr, _debug_damage_and_healing);
     amount = abs(adjustedAmount);
 
+    if (IsCombatCaptureActive())
+        CaptureCombatEvent(AUTOBALANCE_CAPTURE_HOOK_MELEE_DAMAGE, target, source, 0, decision, capturedAmount, adjustedAmount);
+
     if (_debug_damage_and_healing)
         _Debug_Output("ModifyMeleeDamage", target, source, adjustedAmount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_AFTER, "Melee");
 }
 
 void AutoBalance_UnitScript::ModifyHealReceived(Unit* target, Unit* source, uint32& amount, SpellInfo const* spellInfo)
 {
+    AutoBalanceMetricsTimer metricsTimer(target->GetMap(), AUTOBALANCE_METRIC_HOOKS);
+
     // healing is always positive, no need for any sign flip
 
-    // only debug if the source or target is a player
-    bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
-    _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
+    // decide whether this event is logged before any debug output is formatted
+    bool _debug_damage_and_healing = _Should_Debug_Damage_Healing(target, source, spellInfo->Id);
 
     if (_debug_damage_and_healing)
         _Debug_Output("ModifyHealReceived", target, source, amount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_BEFORE, spellInfo->SpellName[0], spellInfo->Id);
 
-    amount = _Modify_Damage_Healing(target, source, amount, spellInfo);
+    uint32 capturedAmount = amount;
+    AutoBalanceCombatDecision decision;
+    amount = _Modify_Damage_Healing(target, source, amount, decision, spellInfo, _debug_damage_and_healing);
+
+    if (IsCombatCaptureActive())
+        CaptureCombatEvent(AUTOBALANCE_CAPTURE_HOOK_HEAL_RECEIVED, target, source, spellInfo->Id, decision, capturedAmount, amount);
 
     if (_debug_damage_and_healing)
         _Debug_Output("ModifyHealReceived", target, source, amount, AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_AFTER, spellInfo->SpellName[0], spellInfo->Id);
@@ -88,14 +120,19 @@ void AutoBalance_UnitScript::ModifyHealReceived(Unit* target, Unit* source, uint
 
 void AutoBalance_UnitScript::OnAuraApply(Unit* unit, Aura* aura)
 {
-    // only debug if the source or target is a player
-    bool _debug_damage_and_healing = (unit && unit->GetTypeId() == TYPEID_PLAYER);
-    _debug_damage_and_healing = (unit && unit->GetMap()->GetInstanceId());
+    AutoBalanceMetricsTimer metricsTimer(unit->GetMap(), AUTOBALANCE_METRIC_HOOKS);
+
+    // decide whether this event is logged before any debug output is formatted
+    bool _debug_damage_and_healing = _Should_Debug_Damage_Healing(unit, aura ? aura->GetCaster() : nullptr, aura ? aura->GetId() : 0);
 
     // Only if this aura has a duration
     if (aura && (aura->GetDuration() > 0 || aura->GetMaxDuration() > 0))
     {
-        uint32 auraDuration = _Modifier_CCDuration(unit, aura->GetCaster(), aura);
+        AutoBalanceCombatDecision decision;
+        uint32 auraDuration = _Modifier_CCDuration(unit, aura->GetCaster(), aura, decision);
+
+        if (IsCombatCaptureActive())
+            CaptureCombatEvent(AUTOBALANCE_CAPTURE_HOOK_AURA_APPLY, unit, aura->GetCaster(), aura->GetId(), decision, aura->GetDuration(), auraDuration);
 
         // only update if we decided to change it
         if (auraDuration != (float)aura->GetDuration())
@@ -113,6 +150,15 @@ void AutoBalance_UnitScript::OnAuraApply(Unit* unit, Aura* aura)
     }
 }
 
+void AutoBalance_UnitScript::OnUnitDeath(Unit* unit, Unit* /*killer*/)
+{
+    // queue dead creatures once so they are primed for a reset if they are respawned
+    if (!unit || !unit->ToCreature() || !unit->GetMap() || !unit->GetMap()->IsDungeon())
+        return;
+
+    QueueCreatureForUpdate(unit->ToCreature());
+}
+
 void AutoBalance_UnitScript::_Debug_Output(std::string function_name, Unit* target, Unit* source, int32 amount, Damage_Healing_Debug_Phase phase, std::string spell_name, uint32 spell_id)
 {
     if (phase == AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_BEFORE)
@@ -183,24 +229,10 @@ void AutoBalance_UnitScript::_Debug_Output(std::string function_name, Unit* targ
     }
 }
 
-int32 AutoBalance_UnitScript::_Modify_Damage_Healing(Unit* target, Unit* source, int32 amount, SpellInfo const* spellInfo)
+int32 AutoBalance_UnitScript::_Modify_Damage_Healing(Unit* target, Unit* source, int32 amount, AutoBalanceCombatDecision& decision, SpellInfo const* spellInfo, bool debug)
 {
-    //
-    // Pre-flight Checks
-    //
-
-    // only debug if the source or target is a player
-    bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
-    _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
-
-    // check that we're enabled globally, else return the original value
-    if (!EnableGlobal)
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: EnableGlobal is false, returning original value of ({}).", amount);
-
-        return amount;
-    }
+    // the calling hook already decided whether this event is logged
+    bool _debug_damage_and_healing = debug;
 
     // if the source is gone (logged off? despawned?), use the same target and source.
     // hacky, but better than crashing or having the damage go to 1.0x
@@ -212,289 +244,171 @@ int32 AutoBalance_UnitScript::_Modify_Damage_Healing(Unit* target, Unit* source,
         source = target;
     }
 
-    // make sure the source and target are in an instance, else return the original damage
-    if (!(source->GetMap()->IsDungeon() && target->GetMap()->IsDungeon()))
-    {
-        //if (_debug_damage_and_healing)
-        //    LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Not in an instance, returning original value of ({}).", amount);
+    AutoBalanceMapInfo* sourceMapABInfo = nullptr;
+    AutoBalanceMapInfo* targetMapABInfo = nullptr;
 
+    decision.flags = _Damage_Healing_Flags(target, source, amount, spellInfo, sourceMapABInfo, targetMapABInfo);
+    decideDamageHealing(decision, amount);
+
+    // outside of instances nothing is logged or traced
+    if (decision.reason == AUTOBALANCE_TRACE_UNCHANGED)
         return amount;
+
+    switch (decision.multiplierSource)
+    {
+        case AUTOBALANCE_MULTIPLIER_SOURCE_MAP_WORLD:        decision.multiplier = sourceMapABInfo->worldDamageHealingMultiplier; break;
+        case AUTOBALANCE_MULTIPLIER_SOURCE_MAP_SCALED_WORLD: decision.multiplier = sourceMapABInfo->scaledWorldDamageHealingMultiplier; break;
+        case AUTOBALANCE_MULTIPLIER_TARGET_MAP_WORLD:        decision.multiplier = targetMapABInfo->worldDamageHealingMultiplier; break;
+        case AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD: decision.multiplier = targetMapABInfo->scaledWorldDamageHealingMultiplier; break;
+        case AUTOBALANCE_MULTIPLIER_SOURCE_DAMAGE:           decision.multiplier = source->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->DamageMultiplier; break;
+        case AUTOBALANCE_MULTIPLIER_SOURCE_SCALED_DAMAGE:    decision.multiplier = source->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->ScaledDamageMultiplier; break;
+        default: break;
     }
 
-    // make sure that the source is in the world, else return the original value
+    int32 modifiedAmount = applyDamageHealingDecision(decision, amount);
+
+    if (_debug_damage_and_healing)
+        LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: {} (flags {:#06x}, multiplier from {}), returning {}: ({}) * ({}) = ({}).",
+            getDecisionTraceReasonName(decision.reason),
+            decision.flags,
+            getCombatMultiplierSourceName(decision.multiplierSource),
+            amount <= 0 ? "damage" : "healing",
+            amount,
+            decision.multiplier,
+            modifiedAmount
+        );
+
+    _Trace_Decision(target, source, spellInfo ? spellInfo->Id : 0, Decision_Trace_Reason(decision.reason), amount, modifiedAmount, decision.multiplier);
+
+    return modifiedAmount;
+}
+
+uint32 AutoBalance_UnitScript::_Damage_Healing_Flags(Unit* target, Unit* source, int32 amount, SpellInfo const* spellInfo, AutoBalanceMapInfo*& sourceMapABInfo, AutoBalanceMapInfo*& targetMapABInfo)
+{
+    // each check only runs if the decision can still depend on it, in the order the decision makes them
+    uint32 flags = 0;
+
+    if (!EnableGlobal)
+        return flags;
+
+    flags |= AUTOBALANCE_DAMAGE_HEALING_GLOBAL_ENABLED;
+
+    if (!(source->GetMap()->IsDungeon() && target->GetMap()->IsDungeon()))
+        return flags;
+
+    flags |= AUTOBALANCE_DAMAGE_HEALING_IN_INSTANCE;
+
     if (!source->IsInWorld())
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source does not exist in the world, returning original value of ({}).", amount);
+        return flags;
 
-        return amount;
-    }
+    flags |= AUTOBALANCE_DAMAGE_HEALING_SOURCE_IN_WORLD;
 
-    // if the spell ID is in our "never modify" list, return the original value
-    if
-        (
-            spellInfo &&
-            spellInfo->Id &&
-            std::find
-            (
-                spellIdsToNeverModify.begin(),
-                spellIdsToNeverModify.end(),
-                spellInfo->Id
-            ) != spellIdsToNeverModify.end()
-            )
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Spell {}({}) is in the never modify list, returning original value of ({}).",
-                spellInfo->SpellName[0],
-                spellInfo->Id,
-                amount
-            );
+    uint32 spellId = spellInfo ? spellInfo->Id : 0;
 
-        return amount;
-    }
+    if (spellId && std::find(spellIdsToNeverModify.begin(), spellIdsToNeverModify.end(), spellId) != spellIdsToNeverModify.end())
+        return flags | AUTOBALANCE_DAMAGE_HEALING_SPELL_NEVER_MODIFIED;
 
-    // get the maps' info
-    AutoBalanceMapInfo* sourceMapABInfo = GetMapInfo(source->GetMap());
-    AutoBalanceMapInfo* targetMapABInfo = GetMapInfo(target->GetMap());
+    sourceMapABInfo = GetMapInfo(source->GetMap());
+    targetMapABInfo = GetMapInfo(target->GetMap());
 
-    // if either the target or the source's maps are not enabled, return the original damage
     if (!sourceMapABInfo->enabled || !targetMapABInfo->enabled)
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source or Target's map is not enabled, returning original value of ({}).", amount);
+        return flags;
 
-        return amount;
-    }
+    flags |= AUTOBALANCE_DAMAGE_HEALING_MAPS_ENABLED;
 
-    //
-    // Source and Target Checking
-    //
+    bool sourceIsPlayer = source->GetTypeId() == TYPEID_PLAYER;
+    bool sourceIsTarget = source->GetGUID() == target->GetGUID();
 
-    // if the source is a player and they are healing themselves, return the original value
-    if (source->GetTypeId() == TYPEID_PLAYER && source->GetGUID() == target->GetGUID() && amount >= 0)
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player that is self-healing, returning original value of ({}).", amount);
+    if (sourceIsPlayer)
+        flags |= AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER;
 
-        return amount;
-    }
-    // if the source is a player and they are damaging themselves, log to debug but continue
-    else if (source->GetTypeId() == TYPEID_PLAYER && source->GetGUID() == target->GetGUID() && amount < 0)
-    {
-        // if the spell used is in our list of spells to ignore, return the original value
-        if
-            (
-                spellInfo &&
-                spellInfo->Id &&
-                std::find
-                (
-                    spellIdsThatSpendPlayerHealth.begin(),
-                    spellIdsThatSpendPlayerHealth.end(),
-                    spellInfo->Id
-                ) != spellIdsThatSpendPlayerHealth.end()
-                )
-        {
-            if (_debug_damage_and_healing)
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player that is self-damaging with a spell that is ignored, returning original value of ({}).", amount);
+    if (source->GetTypeId() == TYPEID_UNIT)
+        flags |= AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_CREATURE;
 
-            return amount;
-        }
+    if (sourceIsTarget)
+        flags |= AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_TARGET;
 
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player that is self-damaging, continuing.");
-    }
-    // if the source is a player and they are damaging unit that is friendly, log to debug but continue
-    else if (source->GetTypeId() == TYPEID_PLAYER && target->IsFriendlyTo(source) && amount < 0)
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player that is damaging a friendly unit, continuing.");
-    }
-    // if the source is a player under any other condition, return the original value
-    else if (source->GetTypeId() == TYPEID_PLAYER)
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is an enemy player, returning original value of ({}).", amount);
+    if (target->GetTypeId() == TYPEID_PLAYER)
+        flags |= AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER;
 
-        return amount;
-    }
-    // if the creature is attacking itself with an aura with effect type SPELL_AURA_SHARE_DAMAGE_PCT, return the orginal damage
-    else if
-        (
-            source->GetTypeId() == TYPEID_UNIT &&
-            source->GetTypeId() != TYPEID_PLAYER &&
-            source->GetGUID() == target->GetGUID() &&
-            _isAuraWithEffectType(spellInfo, SPELL_AURA_SHARE_DAMAGE_PCT)
-            )
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a creature that is self-damaging with an aura that shares damage, returning original value of ({}).", amount);
+    if (sourceIsPlayer && sourceIsTarget && amount < 0 && spellId &&
+        std::find(spellIdsThatSpendPlayerHealth.begin(), spellIdsThatSpendPlayerHealth.end(), spellId) != spellIdsThatSpendPlayerHealth.end())
+        flags |= AUTOBALANCE_DAMAGE_HEALING_SPELL_SPENDS_HEALTH;
 
-        return amount;
-    }
+    if (sourceIsPlayer && !sourceIsTarget && amount < 0 && target->IsFriendlyTo(source))
+        flags |= AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_FRIENDLY;
+
+    if (!sourceIsPlayer && sourceIsTarget && _isAuraWithEffectType(spellInfo, SPELL_AURA_SHARE_DAMAGE_PCT))
+        flags |= AUTOBALANCE_DAMAGE_HEALING_SHARED_DAMAGE_AURA;
 
-    // if the source is under the control of the player, return the original damage
     // noteably, this should NOT include mind control targets
     if ((source->IsHunterPet() || source->IsPet() || source->IsSummon()) && source->IsControlledByPlayer())
-    {
-        if (_debug_damage_and_healing)
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player-controlled pet or summon, returning original value of ({}).", amount);
+        flags |= AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER_PET;
 
-        return amount;
-    }
+    if (_isAuraWithEffectType(spellInfo, SPELL_AURA_PERIODIC_DAMAGE_PERCENT))
+        flags |= AUTOBALANCE_DAMAGE_HEALING_PERCENT_HEALTH_AURA;
 
-    //
-    // Multiplier calculation
-    //
-    float damageMultiplier = 1.0f;
+    return flags;
+}
 
-    // if the source is a player AND the target is that same player AND the value is damage (negative), use the map's multiplier
-    if (source->GetTypeId() == TYPEID_PLAYER && source->GetGUID() == target->GetGUID() && amount < 0)
-    {
-        // if this aura damages based on a percent of the player's max health, use the un-level-scaled multiplier
-        if (_isAuraWithEffectType(spellInfo, SPELL_AURA_PERIODIC_DAMAGE_PERCENT))
-        {
-            damageMultiplier = sourceMapABInfo->worldDamageHealingMultiplier;
-            if (_debug_damage_and_healing)
-            {
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Spell damage based on percent of max health. Ignore level scaling.");
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                    "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player and the target is that same player, using the map's (level-scaling ignored) multiplier: ({})",
-                    damageMultiplier
-                );
-            }
-        }
-        else
-        {
-            damageMultiplier = sourceMapABInfo->scaledWorldDamageHealingMultiplier;
-            if (_debug_damage_and_healing)
-            {
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                    "AutoBalance_UnitScript::_Modify_Damage_Healing: Source is a player and the target is that same player, using the map's multiplier: ({})",
-                    damageMultiplier
-                );
-            }
-        }
-    }
-    // if the target is a player AND the value is healing (positive), use the map's damage multiplier
-    // (player to player healing was already eliminated in the Source and Target Checking section)
-    else if (target->GetTypeId() == TYPEID_PLAYER && amount >= 0)
-    {
-        damageMultiplier = targetMapABInfo->scaledWorldDamageHealingMultiplier;
-        if (_debug_damage_and_healing)
-        {
-            LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                "AutoBalance_UnitScript::_Modify_Damage_Healing: A non-player is healing a player, using the map's multiplier: ({})",
-                damageMultiplier
-            );
-        }
-    }
-    // if the target is a player AND the source is not a creature, use the map's multiplier
-    else if (target->GetTypeId() == TYPEID_PLAYER && source->GetTypeId() != TYPEID_UNIT && amount < 0)
-    {
-        // if this aura damages based on a percent of the player's max health, use the un-level-scaled multiplier
-        if (_isAuraWithEffectType(spellInfo, SPELL_AURA_PERIODIC_DAMAGE_PERCENT))
-        {
-            damageMultiplier = targetMapABInfo->worldDamageHealingMultiplier;
-            if (_debug_damage_and_healing)
-            {
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Spell damage based on percent of max health. Ignore level scaling.");
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                    "AutoBalance_UnitScript::_Modify_Damage_Healing: Target is a player and the source is not a creature, using the map's (level-scaling-ignored) multiplier: ({})",
-                    damageMultiplier
-                );
-            }
-        }
-        else
-        {
-            damageMultiplier = targetMapABInfo->scaledWorldDamageHealingMultiplier;
-            if (_debug_damage_and_healing)
-            {
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                    "AutoBalance_UnitScript::_Modify_Damage_Healing: Target is a player and the source is not a creature, using the map's multiplier: ({})",
-                    damageMultiplier
-                );
-            }
-        }
-    }
-    // otherwise, use the source creature's damage multiplier
-    else
-    {
-        // if this aura damages based on a percent of the player's max health, use the un-level-scaled multiplier
-        if (_isAuraWithEffectType(spellInfo, SPELL_AURA_PERIODIC_DAMAGE_PERCENT))
-        {
-            damageMultiplier = source->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->DamageMultiplier;
-            if (_debug_damage_and_healing)
-            {
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Spell damage based on percent of max health. Ignore level scaling.");
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                    "AutoBalance_UnitScript::_Modify_Damage_Healing: Using the source creature's (level-scaling ignored) damage multiplier: ({})",
-                    damageMultiplier
-                );
-            }
-        }
-        // non percent-based, used the normal multiplier
-        else
-        {
-            damageMultiplier = source->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->ScaledDamageMultiplier;
-            if (_debug_damage_and_healing)
-            {
-                LOG_DEBUG("module.AutoBalance_DamageHealingCC",
-                    "AutoBalance_UnitScript::_Modify_Damage_Healing: Using the source creature's damage multiplier: ({})",
-                    damageMultiplier
-                );
-            }
-        }
-    }
+uint32 AutoBalance_UnitScript::_Modifier_CCDuration(Unit* target, Unit* caster, Aura* aura, AutoBalanceCombatDecision& decision)
+{
+    decision.flags = _CC_Duration_Flags(target, caster, aura, decision.multiplier);
+    decideCCDuration(decision);
 
-    // we are good to go, return the original damage times the multiplier
-    if (_debug_damage_and_healing)
-        LOG_DEBUG("module.AutoBalance_DamageHealingCC", "AutoBalance_UnitScript::_Modify_Damage_Healing: Returning modified {}: ({}) * ({}) = ({})",
-            amount <= 0 ? "damage" : "healing",
-            amount,
-            damageMultiplier,
-            amount * damageMultiplier
-        );
+    int32 duration = applyCCDurationDecision(decision, aura->GetDuration());
+
+    if (decision.reason == AUTOBALANCE_TRACE_CC_DURATION)
+        _Trace_Decision(target, caster, aura->GetId(), AUTOBALANCE_TRACE_CC_DURATION, aura->GetDuration(), duration, decision.multiplier);
 
-    return amount * damageMultiplier;
+    return duration;
 }
 
-uint32 AutoBalance_UnitScript::_Modifier_CCDuration(Unit* target, Unit* caster, Aura* aura)
+uint32 AutoBalance_UnitScript::_CC_Duration_Flags(Unit* target, Unit* caster, Aura* aura, float& ccDurationMultiplier)
 {
-    // store the original duration of the aura
-    float originalDuration = (float)aura->GetDuration();
+    // each check only runs if the decision can still depend on it, in the order the decision makes them
+    uint32 flags = 0;
 
-    // check that we're enabled globally, else return the original duration
     if (!EnableGlobal)
-        return originalDuration;
+        return flags;
+
+    flags |= AUTOBALANCE_CC_DURATION_GLOBAL_ENABLED;
 
-    // ensure that both the target and the caster are defined
     if (!target || !caster)
-        return originalDuration;
+        return flags;
+
+    flags |= AUTOBALANCE_CC_DURATION_HAS_TARGET_AND_CASTER;
 
     // if the aura wasn't cast just now, don't change it
     if (aura->GetDuration() != aura->GetMaxDuration())
-        return originalDuration;
+        return flags;
 
-    // if the target isn't a player or the caster is a player, return the original duration
+    flags |= AUTOBALANCE_CC_DURATION_JUST_CAST;
+
+    if (target->IsPlayer())
+        flags |= AUTOBALANCE_CC_DURATION_TARGET_IS_PLAYER;
+
+    if (caster->IsPlayer())
+        flags |= AUTOBALANCE_CC_DURATION_CASTER_IS_PLAYER;
+
+    // only creatures' auras on players are scaled
     if (!target->IsPlayer() || caster->IsPlayer())
-        return originalDuration;
+        return flags;
 
-    // make sure we're in an instance, else return the original duration
     if (!(target->GetMap()->IsDungeon() && caster->GetMap()->IsDungeon()))
-        return originalDuration;
+        return flags;
 
-    // get the current creature's CC duration multiplier
-    float ccDurationMultiplier = caster->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->CCDurationMultiplier;
+    flags |= AUTOBALANCE_CC_DURATION_IN_INSTANCE;
+
+    // the decision's input; at the default of 1.0 nothing else matters
+    ccDurationMultiplier = caster->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo")->CCDurationMultiplier;
 
-    // if it's the default of 1.0, return the original damage
     if (ccDurationMultiplier == 1)
-        return originalDuration;
+        return flags;
 
-    // if the aura was cast by a pet or summon, return the original duration
     if ((caster->IsHunterPet() || caster->IsPet() || caster->IsSummon()) && caster->IsControlledByPlayer())
-        return originalDuration;
+        flags |= AUTOBALANCE_CC_DURATION_CASTER_IS_PLAYER_PET;
 
-    // only if this aura is a CC
     if (
         aura->HasEffectType(SPELL_AURA_MOD_CHARM) ||
         aura->HasEffectType(SPELL_AURA_MOD_CONFUSE) ||
@@ -506,11 +420,77 @@ uint32 AutoBalance_UnitScript::_Modifier_CCDuration(Unit* target, Unit* caster,
         aura->HasEffectType(SPELL_AURA_MOD_STUN) ||
         aura->HasEffectType(SPELL_AURA_MOD_SPEED_SLOW_ALL)
         )
+        flags |= AUTOBALANCE_CC_DURATION_IS_CROWD_CONTROL;
+
+    return flags;
+}
+
+bool AutoBalance_UnitScript::_Should_Debug_Damage_Healing(Unit* target, Unit* source, uint32 spellId)
+{
+    // cheapest check first: nothing is written unless the channel is at debug level
+    if (!sLog->ShouldLog("module.AutoBalance_DamageHealingCC", LOG_LEVEL_DEBUG))
+        return false;
+
+    // only events in instances are logged
+    Unit* mapUnit = source ? source : target;
+    if (!mapUnit || !mapUnit->GetMap()->GetInstanceId())
+        return false;
+
+    // spell filter
+    if (!DamageHealingDebugSpellIds.empty() && DamageHealingDebugSpellIds.find(spellId) == DamageHealingDebugSpellIds.end())
+        return false;
+
+    // creature filter, either side of the event may match
+    if (!DamageHealingDebugCreatureIds.empty())
     {
-        return originalDuration * ccDurationMultiplier;
+        bool sourceMatches = source && source->ToCreature() && DamageHealingDebugCreatureIds.count(source->GetEntry());
+        bool targetMatches = target && target->ToCreature() && DamageHealingDebugCreatureIds.count(target->GetEntry());
+
+        if (!sourceMatches && !targetMatches)
+            return false;
     }
-    else
-        return originalDuration;
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(mapUnit->GetMap());
+
+    // 1-in-N sampling, counted per map
+    if (DamageHealingDebugSampleRate > 1 && (mapABInfo->debugEventCount++ % DamageHealingDebugSampleRate) != 0)
+        return false;
+
+    // per-map token bucket, refilled at MaxPerSecond and holding at most one second's worth of tokens
+    if (DamageHealingDebugMaxPerSecond)
+    {
+        uint32 now = getMSTime();
+        float refill = getMSTimeDiff(mapABInfo->debugTokenTime, now) / 1000.0f * DamageHealingDebugMaxPerSecond;
+
+        mapABInfo->debugTokenTime = now;
+        mapABInfo->debugTokens    = std::min<float>(DamageHealingDebugMaxPerSecond, mapABInfo->debugTokens + refill);
+
+        if (mapABInfo->debugTokens < 1.0f)
+            return false;
+
+        mapABInfo->debugTokens -= 1.0f;
+    }
+
+    return true;
+}
+
+void AutoBalance_UnitScript::_Trace_Decision(Unit* target, Unit* source, uint32 spellId, Decision_Trace_Reason reason, int32 amountIn, int32 amountOut, float multiplier)
+{
+    // only instances keep a decision trace
+    if (!DecisionTraceEnable || !target || !target->GetMap()->IsDungeon())
+        return;
+
+    AutoBalanceDecisionTraceEntry entry;
+    entry.timestamp   = getMSTime();
+    entry.spellId     = spellId;
+    entry.sourceEntry = (source && source->GetTypeId() != TYPEID_PLAYER) ? source->GetEntry() : 0;
+    entry.targetEntry = target->GetTypeId() != TYPEID_PLAYER ? target->GetEntry() : 0;
+    entry.amountIn    = amountIn;
+    entry.amountOut   = amountOut;
+    entry.multiplier  = multiplier;
+    entry.reason      = reason;
+
+    GetMapInfo(target->GetMap())->decisionTrace.Record(entry);
 }
 
 bool AutoBalance_UnitScript::_isAuraWithEffectType(SpellInfo const* spellInfo, AuraType auraType, bool log)
@@ -5,6 +5,8 @@
 #ifndef __AB_UNIT_SCRIPT_H
 #define __AB_UNIT_SCRIPT_H
 
+#include "ABCombatDecision.h"
+#include "ABMapInfo.h"
 #include "AutoBalance.h"
 
 #include "ScriptMgr.h"
@@ -20,7 +22,8 @@ public:
             UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN,
             UNITHOOK_MODIFY_MELEE_DAMAGE,
             UNITHOOK_MODIFY_HEAL_RECEIVED,
-            UNITHOOK_ON_AURA_APPLY
+            UNITHOOK_ON_AURA_APPLY,
+            UNITHOOK_ON_UNIT_DEATH
         })
     {
     }
@@ -30,13 +33,18 @@ public:
     void ModifyMeleeDamage(Unit* target, Unit* source, uint32& amount) override;
     void ModifyHealReceived(Unit* target, Unit* source, uint32& amount, SpellInfo const* spellInfo) override;
     void OnAuraApply(Unit* unit, Aura* aura) override;
+    void OnUnitDeath(Unit* unit, Unit* killer) override;
 
 private:
     [[maybe_unused]] bool _debug_damage_and_healing = false; // defaults to false, overwritten in each function
 
     void   _Debug_Output(std::string function_name, Unit* target, Unit* source, int32 amount, Damage_Healing_Debug_Phase phase, std::string spell_name = "Unknown Spell", uint32 spell_id = 0);
-    int32  _Modify_Damage_Healing(Unit* target, Unit* source, int32 amount, SpellInfo const* spellInfo = nullptr);
-    uint32 _Modifier_CCDuration(Unit* target, Unit* caster, Aura* aura);
+    bool   _Should_Debug_Damage_Healing(Unit* target, Unit* source, uint32 spellId);
+    int32  _Modify_Damage_Healing(Unit* target, Unit* source, int32 amount, AutoBalanceCombatDecision& decision, SpellInfo const* spellInfo = nullptr, bool debug = false);
+    uint32 _Damage_Healing_Flags(Unit* target, Unit* source, int32 amount, SpellInfo const* spellInfo, AutoBalanceMapInfo*& sourceMapABInfo, AutoBalanceMapInfo*& targetMapABInfo);
+    uint32 _Modifier_CCDuration(Unit* target, Unit* caster, Aura* aura, AutoBalanceCombatDecision& decision);
+    uint32 _CC_Duration_Flags(Unit* target, Unit* caster, Aura* aura, float& ccDurationMultiplier);
+    void   _Trace_Decision(Unit* target, Unit* source, uint32 spellId, Decision_Trace_Reason reason, int32 amountIn, int32 amountOut, float multiplier = 1.0f);
     bool   _isAuraWithEffectType(SpellInfo const* spellInfo, AuraType auraType, bool log = false);
 };
 
@@ -6,13 +6,20 @@
 
 #include "ABConfig.h"
 #include "ABCreatureInfo.h"
+#include "ABEncounterTelemetry.h"
+#include "ABInstanceRegistry.h"
 #include "ABMapInfo.h"
+#include "ABMapInfoPool.h"
 
+#include "Configuration/Config.h"
+#include "DBCStores.h"
 #include "Log.h"
+#include "ObjectMgr.h"
 #include "Player.h"
 #include "Group.h"
 #include "TemporarySummon.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <sstream>
@@ -41,6 +48,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
     InstanceMap*             instanceMap    = map->ToInstanceMap();
     AutoBalanceMapInfo*      mapABInfo      = GetMapInfo(instanceMap);
     AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+    AutoBalanceCreaturePolicy const& policy = GetCreaturePolicy(creature, creatureABInfo);
 
     //
     // Handle summoned creatures
@@ -83,7 +91,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
                 //
                 // If the creature or its summoner is a trigger
                 //
-                if (creature->IsTrigger() || summoner->IsTrigger())
+                if (policy.isTrigger || GetCreaturePolicy(summoner, summonerABInfo).isTrigger)
                 {
                     LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | or their summoner is a trigger.",
                         creature->GetName(),
@@ -174,7 +182,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
         //
         // Pets and totems
         //
-        else if (creature->IsCreatedByPlayer() || creature->IsPet() || creature->IsHunterPet() || creature->IsTotem())
+        else if (creature->IsCreatedByPlayer() || creature->IsPet() || creature->IsHunterPet() || policy.isTotem)
         {
             LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | is a {}. Original level set to ({}).",
                 creature->GetName(),
@@ -200,7 +208,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
     //
     // Handle "special" creatures
     //
-    else if (creature->IsCritter() || creature->IsTotem() || creature->IsTrigger())
+    else if (policy.isCritter || policy.isTotem || policy.isTrigger)
     {
         //
         // If this is an intentionally-low-level creature (below 85% of the minimum LFG level), leave it where it is
@@ -214,7 +222,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
             LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | is a {} and is outside the expected NPC level for this map ({} to {}). Keeping original level of {}.",
                 creature->GetName(),
                 creatureABInfo->UnmodifiedLevel,
-                creature->IsCritter() ? "critter" : creature->IsTotem() ? "totem" : "trigger",
+                policy.isCritter ? "critter" : policy.isTotem ? "totem" : "trigger",
                 (uint8)(((float)mapABInfo->lfgMinLevel * .85f) + 0.5f),
                 (uint8)(((float)mapABInfo->lfgMaxLevel * 1.15f) + 0.5f),
                 creatureABInfo->UnmodifiedLevel);
@@ -229,7 +237,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
             LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | is a {} and is within the expected NPC level for this map ({} to {}). Keeping original level of {}.",
                 creature->GetName(),
                 creatureABInfo->UnmodifiedLevel,
-                creature->IsCritter() ? "critter" : creature->IsTotem() ? "totem" : "trigger",
+                policy.isCritter ? "critter" : policy.isTotem ? "totem" : "trigger",
                 (uint8)(((float)mapABInfo->lfgMinLevel * .85f) + 0.5f),
                 (uint8)(((float)mapABInfo->lfgMaxLevel * 1.15f) + 0.5f),
                 creatureABInfo->UnmodifiedLevel);
@@ -261,12 +269,12 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
     // If this is a non-relevant creature, skip for stats
     //
 
-    if (creature->IsCritter() || creature->IsTotem() || creature->IsTrigger())
+    if (policy.isCritter || policy.isTotem || policy.isTrigger)
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) | is a {} and will not affect the map's stats.",
             creature->GetName(),
             creatureABInfo->UnmodifiedLevel,
-            creature->IsCritter() ? "critter" : creature->IsTotem() ? "totem" : "trigger");
+            policy.isCritter ? "critter" : policy.isTotem ? "totem" : "trigger");
         return;
     }
 
@@ -348,7 +356,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
             creature->HasNpcFlag(UNIT_NPC_FLAG_REPAIR) ||
             creature->HasUnitFlag(UNIT_FLAG_IMMUNE_TO_PC) ||
             creature->HasUnitFlag(UNIT_FLAG_NOT_SELECTABLE)) &&
-            (!isBossOrBossSummon(creature)))
+            (!policy.isBoss))
         {
             LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) | is a a vendor, trainer, or is otherwise not attackable - do not include in map stats.", creature->GetName(), creatureABInfo->UnmodifiedLevel);
 
@@ -374,7 +382,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
                 // If the creature is friendly and not a boss
                 //
 
-                if (creature->IsFriendlyTo(thisPlayer) && !isBossOrBossSummon(creature))
+                if (creature->IsFriendlyTo(thisPlayer) && !policy.isBoss)
                 {
                     LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) | is friendly to {} - do not include in map stats.",
                         creature->GetName(),
@@ -439,6 +447,18 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
 
         creatureABInfo->isActive = true;
 
+        //
+        // Spawned creatures are already accounted for in the map's spawn profile
+        //
+
+        if (mapABInfo->hasLevelProfile && creature->GetSpawnId())
+        {
+            mapABInfo->activeCreatureCount++;
+
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::AddCreatureToMapCreatureList: Creature {} ({}) | is included in map stats (active) via the spawn profile.", creature->GetName(), creatureABInfo->UnmodifiedLevel);
+            return;
+        }
+
         //
         // Update the highest and lowest creature levels
         //
@@ -470,7 +490,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList, bo
         // If the average creature level transitions from one whole number to the next, reset the map's config time so it will refresh
         //
 
-        if (round(oldAvgCreatureLevel) != round(newAvgCreatureLevel))
+        if (round(oldAvgCreatureLevel) != round(newAvgCreatureLevel) && !mapABInfo->spawnBurstActive)
         {
             mapABInfo->mapConfigTime = 1;
 
@@ -544,208 +564,168 @@ void RemoveCreatureFromMapData(Creature* creature)
             }
         }
     }
-}
 
-uint64_t GetCurrentConfigTime()
-{
-    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    //
+    // Remove the creature from the scalable creature list and the update queue
+    //
+
+    UnregisterScalableCreature(creature);
 }
 
-uint32 getBaseExpansionValueForLevel(const uint32 baseValues[3], uint8 targetLevel)
+void RegisterScalableCreature(Creature* creature)
 {
-    // convert baseValues from an array of uint32 to an array of float
-    float floatBaseValues[3];
+    if (!creature || !creature->GetMap() || !creature->GetMap()->IsDungeon() || !creature->GetMap()->GetInstanceId())
+        return;
+
+    AutoBalanceMapInfo*      mapABInfo      = GetMapInfo(creature->GetMap());
+    AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
-    for (int i = 0; i < 3; i++)
-        floatBaseValues[i] = (float)baseValues[i];
+    if (creatureABInfo->isInScalableList)
+        return;
 
-    // return the result
-    return getBaseExpansionValueForLevel(floatBaseValues, targetLevel);
+    mapABInfo->allScalableCreatures.push_back(creature);
+    creatureABInfo->isInScalableList = true;
 }
 
-float getBaseExpansionValueForLevel(const float baseValues[3], uint8 targetLevel)
+void UnregisterScalableCreature(Creature* creature)
 {
-    // the database holds multiple base values depending on the expansion
-    // this function returns the correct base value for the given level and
-    // smooths the transition between expansions
-
-    float vanillaValue = baseValues[0];
-    float bcValue      = baseValues[1];
-    float wotlkValue   = baseValues[2];
+    if (!creature || !creature->GetMap())
+        return;
 
-    float returnValue;
+    AutoBalanceMapInfo*      mapABInfo      = GetMapInfo(creature->GetMap());
+    AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
 
-    // vanilla
-    if (targetLevel <= 60)
+    if (creatureABInfo->isInScalableList)
     {
-        returnValue = vanillaValue;
-        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning Vanilla = {}", returnValue);
+        mapABInfo->allScalableCreatures.erase(std::remove(mapABInfo->allScalableCreatures.begin(), mapABInfo->allScalableCreatures.end(), creature), mapABInfo->allScalableCreatures.end());
+        creatureABInfo->isInScalableList = false;
     }
-    // transition from vanilla to BC
-    else if (targetLevel < 63)
-    {
-        float vanillaMultiplier = (63 - targetLevel) / 3.0;
-        float bcMultiplier      = 1.0f - vanillaMultiplier;
 
-        returnValue = (vanillaValue * vanillaMultiplier) + (bcValue * bcMultiplier);
-        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning Vanilla/BC = {}", returnValue);
-    }
-    // BC
-    else if (targetLevel <= 70)
+    if (creatureABInfo->isInUpdateQueue)
     {
-        returnValue = bcValue;
-        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning BC = {}", returnValue);
+        mapABInfo->creatureUpdateQueue.erase(std::remove(mapABInfo->creatureUpdateQueue.begin(), mapABInfo->creatureUpdateQueue.end(), creature), mapABInfo->creatureUpdateQueue.end());
+        creatureABInfo->isInUpdateQueue = false;
     }
-    // transition from BC to WotLK
-    else if (targetLevel < 73)
-    {
-        float bcMultiplier    = (73 - targetLevel) / 3.0f;
-        float wotlkMultiplier = 1.0f - bcMultiplier;
+}
 
-        returnValue = (bcValue * bcMultiplier) + (wotlkValue * wotlkMultiplier);
-        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning BC/WotLK = {}", returnValue);
-    }
-    // WotLK
-    else
-    {
-        returnValue = wotlkValue;
-        //LOG_DEBUG("module.AutoBalance", "AutoBalance::getBaseExpansionValueForLevel: Returning WotLK = {}", returnValue);
-    }
+void QueueCreatureForUpdate(Creature* creature)
+{
+    if (!creature || !creature->GetMap() || !creature->GetMap()->IsDungeon() || !creature->GetMap()->GetInstanceId())
+        return;
 
-    return returnValue;
+    AutoBalanceMapInfo*      mapABInfo      = GetMapInfo(creature->GetMap());
+    AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+
+    if (creatureABInfo->isInUpdateQueue)
+        return;
+
+    mapABInfo->creatureUpdateQueue.push_back(creature);
+    creatureABInfo->isInUpdateQueue = true;
 }
 
-// Helper function to calculate normalized value using tanh formula
-static float calculateTanFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+bool JoinSpawnBurst(Creature* creature)
 {
-    return ((tanh((adjustedPlayerCount - inflectionValue) / diff) + 1.0f) / 2.0f);
+    //
+    // Summons (and anything else that isn't loaded from the database) are always scaled immediately
+    //
+
+    if (!SpawnBurst || !creature || creature->IsSummon() || !creature->GetSpawnId())
+        return false;
+
+    Map* map = creature->GetMap();
+
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return false;
+
+    AutoBalanceMapInfo*      mapABInfo      = GetMapInfo(map);
+    AutoBalanceCreatureInfo* creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+
+    if (!mapABInfo->spawnBurstActive)
+    {
+        mapABInfo->spawnBurstActive        = true;
+        mapABInfo->spawnBurstCreatureCount = 0;
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::JoinSpawnBurst: Map {} ({}{}) | Spawn burst started.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "");
+    }
+
+    creatureABInfo->isInSpawnBurst = true;
+    mapABInfo->spawnBurstCreatureCount++;
+
+    return true;
 }
 
-// Helper function to calculate normalized value using logarithmic formula
-static float calculateLogFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+void QueueMapCreaturesForUpdate(Map* map)
 {
-    // Calculate normalized input similar to tanh: (adjustedPlayerCount - inflectionValue) / diff
-    float normalized = (adjustedPlayerCount - inflectionValue) / diff;
-    // For logarithmic scaling, we want a curve that starts slow and accelerates
-    // Use sigmoid-like logarithmic function that maps [-inf, inf] to [0, 1]
-    // Shift and scale to match tanh's effective range
-    float shifted = normalized + 5.0f; // Shift to positive range
-    // Apply logarithmic scaling: log(1 + shifted) normalized
-    // The division factor controls the steepness of the curve
-    float logValue = log1p(shifted) / log1p(10.0f);
-    return std::max(0.0f, std::min(1.0f, logValue));
+    if (!map || !map->IsDungeon() || !map->GetInstanceId())
+        return;
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    mapABInfo->allCreaturesNeedUpdate = true;
 }
 
-// Helper function to calculate normalized value using exponential formula
-static float calculateExpFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+void ResetMapCreatureLevelStats(Map* map)
 {
-    // Calculate normalized input similar to tanh: (adjustedPlayerCount - inflectionValue) / diff
-    float normalized = (adjustedPlayerCount - inflectionValue) / diff;
-    // For exponential scaling, we want a curve that starts fast and decelerates
-    // Use inverse sigmoid-like exponential function that maps [-inf, inf] to [0, 1]
-    // Shift to handle negative values
-    float shifted = normalized + 5.0f; // Shift to positive range
-    // Apply exponential scaling: (exp(shifted/k) - 1) / (exp(max/k) - 1)
-    // k controls the steepness - smaller k = steeper curve
-    float k = 3.0f;
-    float expValue = (exp(shifted / k) - 1.0f) / (exp(10.0f / k) - 1.0f);
-    return std::max(0.0f, std::min(1.0f, expValue));
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    //
+    // Maps with a spawn profile start from the profiled levels, others rebuild them from the active creatures
+    //
+
+    if (mapABInfo->hasLevelProfile)
+    {
+        mapABInfo->highestCreatureLevel = mapABInfo->profileHighestCreatureLevel;
+        mapABInfo->lowestCreatureLevel  = mapABInfo->profileLowestCreatureLevel;
+        mapABInfo->avgCreatureLevel     = mapABInfo->profileAvgCreatureLevel;
+    }
+    else
+    {
+        mapABInfo->highestCreatureLevel = 0;
+        mapABInfo->lowestCreatureLevel  = 0;
+    }
+
+    mapABInfo->activeCreatureCount = 0;
 }
 
-// Helper function to calculate normalized value using polynomial formula
-static float calculatePolFormula(float adjustedPlayerCount, float inflectionValue, float maxPlayers, float diff)
+uint64_t GetCurrentConfigTime()
 {
-    // Calculate normalized input: player count normalized to [0, 1] range
-    float normalized = adjustedPlayerCount / maxPlayers;
-    
-    // For polynomial scaling, the inflectionValue is passed as (maxPlayers * configValue)
-    // We need to extract the original config value by dividing by maxPlayers
-    // This is because other formulas use inflectionValue as an absolute offset,
-    // but for POL we use it as the exponent/power directly
-    float power = inflectionValue / maxPlayers;
-    
-    // Apply polynomial scaling: normalized^power
-    // Higher power = steeper curve, power of 2 gives moderate curve
-    float polValue = pow(std::max(0.0f, normalized), power);
-    
-    //LOG_INFO("module.AutoBalance", "calculatePolFormula: adjustedPlayerCount={}, inflectionValue={}, maxPlayers={}, normalized={}, power={} (extracted from inflectionValue/maxPlayers), polValue={}",
-    //    adjustedPlayerCount, inflectionValue, maxPlayers, normalized, power, polValue);
-    
-    return polValue;
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 }
 
 float getDefaultMultiplier(Map* map, AutoBalanceInflectionPointSettings inflectionPointSettings, FormulaType formulaType)
 {
-    // You can visually see the effects of this function by using this spreadsheet:
-    // https://docs.google.com/spreadsheets/d/100cmKIJIjCZ-ncWd0K9ykO8KUgwFTcwg4h2nfE_UeCc/copy
-
     //
     // Get the max player count for the map
     //
-    uint32 maxNumberOfPlayers = map->ToInstanceMap()->GetMaxPlayers();
-
-    //
-    // Get the adjustedPlayerCount for this instance
-    //
-    AutoBalanceMapInfo *mapABInfo = GetMapInfo(map);
-    float adjustedPlayerCount     = mapABInfo->adjustedPlayerCount;
-
-    //
-    // #maththings
-    //
-    float diff = ((float)maxNumberOfPlayers/5)*1.5f;
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+    uint32 maxNumberOfPlayers     = mapABInfo->descriptor ? mapABInfo->descriptor->maxPlayers : map->ToInstanceMap()->GetMaxPlayers();
 
     //
-    // Calculate the normalized value [0, 1] based on the selected formula
+    // The curve itself lives in the scaling core
     //
-    float normalizedValue = 0.0f;
-    
-    switch (formulaType)
-    {
-        case AUTOBALANCE_FORMULA_LOG:
-            normalizedValue = calculateLogFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
-            break;
-        case AUTOBALANCE_FORMULA_EXP:
-            normalizedValue = calculateExpFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
-            break;
-        case AUTOBALANCE_FORMULA_POL:
-            normalizedValue = calculatePolFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
-            break;
-        case AUTOBALANCE_FORMULA_TAN:
-        default:
-            normalizedValue = calculateTanFormula(adjustedPlayerCount, inflectionPointSettings.value, maxNumberOfPlayers, diff);
-            break;
-    }
+    return calculateCurveMultiplier(mapABInfo->adjustedPlayerCount, maxNumberOfPlayers, inflectionPointSettings, formulaType);
+}
 
-    //
-    // For tanh formula, apply the curveCeiling adjustment for backwards compatibility
-    // For other formulas, use a simpler approach
-    //
-    float curveCeilingAdjustment = 1.0f;
-    if (formulaType == AUTOBALANCE_FORMULA_TAN)
-    {
-        // For math reasons that I do not understand, curveCeiling needs to be adjusted to bring the actual multiplier
-        // closer to the curveCeiling setting. Create an adjustment based on how much the ceiling should be changed at
-        // the max players multiplier.
-        float maxNormalizedValue = calculateTanFormula((float)maxNumberOfPlayers, inflectionPointSettings.value, maxNumberOfPlayers, diff);
-        float maxMultiplier = maxNormalizedValue * (inflectionPointSettings.curveCeiling - inflectionPointSettings.curveFloor) + inflectionPointSettings.curveFloor;
-        if (maxMultiplier > 0.0f)
-            curveCeilingAdjustment = inflectionPointSettings.curveCeiling / maxMultiplier;
-    }
+AutoBalanceScalingMap GetScalingMap(AutoBalanceMapDescriptor const* descriptor)
+{
+    AutoBalanceScalingMap scalingMap;
 
-    //
-    // Adjust the multiplier based on the configured floor and ceiling values
-    //
-    float defaultMultiplier =
-        normalizedValue *
-        (inflectionPointSettings.curveCeiling * curveCeilingAdjustment - inflectionPointSettings.curveFloor) +
-        inflectionPointSettings.curveFloor;
+    scalingMap.maxPlayers               = descriptor->maxPlayers;
+    scalingMap.isHeroic                 = descriptor->isHeroic;
+    scalingMap.dungeonOverride          = descriptor->hasDungeonOverride          ? &descriptor->dungeonOverride          : nullptr;
+    scalingMap.bossOverride             = descriptor->hasBossOverride             ? &descriptor->bossOverride             : nullptr;
+    scalingMap.statModifierOverride     = descriptor->hasStatModifierOverride     ? &descriptor->statModifierOverride     : nullptr;
+    scalingMap.statModifierBossOverride = descriptor->hasStatModifierBossOverride ? &descriptor->statModifierBossOverride : nullptr;
 
-    /*LOG_INFO("module.AutoBalance", "getDefaultMultiplier: finalMultiplier={} (normalizedValue={} * range={} + floor={}) * adjustment={}",
-        defaultMultiplier, normalizedValue, (inflectionPointSettings.curveCeiling * curveCeilingAdjustment - inflectionPointSettings.curveFloor),
-        inflectionPointSettings.curveFloor, curveCeilingAdjustment);*/
+    return scalingMap;
+}
 
-    return defaultMultiplier;
+CreatureCurveMultipliers getCurveMultipliers(InstanceMap* instanceMap, bool isBoss)
+{
+    return calculateCurveMultipliers(ScalingSettings, GetScalingMap(GetInstanceMapDescriptor(instanceMap)), isBoss, GetMapInfo(instanceMap)->adjustedPlayerCount);
 }
 
 int GetForcedNumPlayers(int creatureId)
@@ -756,6 +736,26 @@ int GetForcedNumPlayers(int creatureId)
     return forcedCreatureIds[creatureId];
 }
 
+static AutoBalanceCachedBaseValues CalculateBaseValues(uint8 level, Classes unitClass)
+{
+    CreatureBaseStats const* baseStats = sObjectMgr->GetCreatureBaseStats(level, unitClass);
+
+    AutoBalanceCachedBaseValues baseValues;
+    baseValues.health = getBaseExpansionValueForLevel(baseStats->BaseHealth, level);
+    baseValues.damage = getBaseExpansionValueForLevel(baseStats->BaseDamage, level);
+
+    return baseValues;
+}
+
+// Precomputed at startup, the base stats are only looked up if the cache isn't loaded
+static AutoBalanceCachedBaseValues GetWarriorBaseValues(uint8 level)
+{
+    if (AutoBalanceCachedBaseValues const* baseValues = precomputeCache.GetBaseValues(AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_WARRIOR, level))
+        return *baseValues;
+
+    return CalculateBaseValues(level, CLASS_WARRIOR);
+}
+
 World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType)
 {
     World_Multipliers worldMultipliers;
@@ -808,51 +808,11 @@ World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType)
     uint8 avgCreatureLevelRounded = (uint8)(mapABInfo->avgCreatureLevel + 0.5f);
 
     //
-    // Get the inflection point settings for this map
-    //
-
-    // Use appropriate stat type based on baseValueType
-    StatType statType = (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) ? AUTOBALANCE_STAT_HEALTH : AUTOBALANCE_STAT_DAMAGE;
-    AutoBalanceInflectionPointSettings inflectionPointSettings = getInflectionPointSettings(instanceMap, false, statType);
-
-    //
-    // Generate the default multiplier before level scaling
-    // This value is only based on the adjusted number of players in the instance
-    //
-
-    float worldMultiplier   = 1.0f;
-    FormulaType formulaType = (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) ? FormulaTypeHealth : FormulaTypeDamage;
-    float defaultMultiplier = getDefaultMultiplier(map, inflectionPointSettings, formulaType);
-
-    LOG_DEBUG("module.AutoBalance",
-        "AutoBalance::getWorldMultiplier: Map {} ({}) {} | defaultMultiplier ({}) = getDefaultMultiplier(map, inflectionPointSettings)",
-        map->GetMapName(),
-        avgCreatureLevelRounded,
-        baseValueType == BaseValueType::AUTOBALANCE_HEALTH ? "health" : "damage",
-        defaultMultiplier
-    );
-
-    //
-    // Multiply by the appropriate stat modifiers
+    // Generate the multiplier before level scaling
+    // This value is only based on the adjusted number of players in the instance and the map's stat modifiers
     //
-    AutoBalanceStatModifiers statModifiers = getStatModifiers(map);
-
-    if (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) // health
-        worldMultiplier = defaultMultiplier * statModifiers.global * statModifiers.health;
-    else // damage
-        worldMultiplier = defaultMultiplier * statModifiers.global * statModifiers.damage;
 
-    LOG_DEBUG("module.AutoBalance",
-        "AutoBalance::getWorldMultiplier: Map {} ({}) {} | worldMultiplier ({}) = defaultMultiplier ({}) * statModifiers.global ({}) * statModifiers.{} ({})",
-        map->GetMapName(),
-        avgCreatureLevelRounded,
-        baseValueType == BaseValueType::AUTOBALANCE_HEALTH ? "health" : "damage",
-        worldMultiplier,
-        defaultMultiplier,
-        statModifiers.global,
-        baseValueType == BaseValueType::AUTOBALANCE_HEALTH ? "health" : "damage",
-        baseValueType == BaseValueType::AUTOBALANCE_HEALTH ? statModifiers.health : statModifiers.damage
-    );
+    float worldMultiplier = calculateWorldMultiplier(ScalingSettings, GetScalingMap(GetInstanceMapDescriptor(instanceMap)), baseValueType, mapABInfo->adjustedPlayerCount);
 
     //
     // Store the unscaled multiplier
@@ -870,12 +830,7 @@ World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType)
     // Only scale based on level if level scaling is enabled and the instance's average creature level is not within the skip range
     //
 
-    if (LevelScaling &&
-            (
-                (mapABInfo->avgCreatureLevel > mapABInfo->highestPlayerLevel + mapABInfo->levelScalingSkipHigherLevels || mapABInfo->levelScalingSkipHigherLevels == 0) ||
-                (mapABInfo->avgCreatureLevel < mapABInfo->highestPlayerLevel - mapABInfo->levelScalingSkipLowerLevels || mapABInfo->levelScalingSkipLowerLevels == 0)
-            )
-        )
+    if (isWorldMultiplierLevelScaled(LevelScaling, mapABInfo->avgCreatureLevel, mapABInfo->highestPlayerLevel, mapABInfo->levelScalingSkipHigherLevels, mapABInfo->levelScalingSkipLowerLevels))
     {
         mapABInfo->worldMultiplierTargetLevel = mapABInfo->highestPlayerLevel;
 
@@ -890,29 +845,14 @@ World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType)
         // Use creature base stats to determine how to level scale the multiplier (the map is a warrior!)
         //
 
-        CreatureBaseStats const* origMapBaseStats     = sObjectMgr->GetCreatureBaseStats(avgCreatureLevelRounded, Classes::CLASS_WARRIOR);
-        CreatureBaseStats const* adjustedMapBaseStats = sObjectMgr->GetCreatureBaseStats(mapABInfo->worldMultiplierTargetLevel, Classes::CLASS_WARRIOR);
+        AutoBalanceCachedBaseValues origMapBaseValues     = GetWarriorBaseValues(avgCreatureLevelRounded);
+        AutoBalanceCachedBaseValues adjustedMapBaseValues = GetWarriorBaseValues(mapABInfo->worldMultiplierTargetLevel);
 
         //
         // Original Base Value
         //
 
-        float originalBaseValue;
-
-        if (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) // health
-        {
-            originalBaseValue = getBaseExpansionValueForLevel(
-                origMapBaseStats->BaseHealth,
-                avgCreatureLevelRounded
-            );
-        }
-        else // damage
-        {
-            originalBaseValue = getBaseExpansionValueForLevel(
-                origMapBaseStats->BaseDamage,
-                avgCreatureLevelRounded
-            );
-        }
+        float originalBaseValue = baseValueType == BaseValueType::AUTOBALANCE_HEALTH ? origMapBaseValues.health : origMapBaseValues.damage;
 
         LOG_DEBUG("module.AutoBalance", "AutoBalance::getWorldMultiplier: Map {} ({}) {} | base is {}.",
             map->GetMapName(),
@@ -925,22 +865,7 @@ World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType)
         // New Base Value
         //
 
-        float newBaseValue;
-
-        if (baseValueType == BaseValueType::AUTOBALANCE_HEALTH) // health
-        {
-            newBaseValue = getBaseExpansionValueForLevel(
-                adjustedMapBaseStats->BaseHealth,
-                mapABInfo->worldMultiplierTargetLevel
-            );
-        }
-        else // damage
-        {
-            newBaseValue = getBaseExpansionValueForLevel(
-                adjustedMapBaseStats->BaseDamage,
-                mapABInfo->worldMultiplierTargetLevel
-            );
-        }
+        float newBaseValue = baseValueType == BaseValueType::AUTOBALANCE_HEALTH ? adjustedMapBaseValues.health : adjustedMapBaseValues.damage;
 
         LOG_DEBUG("module.AutoBalance", "AutoBalance::getWorldMultiplier: Map {} ({}->{}) {} | base is {}.",
             map->GetMapName(),
@@ -1022,1076 +947,137 @@ World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType)
 
 AutoBalanceInflectionPointSettings getInflectionPointSettings (InstanceMap* instanceMap, bool isBoss, StatType statType)
 {
-    uint32 maxNumberOfPlayers = instanceMap->GetMaxPlayers();
-    uint32 mapId              = instanceMap->GetEntry()->MapID;
+    return getInflectionPointSettings(GetInstanceMapDescriptor(instanceMap), isBoss, statType);
+}
 
-    float  inflectionValue    = (float)maxNumberOfPlayers;
-    float  curveFloor;
-    float  curveCeiling;
-    float  statSpecificInflection = -1.0f; // -1 indicates not set
+AutoBalanceInflectionPointSettings getInflectionPointSettings (AutoBalanceMapDescriptor const* descriptor, bool isBoss, StatType statType)
+{
+    return selectInflectionPointSettings(ScalingSettings, GetScalingMap(descriptor), isBoss, statType);
+}
 
-    //
-    // Check for stat-specific inflection point first
-    //
+// Helper function to get stat modifiers for a given boss status without needing a creature
+AutoBalanceStatModifiers getStatModifiersForDisplay(Map* map, bool isBoss)
+{
+    return getStatModifiersForDisplay(GetInstanceMapDescriptor(map->ToInstanceMap()), isBoss);
+}
 
-    // Determine stat-specific inflection point based on instance type and stat
-    if (instanceMap->IsHeroic())
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            // Check for stat-specific inflection point
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointHeroicHealth >= 0.0f)
-                statSpecificInflection = InflectionPointHeroicHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointHeroicMana >= 0.0f)
-                statSpecificInflection = InflectionPointHeroicMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointHeroicArmor >= 0.0f)
-                statSpecificInflection = InflectionPointHeroicArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointHeroicDamage >= 0.0f)
-                statSpecificInflection = InflectionPointHeroicDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointHeroic;
-            curveFloor       = InflectionPointHeroicCurveFloor;
-            curveCeiling     = InflectionPointHeroicCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid10MHeroicHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MHeroicHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid10MHeroicMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MHeroicMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid10MHeroicArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MHeroicArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid10MHeroicDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MHeroicDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid10MHeroic;
-            curveFloor       = InflectionPointRaid10MHeroicCurveFloor;
-            curveCeiling     = InflectionPointRaid10MHeroicCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid25MHeroicHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MHeroicHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid25MHeroicMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MHeroicMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid25MHeroicArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MHeroicArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid25MHeroicDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MHeroicDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid25MHeroic;
-            curveFloor       = InflectionPointRaid25MHeroicCurveFloor;
-            curveCeiling     = InflectionPointRaid25MHeroicCurveCeiling;
-        }
-        else
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaidHeroicHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaidHeroicHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaidHeroicMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaidHeroicMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaidHeroicArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaidHeroicArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaidHeroicDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaidHeroicDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaidHeroic;
-            curveFloor       = InflectionPointRaidHeroicCurveFloor;
-            curveCeiling     = InflectionPointRaidHeroicCurveCeiling;
-        }
-    }
+AutoBalanceStatModifiers getStatModifiersForDisplay(AutoBalanceMapDescriptor const* descriptor, bool isBoss)
+{
+    // the tier's modifiers only, the per-instance overrides aren't announced
+    return ScalingSettings.statModifiers[getScalingTier(descriptor->isHeroic, descriptor->maxPlayers)][isBoss];
+}
+
+StatMultiplierDisplay CalculateStatMultipliersForDisplay(InstanceMap* instanceMap, bool isBoss)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(instanceMap);
+
+    // the precomputed table covers every player count the map can be scaled to, the math is only the fallback
+    StatMultiplierDisplay result;
+    if (StatMultiplierDisplay const* cachedResult = precomputeCache.FindDisplayMultipliers(MAKE_PAIR32(instanceMap->GetId(), instanceMap->GetDifficulty()), mapABInfo->adjustedPlayerCount, isBoss))
+        result = *cachedResult;
     else
+        result = calculateDisplayMultipliers(ScalingSettings, GetScalingMap(GetInstanceMapDescriptor(instanceMap)), isBoss, mapABInfo->adjustedPlayerCount);
+
+    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Map {} ({}), isBoss={}, adjustedPlayerCount={} | health={:.2f}%, damage={:.2f}%",
+        instanceMap->GetMapName(), instanceMap->GetId(), isBoss, mapABInfo->adjustedPlayerCount, result.healthPercent, result.damagePercent);
+
+    return result;
+}
+
+void UpdateMapDisplayMultipliers(Map* map)
+{
+    if (!map || !map->IsDungeon())
+        return;
+
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    mapABInfo->displayMultipliers[false]         = CalculateStatMultipliersForDisplay(map->ToInstanceMap(), false);
+    mapABInfo->displayMultipliers[true]          = CalculateStatMultipliersForDisplay(map->ToInstanceMap(), true);
+    mapABInfo->displayMultipliersConfigTime      = mapABInfo->mapConfigTime;
+    mapABInfo->displayMultipliersPlayerCount     = mapABInfo->adjustedPlayerCount;
+}
+
+StatMultiplierDisplay const& GetMapDisplayMultipliers(Map* map, bool isBoss)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    // the map refresh keeps these current; only recalculate if the player count changed outside of it
+    if (mapABInfo->displayMultipliersConfigTime != mapABInfo->mapConfigTime ||
+        mapABInfo->displayMultipliersPlayerCount != mapABInfo->adjustedPlayerCount)
+        UpdateMapDisplayMultipliers(map);
+
+    return mapABInfo->displayMultipliers[isBoss];
+}
+
+void getStatModifiersDebug(Map *map, Creature *creature, std::string message)
+{
+    // if we have a creature, include that in the output
+    if (creature)
     {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointHealth >= 0.0f)
-                statSpecificInflection = InflectionPointHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointMana >= 0.0f)
-                statSpecificInflection = InflectionPointMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointArmor >= 0.0f)
-                statSpecificInflection = InflectionPointArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointDamage >= 0.0f)
-                statSpecificInflection = InflectionPointDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPoint;
-            curveFloor       = InflectionPointCurveFloor;
-            curveCeiling     = InflectionPointCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid10MHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid10MMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid10MArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid10MDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid10MDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid10M;
-            curveFloor       = InflectionPointRaid10MCurveFloor;
-            curveCeiling     = InflectionPointRaid10MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 15)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid15MHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid15MHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid15MMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid15MMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid15MArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid15MArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid15MDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid15MDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid15M;
-            curveFloor       = InflectionPointRaid15MCurveFloor;
-            curveCeiling     = InflectionPointRaid15MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 20)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid20MHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid20MHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid20MMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid20MMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid20MArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid20MArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid20MDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid20MDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid20M;
-            curveFloor       = InflectionPointRaid20MCurveFloor;
-            curveCeiling     = InflectionPointRaid20MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid25MHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid25MMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid25MArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid25MDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid25MDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid25M;
-            curveFloor       = InflectionPointRaid25MCurveFloor;
-            curveCeiling     = InflectionPointRaid25MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 40)
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaid40MHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaid40MHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaid40MMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaid40MMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaid40MArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaid40MArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaid40MDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaid40MDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid40M;
-            curveFloor       = InflectionPointRaid40MCurveFloor;
-            curveCeiling     = InflectionPointRaid40MCurveCeiling;
-        }
-        else
-        {
-            if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaidHealth >= 0.0f)
-                statSpecificInflection = InflectionPointRaidHealth;
-            else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaidMana >= 0.0f)
-                statSpecificInflection = InflectionPointRaidMana;
-            else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaidArmor >= 0.0f)
-                statSpecificInflection = InflectionPointRaidArmor;
-            else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaidDamage >= 0.0f)
-                statSpecificInflection = InflectionPointRaidDamage;
-            
-            if (statSpecificInflection < 0.0f)
-                inflectionValue *= InflectionPointRaid;
-            curveFloor       = InflectionPointRaidCurveFloor;
-            curveCeiling     = InflectionPointRaidCurveCeiling;
-        }
+        // get the creature's info
+        AutoBalanceCreatureInfo *creatureABInfo=creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+
+        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance::getStatModifiers: Map {} ({}{}) | Creature {} ({}{}) | {}",
+                    map->GetMapName(),
+                    map->GetId(),
+                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                    creature->GetName(),
+                    creatureABInfo->UnmodifiedLevel,
+                    creatureABInfo->selectedLevel ? "->" + std::to_string(creatureABInfo->selectedLevel) : "",
+                    message
+        );
     }
-    
-    // If stat-specific inflection point is set, use it instead
-    if (statSpecificInflection >= 0.0f)
+    // if no creature was provided, remove that from the output
+    else
     {
-        inflectionValue = (float)maxNumberOfPlayers;
-        inflectionValue *= statSpecificInflection;
+        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance::getStatModifiers: Map {} ({}{}) | {}",
+                    map->GetMapName(),
+                    map->GetId(),
+                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                    message
+        );
     }
+}
 
+AutoBalanceStatModifiers getStatModifiers (Map* map, Creature* creature)
+{
     //
-    // Per map ID overrides alter the above settings, if set
+    // get the map's descriptor
     //
 
-    if (hasDungeonOverride(mapId))
-    {
-        AutoBalanceInflectionPointSettings* myInflectionPointOverrides = &dungeonOverrides[mapId];
+    AutoBalanceMapDescriptor const* descriptor = GetInstanceMapDescriptor(map->ToInstanceMap());
+    AutoBalanceScalingMap scalingMap           = GetScalingMap(descriptor);
 
-        //
-        // Alter the inflectionValue according to the override, if set
-        //
+    //
+    // get the creature's info if a creature was specified
+    //
+    AutoBalanceCreatureInfo* creatureABInfo = nullptr;
 
-        if (myInflectionPointOverrides->value != -1)
-        {
-            inflectionValue  = (float)maxNumberOfPlayers; // Starting over
-            inflectionValue *= myInflectionPointOverrides->value;
-        }
+    AutoBalanceCreaturePolicy const* policy = nullptr;
 
-        if (myInflectionPointOverrides->curveFloor   != -1)
-            curveFloor   = myInflectionPointOverrides->curveFloor;
-        if (myInflectionPointOverrides->curveCeiling != -1)
-            curveCeiling = myInflectionPointOverrides->curveCeiling;
+    if (creature)
+    {
+        creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+        policy = &GetCreaturePolicy(creature, creatureABInfo);
     }
 
+    bool isBoss = policy && policy->isBoss;
+
     //
-    // Boss Inflection Point
+    // The tier's modifiers, then AutoBalance.StatModifier(.Boss).PerInstance, then AutoBalance.StatModifier.PerCreature
     //
 
-    if (isBoss) {
+    AutoBalanceStatModifiers statModifiers = selectStatModifiers(ScalingSettings, scalingMap, isBoss, policy && policy->hasStatOverride ? &policy->statOverride : nullptr);
 
-        float bossInflectionPointMultiplier;
-        float bossInflectionPointValue = -1.0f; // -1 indicates not set
-        float bossStatSpecificInflection = -1.0f; // -1 indicates not set
-
-        if (instanceMap->IsHeroic())
-        {
-            if (maxNumberOfPlayers <= 5)
-            {
-                bossInflectionPointMultiplier = InflectionPointHeroicBoss;
-                bossInflectionPointValue = InflectionPointHeroicBossInflection;
-                // Check for boss-specific stat inflection points
-                if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointHeroicBossHealth >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointHeroicBossHealth;
-                else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointHeroicBossMana >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointHeroicBossMana;
-                else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointHeroicBossArmor >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointHeroicBossArmor;
-                else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointHeroicBossDamage >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointHeroicBossDamage;
-            }
-            else if (maxNumberOfPlayers <= 10)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid10MHeroicBoss;
-                bossInflectionPointValue = InflectionPointRaid10MHeroicBossInflection;
-            }
-            else if (maxNumberOfPlayers <= 25)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid25MHeroicBoss;
-                bossInflectionPointValue = InflectionPointRaid25MHeroicBossInflection;
-            }
-            else
-            {
-                bossInflectionPointMultiplier = InflectionPointRaidHeroicBoss;
-                bossInflectionPointValue = InflectionPointRaidHeroicBossInflection;
-                // Check for boss-specific stat inflection points
-                if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaidHeroicBossHealth >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidHeroicBossHealth;
-                else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaidHeroicBossMana >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidHeroicBossMana;
-                else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaidHeroicBossArmor >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidHeroicBossArmor;
-                else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaidHeroicBossDamage >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidHeroicBossDamage;
-            }
-        }
-        else
-        {
-            if (maxNumberOfPlayers <= 5)
-            {
-                bossInflectionPointMultiplier = InflectionPointBoss;
-                bossInflectionPointValue = InflectionPointBossInflection;
-                // Check for boss-specific stat inflection points
-                if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointBossHealth >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointBossHealth;
-                else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointBossMana >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointBossMana;
-                else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointBossArmor >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointBossArmor;
-                else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointBossDamage >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointBossDamage;
-            }
-            else if (maxNumberOfPlayers <= 10)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid10MBoss;
-                bossInflectionPointValue = InflectionPointRaid10MBossInflection;
-            }
-            else if (maxNumberOfPlayers <= 15)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid15MBoss;
-                bossInflectionPointValue = InflectionPointRaid15MBossInflection;
-            }
-            else if (maxNumberOfPlayers <= 20)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid20MBoss;
-                bossInflectionPointValue = InflectionPointRaid20MBossInflection;
-            }
-            else if (maxNumberOfPlayers <= 25)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid25MBoss;
-                bossInflectionPointValue = InflectionPointRaid25MBossInflection;
-            }
-            else if (maxNumberOfPlayers <= 40)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid40MBoss;
-                bossInflectionPointValue = InflectionPointRaid40MBossInflection;
-            }
-            else
-            {
-                bossInflectionPointMultiplier = InflectionPointRaidBoss;
-                bossInflectionPointValue = InflectionPointRaidBossInflection;
-                // Check for boss-specific stat inflection points
-                if (statType == AUTOBALANCE_STAT_HEALTH && InflectionPointRaidBossHealth >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidBossHealth;
-                else if (statType == AUTOBALANCE_STAT_MANA && InflectionPointRaidBossMana >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidBossMana;
-                else if (statType == AUTOBALANCE_STAT_ARMOR && InflectionPointRaidBossArmor >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidBossArmor;
-                else if (statType == AUTOBALANCE_STAT_DAMAGE && InflectionPointRaidBossDamage >= 0.0f)
-                    bossStatSpecificInflection = InflectionPointRaidBossDamage;
-            }
-        }
-
-        //
-        // Per map ID overrides alter the above settings, if set
-        //
-
-        if (hasBossOverride(mapId))
-        {
-            AutoBalanceInflectionPointSettings* myBossOverrides = &bossOverrides[mapId];
-
-            //
-            // If set, alter the inflectionValue according to the override
-            //
-            if (myBossOverrides->value != -1)
-                inflectionValue *= myBossOverrides->value;
-            //
-            // Otherwise, use boss stat-specific inflection if set, then boss general inflection, then boss modifier
-            //
-            else if (bossStatSpecificInflection >= 0.0f)
-            {
-                inflectionValue = (float)maxNumberOfPlayers; // Start over
-                inflectionValue *= bossStatSpecificInflection;
-            }
-            else if (bossInflectionPointValue >= 0.0f)
-            {
-                inflectionValue = (float)maxNumberOfPlayers; // Start over
-                inflectionValue *= bossInflectionPointValue;
-            }
-            else
-                inflectionValue *= bossInflectionPointMultiplier;
-        }
-        //
-        // No override, use boss stat-specific inflection if set, then boss general inflection, then boss modifier
-        //
-        else
-        {
-            if (bossStatSpecificInflection >= 0.0f)
-            {
-                inflectionValue = (float)maxNumberOfPlayers; // Start over
-                inflectionValue *= bossStatSpecificInflection;
-            }
-            else if (bossInflectionPointValue >= 0.0f)
-            {
-                inflectionValue = (float)maxNumberOfPlayers; // Start over
-                inflectionValue *= bossInflectionPointValue;
-            }
-            else
-                inflectionValue *= bossInflectionPointMultiplier;
-        }
-    }
-
-    return AutoBalanceInflectionPointSettings(inflectionValue, curveFloor, curveCeiling);
-}
-
-// Helper function to get stat modifiers for a given boss status without needing a creature
-AutoBalanceStatModifiers getStatModifiersForDisplay(Map* map, bool isBoss)
-{
-    InstanceMap* instanceMap = map->ToInstanceMap();
-    uint32 maxNumberOfPlayers = instanceMap->GetMaxPlayers();
-    
-    AutoBalanceStatModifiers statModifiers;
-    
-    if (instanceMap->IsHeroic()) // heroic
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierHeroic_Boss_Global;
-                statModifiers.health     = StatModifierHeroic_Boss_Health;
-                statModifiers.damage     = StatModifierHeroic_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierHeroic_Global;
-                statModifiers.health     = StatModifierHeroic_Health;
-                statModifiers.damage     = StatModifierHeroic_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid10MHeroic_Boss_Global;
-                statModifiers.health     = StatModifierRaid10MHeroic_Boss_Health;
-                statModifiers.damage     = StatModifierRaid10MHeroic_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid10MHeroic_Global;
-                statModifiers.health     = StatModifierRaid10MHeroic_Health;
-                statModifiers.damage     = StatModifierRaid10MHeroic_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid25MHeroic_Boss_Global;
-                statModifiers.health     = StatModifierRaid25MHeroic_Boss_Health;
-                statModifiers.damage     = StatModifierRaid25MHeroic_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid25MHeroic_Global;
-                statModifiers.health     = StatModifierRaid25MHeroic_Health;
-                statModifiers.damage     = StatModifierRaid25MHeroic_Damage;
-            }
-        }
-        else
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaidHeroic_Boss_Global;
-                statModifiers.health     = StatModifierRaidHeroic_Boss_Health;
-                statModifiers.damage     = StatModifierRaidHeroic_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaidHeroic_Global;
-                statModifiers.health     = StatModifierRaidHeroic_Health;
-                statModifiers.damage     = StatModifierRaidHeroic_Damage;
-            }
-        }
-    }
-    else // non-heroic
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifier_Boss_Global;
-                statModifiers.health     = StatModifier_Boss_Health;
-                statModifiers.damage     = StatModifier_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifier_Global;
-                statModifiers.health     = StatModifier_Health;
-                statModifiers.damage     = StatModifier_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid10M_Boss_Global;
-                statModifiers.health     = StatModifierRaid10M_Boss_Health;
-                statModifiers.damage     = StatModifierRaid10M_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid10M_Global;
-                statModifiers.health     = StatModifierRaid10M_Health;
-                statModifiers.damage     = StatModifierRaid10M_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 15)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid15M_Boss_Global;
-                statModifiers.health     = StatModifierRaid15M_Boss_Health;
-                statModifiers.damage     = StatModifierRaid15M_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid15M_Global;
-                statModifiers.health     = StatModifierRaid15M_Health;
-                statModifiers.damage     = StatModifierRaid15M_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 20)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid20M_Boss_Global;
-                statModifiers.health     = StatModifierRaid20M_Boss_Health;
-                statModifiers.damage     = StatModifierRaid20M_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid20M_Global;
-                statModifiers.health     = StatModifierRaid20M_Health;
-                statModifiers.damage     = StatModifierRaid20M_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid25M_Boss_Global;
-                statModifiers.health     = StatModifierRaid25M_Boss_Health;
-                statModifiers.damage     = StatModifierRaid25M_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid25M_Global;
-                statModifiers.health     = StatModifierRaid25M_Health;
-                statModifiers.damage     = StatModifierRaid25M_Damage;
-            }
-        }
-        else if (maxNumberOfPlayers <= 40)
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid40M_Boss_Global;
-                statModifiers.health     = StatModifierRaid40M_Boss_Health;
-                statModifiers.damage     = StatModifierRaid40M_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid40M_Global;
-                statModifiers.health     = StatModifierRaid40M_Health;
-                statModifiers.damage     = StatModifierRaid40M_Damage;
-            }
-        }
-        else
-        {
-            if (isBoss)
-            {
-                statModifiers.global     = StatModifierRaid_Boss_Global;
-                statModifiers.health     = StatModifierRaid_Boss_Health;
-                statModifiers.damage     = StatModifierRaid_Boss_Damage;
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid_Global;
-                statModifiers.health     = StatModifierRaid_Health;
-                statModifiers.damage     = StatModifierRaid_Damage;
-            }
-        }
-    }
-    
-    return statModifiers;
-}
-
-StatMultiplierDisplay CalculateStatMultipliersForDisplay(InstanceMap* instanceMap, bool isBoss)
-{
-    Map* map = instanceMap;
-    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Map {} ({}), isBoss={}, adjustedPlayerCount={}",
-        instanceMap->GetMapName(), instanceMap->GetId(), isBoss, mapABInfo->adjustedPlayerCount);
-    
-    // Get inflection point settings for health and damage
-    AutoBalanceInflectionPointSettings inflectionPointSettingsHealth = getInflectionPointSettings(instanceMap, isBoss, AUTOBALANCE_STAT_HEALTH);
-    AutoBalanceInflectionPointSettings inflectionPointSettingsDamage = getInflectionPointSettings(instanceMap, isBoss, AUTOBALANCE_STAT_DAMAGE);
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Health inflection value={}, curveFloor={}, curveCeiling={}",
-        inflectionPointSettingsHealth.value, inflectionPointSettingsHealth.curveFloor, inflectionPointSettingsHealth.curveCeiling);
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Damage inflection value={}, curveFloor={}, curveCeiling={}",
-        inflectionPointSettingsDamage.value, inflectionPointSettingsDamage.curveFloor, inflectionPointSettingsDamage.curveCeiling);
-    
-    // Get formula types
-    FormulaType healthFormulaType = isBoss ? FormulaTypeBossHealth : FormulaTypeHealth;
-    FormulaType damageFormulaType = isBoss ? FormulaTypeBossDamage : FormulaTypeDamage;
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Health formula type={}, Damage formula type={}",
-        healthFormulaType, damageFormulaType);
-    
-    // Calculate default multipliers
-    float defaultHealthMultiplier = getDefaultMultiplier(map, inflectionPointSettingsHealth, healthFormulaType);
-    float defaultDamageMultiplier = getDefaultMultiplier(map, inflectionPointSettingsDamage, damageFormulaType);
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Default health multiplier={}, Default damage multiplier={}",
-        defaultHealthMultiplier, defaultDamageMultiplier);
-    
-    // Get stat modifiers
-    AutoBalanceStatModifiers statModifiers = getStatModifiersForDisplay(map, isBoss);
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Stat modifiers - global={}, health={}, damage={}",
-        statModifiers.global, statModifiers.health, statModifiers.damage);
-    
-    // Calculate final multipliers
-    float healthMultiplier = defaultHealthMultiplier * statModifiers.global * statModifiers.health;
-    float damageMultiplier = defaultDamageMultiplier * statModifiers.global * statModifiers.damage;
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Before caps - health multiplier={}, damage multiplier={}",
-        healthMultiplier, damageMultiplier);
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: MinHPModifier={}, MinDamageModifier={}",
-        MinHPModifier, MinDamageModifier);
-    
-    // Apply minimum caps
-    if (healthMultiplier <= MinHPModifier)
-    {
-        LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Health multiplier capped to MinHPModifier");
-        healthMultiplier = MinHPModifier;
-    }
-    if (damageMultiplier <= MinDamageModifier)
-    {
-        LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Damage multiplier capped to MinDamageModifier");
-        damageMultiplier = MinDamageModifier;
-    }
-    
-    StatMultiplierDisplay result;
-    result.healthPercent = healthMultiplier * 100.0f;
-    result.damagePercent = damageMultiplier * 100.0f;
-    
-    LOG_DEBUG("module.AutoBalance", "CalculateStatMultipliersForDisplay: Final result - health={:.2f}%, damage={:.2f}%",
-        result.healthPercent, result.damagePercent);
-    
-    return result;
-}
-
-void getStatModifiersDebug(Map *map, Creature *creature, std::string message)
-{
-    // if we have a creature, include that in the output
-    if (creature)
-    {
-        // get the creature's info
-        AutoBalanceCreatureInfo *creatureABInfo=creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
-
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance::getStatModifiers: Map {} ({}{}) | Creature {} ({}{}) | {}",
-                    map->GetMapName(),
-                    map->GetId(),
-                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                    creature->GetName(),
-                    creatureABInfo->UnmodifiedLevel,
-                    creatureABInfo->selectedLevel ? "->" + std::to_string(creatureABInfo->selectedLevel) : "",
-                    message
-        );
-    }
-    // if no creature was provided, remove that from the output
-    else
-    {
-        LOG_DEBUG("module.AutoBalance_StatGeneration", "AutoBalance::getStatModifiers: Map {} ({}{}) | {}",
-                    map->GetMapName(),
-                    map->GetId(),
-                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                    message
-        );
-    }
-}
-
-AutoBalanceStatModifiers getStatModifiers (Map* map, Creature* creature)
-{
-    //
-    // get the instance's InstanceMap
-    //
-
-    InstanceMap* instanceMap  = map->ToInstanceMap();
-
-    //
-    // map variables
-    //
-
-    uint32 maxNumberOfPlayers = instanceMap->GetMaxPlayers();
-    uint32 mapId              = map->GetId();
-
-    //
-    // get the creature's info if a creature was specified
-    //
-    AutoBalanceCreatureInfo* creatureABInfo = nullptr;
-
-    if (creature)
-        creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
-
-    //
-    // this will be the return value
-    //
-
-    AutoBalanceStatModifiers statModifiers;
-
-    //
-    // Apply the per-instance-type modifiers first
-    // AutoBalance.StatModifier*(.Boss).<stat>
-    //
-
-    if (instanceMap->IsHeroic()) // heroic
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierHeroic_Boss_Global;
-                statModifiers.health     = StatModifierHeroic_Boss_Health;
-                statModifiers.mana       = StatModifierHeroic_Boss_Mana;
-                statModifiers.armor      = StatModifierHeroic_Boss_Armor;
-                statModifiers.damage     = StatModifierHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierHeroic_Global;
-                statModifiers.health     = StatModifierHeroic_Health;
-                statModifiers.mana       = StatModifierHeroic_Mana;
-                statModifiers.armor      = StatModifierHeroic_Armor;
-                statModifiers.damage     = StatModifierHeroic_Damage;
-                statModifiers.ccduration = StatModifierHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Heroic");
-            }
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid10MHeroic_Boss_Global;
-                statModifiers.health     = StatModifierRaid10MHeroic_Boss_Health;
-                statModifiers.mana       = StatModifierRaid10MHeroic_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid10MHeroic_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid10MHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid10MHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid10MHeroic_Global;
-                statModifiers.health     = StatModifierRaid10MHeroic_Health;
-                statModifiers.mana       = StatModifierRaid10MHeroic_Mana;
-                statModifiers.armor      = StatModifierRaid10MHeroic_Armor;
-                statModifiers.damage     = StatModifierRaid10MHeroic_Damage;
-                statModifiers.ccduration = StatModifierRaid10MHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Heroic");
-            }
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid25MHeroic_Boss_Global;
-                statModifiers.health     = StatModifierRaid25MHeroic_Boss_Health;
-                statModifiers.mana       = StatModifierRaid25MHeroic_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid25MHeroic_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid25MHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid25MHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid25MHeroic_Global;
-                statModifiers.health     = StatModifierRaid25MHeroic_Health;
-                statModifiers.mana       = StatModifierRaid25MHeroic_Mana;
-                statModifiers.armor      = StatModifierRaid25MHeroic_Armor;
-                statModifiers.damage     = StatModifierRaid25MHeroic_Damage;
-                statModifiers.ccduration = StatModifierRaid25MHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Heroic");
-            }
-        }
-        else
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaidHeroic_Boss_Global;
-                statModifiers.health     = StatModifierRaidHeroic_Boss_Health;
-                statModifiers.mana       = StatModifierRaidHeroic_Boss_Mana;
-                statModifiers.armor      = StatModifierRaidHeroic_Boss_Armor;
-                statModifiers.damage     = StatModifierRaidHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaidHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaidHeroic_Global;
-                statModifiers.health     = StatModifierRaidHeroic_Health;
-                statModifiers.mana       = StatModifierRaidHeroic_Mana;
-                statModifiers.armor      = StatModifierRaidHeroic_Armor;
-                statModifiers.damage     = StatModifierRaidHeroic_Damage;
-                statModifiers.ccduration = StatModifierRaidHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Heroic");
-            }
-        }
-    }
-    else // non-heroic
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifier_Boss_Global;
-                statModifiers.health     = StatModifier_Boss_Health;
-                statModifiers.mana       = StatModifier_Boss_Mana;
-                statModifiers.armor      = StatModifier_Boss_Armor;
-                statModifiers.damage     = StatModifier_Boss_Damage;
-                statModifiers.ccduration = StatModifier_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifier_Global;
-                statModifiers.health     = StatModifier_Health;
-                statModifiers.mana       = StatModifier_Mana;
-                statModifiers.armor      = StatModifier_Armor;
-                statModifiers.damage     = StatModifier_Damage;
-                statModifiers.ccduration = StatModifier_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid10M_Boss_Global;
-                statModifiers.health     = StatModifierRaid10M_Boss_Health;
-                statModifiers.mana       = StatModifierRaid10M_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid10M_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid10M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid10M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid10M_Global;
-                statModifiers.health     = StatModifierRaid10M_Health;
-                statModifiers.mana       = StatModifierRaid10M_Mana;
-                statModifiers.armor      = StatModifierRaid10M_Armor;
-                statModifiers.damage     = StatModifierRaid10M_Damage;
-                statModifiers.ccduration = StatModifierRaid10M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 15)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid15M_Boss_Global;
-                statModifiers.health     = StatModifierRaid15M_Boss_Health;
-                statModifiers.mana       = StatModifierRaid15M_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid15M_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid15M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid15M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "15 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid15M_Global;
-                statModifiers.health     = StatModifierRaid15M_Health;
-                statModifiers.mana       = StatModifierRaid15M_Mana;
-                statModifiers.armor      = StatModifierRaid15M_Armor;
-                statModifiers.damage     = StatModifierRaid15M_Damage;
-                statModifiers.ccduration = StatModifierRaid15M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "15 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 20)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid20M_Boss_Global;
-                statModifiers.health     = StatModifierRaid20M_Boss_Health;
-                statModifiers.mana       = StatModifierRaid20M_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid20M_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid20M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid20M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "20 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid20M_Global;
-                statModifiers.health     = StatModifierRaid20M_Health;
-                statModifiers.mana       = StatModifierRaid20M_Mana;
-                statModifiers.armor      = StatModifierRaid20M_Armor;
-                statModifiers.damage     = StatModifierRaid20M_Damage;
-                statModifiers.ccduration = StatModifierRaid20M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "20 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid25M_Boss_Global;
-                statModifiers.health     = StatModifierRaid25M_Boss_Health;
-                statModifiers.mana       = StatModifierRaid25M_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid25M_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid25M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid25M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid25M_Global;
-                statModifiers.health     = StatModifierRaid25M_Health;
-                statModifiers.mana       = StatModifierRaid25M_Mana;
-                statModifiers.armor      = StatModifierRaid25M_Armor;
-                statModifiers.damage     = StatModifierRaid25M_Damage;
-                statModifiers.ccduration = StatModifierRaid25M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 40)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid40M_Boss_Global;
-                statModifiers.health     = StatModifierRaid40M_Boss_Health;
-                statModifiers.mana       = StatModifierRaid40M_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid40M_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid40M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid40M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "40 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid40M_Global;
-                statModifiers.health     = StatModifierRaid40M_Health;
-                statModifiers.mana       = StatModifierRaid40M_Mana;
-                statModifiers.armor      = StatModifierRaid40M_Armor;
-                statModifiers.damage     = StatModifierRaid40M_Damage;
-                statModifiers.ccduration = StatModifierRaid40M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "40 Player Normal");
-            }
-        }
-        else
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global     = StatModifierRaid_Boss_Global;
-                statModifiers.health     = StatModifierRaid_Boss_Health;
-                statModifiers.mana       = StatModifierRaid_Boss_Mana;
-                statModifiers.armor      = StatModifierRaid_Boss_Armor;
-                statModifiers.damage     = StatModifierRaid_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global     = StatModifierRaid_Global;
-                statModifiers.health     = StatModifierRaid_Health;
-                statModifiers.mana       = StatModifierRaid_Mana;
-                statModifiers.armor      = StatModifierRaid_Armor;
-                statModifiers.damage     = StatModifierRaid_Damage;
-                statModifiers.ccduration = StatModifierRaid_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Normal");
-            }
-        }
-    }
-
-    //
-    // Per-Map Overrides
-    // AutoBalance.StatModifier.Boss.PerInstance
-    //
-
-    if (creature && isBossOrBossSummon(creature) && hasStatModifierBossOverride(mapId))
-    {
-        AutoBalanceStatModifiers* myStatModifierBossOverrides = &statModifierBossOverrides[mapId];
-
-        if (myStatModifierBossOverrides->global != -1)
-            statModifiers.global = myStatModifierBossOverrides->global;
-
-        if (myStatModifierBossOverrides->health != -1)
-            statModifiers.health = myStatModifierBossOverrides->health;
-
-        if (myStatModifierBossOverrides->mana != -1)
-            statModifiers.mana = myStatModifierBossOverrides->mana;
-
-        if (myStatModifierBossOverrides->armor != -1)
-            statModifiers.armor = myStatModifierBossOverrides->armor;
-
-        if (myStatModifierBossOverrides->damage != -1)
-            statModifiers.damage = myStatModifierBossOverrides->damage;
-
-        if (myStatModifierBossOverrides->ccduration != -1)
-            statModifiers.ccduration = myStatModifierBossOverrides->ccduration;
+    getStatModifiersDebug(map, creature, std::string(getScalingTierName(getScalingTier(scalingMap.isHeroic, scalingMap.maxPlayers))) + (isBoss ? " Boss" : ""));
 
+    if (isBoss && scalingMap.statModifierBossOverride)
         getStatModifiersDebug(map, creature, "Boss Per-Instance Override");
-    }
-    //
-    // AutoBalance.StatModifier.PerInstance
-    //
-    else if (hasStatModifierOverride(mapId))
-    {
-        AutoBalanceStatModifiers* myStatModifierOverrides = &statModifierOverrides[mapId];
-
-        if (myStatModifierOverrides->global != -1)
-            statModifiers.global = myStatModifierOverrides->global;
-
-        if (myStatModifierOverrides->health != -1)
-            statModifiers.health = myStatModifierOverrides->health;
-
-        if (myStatModifierOverrides->mana != -1)
-            statModifiers.mana = myStatModifierOverrides->mana;
-
-        if (myStatModifierOverrides->armor != -1)
-            statModifiers.armor = myStatModifierOverrides->armor;
-
-        if (myStatModifierOverrides->damage != -1)
-            statModifiers.damage = myStatModifierOverrides->damage;
-
-        if (myStatModifierOverrides->ccduration != -1)
-            statModifiers.ccduration = myStatModifierOverrides->ccduration;
-
+    else if (scalingMap.statModifierOverride)
         getStatModifiersDebug(map, creature, "Per-Instance Override");
-    }
-
-    //
-    // Per-creature modifiers applied last
-    // AutoBalance.StatModifier.PerCreature
-    //
-    if (creature && hasStatModifierCreatureOverride(creature->GetEntry()))
-    {
-        AutoBalanceStatModifiers* myCreatureOverrides = &statModifierCreatureOverrides[creature->GetEntry()];
-
-        if (myCreatureOverrides->global != -1)
-            statModifiers.global = myCreatureOverrides->global;
-
-        if (myCreatureOverrides->health != -1)
-            statModifiers.health = myCreatureOverrides->health;
-
-        if (myCreatureOverrides->mana != -1)
-            statModifiers.mana = myCreatureOverrides->mana;
-
-        if (myCreatureOverrides->armor != -1)
-            statModifiers.armor = myCreatureOverrides->armor;
-
-        if (myCreatureOverrides->damage != -1)
-            statModifiers.damage = myCreatureOverrides->damage;
-
-        if (myCreatureOverrides->ccduration != -1)
-            statModifiers.ccduration = myCreatureOverrides->ccduration;
 
+    if (policy && policy->hasStatOverride)
         getStatModifiersDebug(map, creature, "Per-Creature Override");
-    }
 
     if (creature)
     {
@@ -2153,11 +1139,6 @@ bool hasStatModifierBossOverride(uint32 dungeonId)
     return (statModifierBossOverrides.find(dungeonId) != statModifierBossOverrides.end());
 }
 
-bool hasStatModifierCreatureOverride(uint32 creatureId)
-{
-    return (statModifierCreatureOverrides.find(creatureId) != statModifierCreatureOverrides.end());
-}
-
 bool hasStatModifierOverride(uint32 dungeonId)
 {
     return (statModifierOverrides.find(dungeonId) != statModifierOverrides.end());
@@ -2247,6 +1228,50 @@ bool isBossOrBossSummon(Creature* creature, bool log)
     return false;
 }
 
+AutoBalanceCreaturePolicy const& GetCreaturePolicy(Creature* creature, AutoBalanceCreatureInfo* creatureABInfo)
+{
+    if (!creatureABInfo)
+        creatureABInfo = creature->CustomData.GetDefault<AutoBalanceCreatureInfo>("AutoBalanceCreatureInfo");
+
+    AutoBalanceCreaturePolicy& policy = creatureABInfo->policy;
+
+    // already resolved for this entry and config
+    if (policy.entry == creature->GetEntry() && policy.globalConfigTime == globalConfigTime)
+        return policy;
+
+    policy = AutoBalanceCreaturePolicy();
+    policy.entry            = creature->GetEntry();
+    policy.globalConfigTime = globalConfigTime;
+    policy.forcedNumPlayers = GetForcedNumPlayers(policy.entry);
+
+    auto overrideIterator = statModifierCreatureOverrides.find(policy.entry);
+    if (overrideIterator != statModifierCreatureOverrides.end())
+    {
+        policy.hasStatOverride = true;
+        policy.statOverride    = overrideIterator->second;
+    }
+
+    policy.isBoss       = isBossOrBossSummon(creature, true);
+    policy.isNeverClone = std::find(creatureIDsThatAreNotClones.begin(), creatureIDsThatAreNotClones.end(), policy.entry) != creatureIDsThatAreNotClones.end();
+    policy.isCritter    = creature->IsCritter();
+    policy.isTotem      = creature->IsTotem();
+    policy.isTrigger    = creature->IsTrigger();
+
+    LOG_DEBUG("module.AutoBalance", "AutoBalance::GetCreaturePolicy: Creature {} ({}) | forced players: {} | stat override: {} | boss: {} | never clone: {} | critter: {} | totem: {} | trigger: {}",
+        creature->GetName(),
+        policy.entry,
+        policy.forcedNumPlayers,
+        policy.hasStatOverride,
+        policy.isBoss,
+        policy.isNeverClone,
+        policy.isCritter,
+        policy.isTotem,
+        policy.isTrigger
+    );
+
+    return policy;
+}
+
 bool isCreatureRelevant(Creature* creature)
 {
     // if the creature is gone, return false
@@ -2353,7 +1378,7 @@ bool isCreatureRelevant(Creature* creature)
                 // special case for totems?
                 else if
                 (
-                    creature->IsTotem() &&
+                    GetCreaturePolicy(creature, creatureABInfo).isTotem &&
                     !thisPlayer->IsHostileTo(summonerPlayer)
                 )
                 {
@@ -2401,7 +1426,7 @@ bool isCreatureRelevant(Creature* creature)
 
     // if this is a flavor critter
     // level and health checks for some nasty level 1 critters in some encounters
-    if ((creature->IsCritter() && creatureABInfo->UnmodifiedLevel <= 5 && creature->GetMaxHealth() < 100))
+    if ((GetCreaturePolicy(creature, creatureABInfo).isCritter && creatureABInfo->UnmodifiedLevel <= 5 && creature->GetMaxHealth() < 100))
     {
         creatureABInfo->relevance = AUTOBALANCE_RELEVANCE_FALSE;
         LOG_DEBUG("module.AutoBalance", "AutoBalance_AllCreatureScript::isCreatureRelevant: Creature {} ({}) | is a non-relevant critter, no changes. Marked for skip.",
@@ -2474,6 +1499,30 @@ std::list<uint32> LoadDisabledDungeons(std::string dungeonIdString)
     return dungeonIdList;
 }
 
+std::set<uint32> LoadIdSet(std::string idString)
+{
+    std::string       delimitedValue;
+    std::stringstream idStream;
+    std::set<uint32>  idSet;
+
+    idStream.str(idString);
+
+    // Process each ID in the string, delimited by the comma - ","
+    //
+    while (std::getline(idStream, delimitedValue, ','))
+    {
+        std::string       value;
+        std::stringstream valueStream(delimitedValue);
+
+        valueStream >> value;
+
+        if (!value.empty())
+            idSet.insert(atoi(value.c_str()));
+    }
+
+    return idSet;
+}
+
 std::map<uint32, uint32> LoadDistanceCheckOverrides(std::string dungeonIdString)
 {
     std::string       delimitedValue;
@@ -2592,143 +1641,464 @@ std::map<uint32, AutoBalanceInflectionPointSettings> LoadInflectionPointOverride
     return overrideMap;
 }
 
-void LoadMapSettings(Map* map)
+//
+// Precompute cache
+//
+
+// The creature classes with base stats, in AUTOBALANCE_PRECOMPUTE_CACHE_CLASS order
+static Classes const precomputeCacheClasses[AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT] = { CLASS_WARRIOR, CLASS_PALADIN, CLASS_ROGUE, CLASS_MAGE };
+
+static void CollectProfileSpawns(std::vector<AutoBalanceProfileSpawn>& spawns)
+{
+    for (auto const& [spawnId, creatureData] : sObjectMgr->GetAllCreatureData())
+    {
+        //
+        // Only instanced maps are balanced
+        //
+
+        MapEntry const* mapEntry = sMapStore.LookupEntry(creatureData.mapid);
+        if (!mapEntry || !mapEntry->IsDungeon())
+            continue;
+
+        CreatureTemplate const* baseTemplate = sObjectMgr->GetCreatureTemplate(creatureData.id1);
+        if (!baseTemplate)
+            continue;
+
+        for (uint8 difficulty = 0; difficulty < MAX_DIFFICULTY; ++difficulty)
+        {
+            if (!(creatureData.spawnMask & (1 << difficulty)))
+                continue;
+
+            //
+            // Heroic and raid difficulties may spawn a different template
+            //
+
+            CreatureTemplate const* creatureTemplate = baseTemplate;
+            if (difficulty > 0 && baseTemplate->DifficultyEntry[difficulty - 1])
+                if (CreatureTemplate const* difficultyTemplate = sObjectMgr->GetCreatureTemplate(baseTemplate->DifficultyEntry[difficulty - 1]))
+                    creatureTemplate = difficultyTemplate;
+
+            //
+            // Mirror the exclusions that AddCreatureToMapCreatureList applies to live creatures
+            //
+
+            if (creatureTemplate->type == CREATURE_TYPE_CRITTER ||
+                creatureTemplate->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER ||
+                creatureTemplate->npcflag & (UNIT_NPC_FLAG_VENDOR | UNIT_NPC_FLAG_GOSSIP | UNIT_NPC_FLAG_QUESTGIVER | UNIT_NPC_FLAG_TRAINER))
+                continue;
+
+            AutoBalanceProfileSpawn spawn;
+            spawn.key    = MAKE_PAIR32(creatureData.mapid, difficulty);
+            spawn.entry  = creatureTemplate->Entry;
+            spawn.level  = (uint8)(((float)creatureTemplate->minlevel + (float)creatureTemplate->maxlevel) / 2.0f + 0.5f);
+            spawn.isBoss = creatureTemplate->rank == CREATURE_ELITE_WORLDBOSS || creatureTemplate->flags_extra & CREATURE_FLAG_EXTRA_DUNGEON_BOSS;
+            spawns.push_back(spawn);
+        }
+    }
+}
+
+// Everything the cache is built from: the AutoBalance config, the map descriptors, the profile spawns and the base stats
+static uint64 CalculatePrecomputeCacheKey(std::vector<AutoBalanceProfileSpawn> const& spawns)
+{
+    AutoBalanceCacheHasher hasher;
+    hasher.Add<uint32>(AUTOBALANCE_PRECOMPUTE_CACHE_VERSION);
+
+    // the config manager doesn't keep its options in order
+    std::vector<std::string> configKeys = sConfigMgr->GetKeysByString("AutoBalance.");
+    std::sort(configKeys.begin(), configKeys.end());
+
+    for (std::string const& configKey : configKeys)
+    {
+        hasher.Add(configKey);
+        hasher.Add(sConfigMgr->GetOption<std::string>(configKey, "", false));
+    }
+
+    for (auto const& [key, descriptor] : mapDescriptors)
+    {
+        hasher.Add<uint32>(key);
+        hasher.Add<uint32>(descriptor.maxPlayers);
+        hasher.Add<uint8>(descriptor.isHeroic);
+    }
+
+    hasher.Add(spawns.data(), spawns.size() * sizeof(AutoBalanceProfileSpawn));
+
+    for (Classes unitClass : precomputeCacheClasses)
+    {
+        for (uint32 level = 0; level < AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT; ++level)
+        {
+            CreatureBaseStats const* baseStats = sObjectMgr->GetCreatureBaseStats((uint8)level, unitClass);
+            hasher.Add(baseStats->BaseHealth);
+            hasher.Add(baseStats->BaseDamage);
+        }
+    }
+
+    return hasher.GetHash();
+}
+
+void LoadPrecomputeCache()
 {
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<AutoBalanceProfileSpawn> spawns;
+    CollectProfileSpawns(spawns);
+
+    uint64 keyHash = CalculatePrecomputeCacheKey(spawns);
+    auto keyElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    std::string error;
+
+    if (PrecomputeCacheEnable)
+    {
+        if (precomputeCache.Map(PrecomputeCacheFile, keyHash, error))
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+            LOG_INFO("module.AutoBalance", "AutoBalance::LoadPrecomputeCache: Mapped `{}` ({} bytes, ({}) level profiles, ({}) multiplier tables) in {} ms, {} ms of it checking ({}) spawns and the config against it.",
+                PrecomputeCacheFile,
+                precomputeCache.GetSize(),
+                precomputeCache.GetLevelProfileCount(),
+                precomputeCache.GetMultiplierTableCount(),
+                elapsed.count(),
+                keyElapsed.count(),
+                spawns.size()
+            );
+
+            return;
+        }
+
+        LOG_INFO("module.AutoBalance", "AutoBalance::LoadPrecomputeCache: Rebuilding `{}`: {}.", PrecomputeCacheFile, error);
+    }
+
     //
-    // Load (or create) the map's info
+    // Build the level profiles, the multiplier tables and the base values
     //
 
-    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+    AutoBalancePrecomputeCacheBuilder builder;
+
+    for (AutoBalanceProfileSpawn const& spawn : spawns)
+        builder.AddLevelProfileSpawn(spawn);
+
+    for (auto const& [key, descriptor] : mapDescriptors)
+        builder.AddMultiplierTable(key, ScalingSettings, GetScalingMap(&descriptor));
+
+    for (uint32 classIndex = 0; classIndex < AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT; ++classIndex)
+        for (uint32 level = 0; level < AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT; ++level)
+            builder.SetBaseValues(classIndex, (uint8)level, CalculateBaseValues((uint8)level, precomputeCacheClasses[classIndex]));
+
+    std::vector<uint8> data = builder.Build(keyHash);
+
+    if (PrecomputeCacheEnable && !writePrecomputeCache(PrecomputeCacheFile, data, error))
+        LOG_ERROR("module.AutoBalance", "AutoBalance::LoadPrecomputeCache: Could not write `{}`: {}. It will be rebuilt on the next startup.", PrecomputeCacheFile, error);
+
+    if (!precomputeCache.Load(std::move(data), keyHash, error))
+        LOG_ERROR("module.AutoBalance", "AutoBalance::LoadPrecomputeCache: The built data did not validate: {}.", error);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::LoadPrecomputeCache: Built ({}) level profiles from ({}) creature spawns and ({}) multiplier tables in {} ms{}.",
+        precomputeCache.GetLevelProfileCount(),
+        spawns.size(),
+        precomputeCache.GetMultiplierTableCount(),
+        elapsed.count(),
+        PrecomputeCacheEnable ? "" : " (AutoBalance.PrecomputeCache.Enable is off, nothing was written)"
+    );
+}
+
+static void BuildMapDescriptor(MapEntry const* mapEntry, Difficulty difficulty, AutoBalanceMapDescriptor& descriptor)
+{
+    uint32 mapId = mapEntry->MapID;
+
+    descriptor.mapId      = mapId;
+    descriptor.difficulty = difficulty;
+    descriptor.isRaid     = mapEntry->IsRaid();
+    descriptor.isHeroic   = descriptor.isRaid ? difficulty >= RAID_DIFFICULTY_10MAN_HEROIC : difficulty >= DUNGEON_DIFFICULTY_HEROIC;
 
     //
-    // Create an InstanceMap object
+    // Max players, matching InstanceMap::GetMaxPlayers
     //
 
-    InstanceMap* instanceMap = map->ToInstanceMap();
+    MapDifficulty const* mapDifficulty = GetMapDifficultyData(mapId, difficulty);
+    descriptor.maxPlayers = (mapDifficulty && mapDifficulty->maxPlayers) ? mapDifficulty->maxPlayers : mapEntry->maxPlayers;
 
-    LOG_DEBUG("module.AutoBalance", "AutoBalance::LoadMapSettings: Map {} ({}{}, {}-player {}) | Loading settings.",
-        map->GetMapName(),
-        map->GetId(),
-        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-        instanceMap->GetMaxPlayers(),
-        instanceMap->IsHeroic() ? "Heroic" : "Normal"
-    );
+    //
+    // LFG levels, falling back to the non-heroic version for heroic dungeons that aren't in LFG
+    //
+
+    descriptor.lfgMinLevel    = 0;
+    descriptor.lfgMaxLevel    = 0;
+    descriptor.lfgTargetLevel = 0;
+
+    LFGDungeonEntry const* dungeon = GetLFGDungeon(mapId, difficulty);
+    if (!dungeon && descriptor.isHeroic)
+    {
+        if (difficulty == DUNGEON_DIFFICULTY_HEROIC)
+            dungeon = GetLFGDungeon(mapId, DUNGEON_DIFFICULTY_NORMAL);
+        else if (difficulty == RAID_DIFFICULTY_10MAN_HEROIC)
+            dungeon = GetLFGDungeon(mapId, RAID_DIFFICULTY_10MAN_NORMAL);
+        else if (difficulty == RAID_DIFFICULTY_25MAN_HEROIC)
+            dungeon = GetLFGDungeon(mapId, RAID_DIFFICULTY_25MAN_NORMAL);
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::BuildMapDescriptor: Map ({}) difficulty ({}) | is a Heroic dungeon that is not in LFG. Using non-heroic LFG levels.",
+            mapId,
+            difficulty
+        );
+    }
+
+    if (dungeon)
+    {
+        descriptor.lfgMinLevel    = dungeon->MinLevel;
+        descriptor.lfgMaxLevel    = dungeon->MaxLevel;
+        descriptor.lfgTargetLevel = dungeon->TargetLevel;
+    }
+    else
+    {
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::BuildMapDescriptor: Map ({}) difficulty ({}) | Could not determine LFG level ranges for this map. Level will bet set to 0.",
+            mapId,
+            difficulty
+        );
+    }
+
+    //
+    // Enabled by size and difficulty, unless disabled per instance
+    //
+
+    if (descriptor.maxPlayers < 1 || isDungeonInDisabledDungeonIds(mapId))
+        descriptor.enabled = false;
+    else if (descriptor.isHeroic)
+    {
+        if (descriptor.maxPlayers <= 5)
+            descriptor.enabled = Enable5MHeroic;
+        else if (descriptor.maxPlayers <= 10)
+            descriptor.enabled = Enable10MHeroic;
+        else if (descriptor.maxPlayers <= 25)
+            descriptor.enabled = Enable25MHeroic;
+        else
+            descriptor.enabled = EnableOtherHeroic;
+    }
+    else
+    {
+        if (descriptor.maxPlayers <= 5)
+            descriptor.enabled = Enable5M;
+        else if (descriptor.maxPlayers <= 10)
+            descriptor.enabled = Enable10M;
+        else if (descriptor.maxPlayers <= 15)
+            descriptor.enabled = Enable15M;
+        else if (descriptor.maxPlayers <= 20)
+            descriptor.enabled = Enable20M;
+        else if (descriptor.maxPlayers <= 25)
+            descriptor.enabled = Enable25M;
+        else if (descriptor.maxPlayers <= 40)
+            descriptor.enabled = Enable40M;
+        else
+            descriptor.enabled = EnableOtherNormal;
+    }
 
     //
-    // Determine the minumum player count
+    // Minimum player count
     //
 
-    if (isDungeonInMinPlayerMap(map->GetId(), instanceMap->IsHeroic()))
-        mapABInfo->minPlayers = instanceMap->IsHeroic() ? minPlayersPerHeroicDungeonIdMap[map->GetId()] : minPlayersPerDungeonIdMap[map->GetId()];
-    else if (instanceMap->GetMaxPlayers() <= 5 && !instanceMap->IsHeroic())
-        mapABInfo->minPlayers = minPlayersNormal;
-    else if (instanceMap->GetMaxPlayers() <= 5 && instanceMap->IsHeroic())
-        mapABInfo->minPlayers = minPlayersHeroic;
-    else if (instanceMap->GetMaxPlayers() > 5 && !instanceMap->IsHeroic())
-        mapABInfo->minPlayers = minPlayersRaid;
+    if (isDungeonInMinPlayerMap(mapId, descriptor.isHeroic))
+        descriptor.minPlayers = descriptor.isHeroic ? minPlayersPerHeroicDungeonIdMap[mapId] : minPlayersPerDungeonIdMap[mapId];
+    else if (descriptor.maxPlayers <= 5 && !descriptor.isHeroic)
+        descriptor.minPlayers = minPlayersNormal;
+    else if (descriptor.maxPlayers <= 5 && descriptor.isHeroic)
+        descriptor.minPlayers = minPlayersHeroic;
+    else if (descriptor.maxPlayers > 5 && !descriptor.isHeroic)
+        descriptor.minPlayers = minPlayersRaid;
     else
-        mapABInfo->minPlayers = minPlayersRaidHeroic;
+        descriptor.minPlayers = minPlayersRaidHeroic;
 
     //
-    // If the minPlayers value we determined is less than the max number of players in this map, adjust down
+    // If the minPlayers value we determined is greater than the max number of players in this map, adjust down
     //
-    if (mapABInfo->minPlayers > instanceMap->GetMaxPlayers())
+
+    if (descriptor.minPlayers > descriptor.maxPlayers)
     {
-        LOG_WARN("module.AutoBalance", "AutoBalance::LoadMapSettings: Your settings tried to set a minimum player count of {} which is greater than {}'s max player count of {}. Adjusting down.",
-            mapABInfo->minPlayers,
-            map->GetMapName(),
-            instanceMap->GetMaxPlayers()
+        LOG_WARN("module.AutoBalance", "AutoBalance::BuildMapDescriptor: Your settings tried to set a minimum player count of {} which is greater than {}'s max player count of {}. Adjusting down.",
+            descriptor.minPlayers,
+            mapEntry->name[0],
+            descriptor.maxPlayers
         );
 
-        mapABInfo->minPlayers = instanceMap->GetMaxPlayers();
+        descriptor.minPlayers = descriptor.maxPlayers;
     }
 
-    LOG_DEBUG("module.AutoBalance", "AutoBalance::LoadMapSettings: Map {} ({}{}, {}-player {}) | has a minimum player count of {}.",
-        map->GetMapName(),
-        map->GetId(),
-        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-        instanceMap->GetMaxPlayers(),
-        instanceMap->IsHeroic() ? "Heroic" : "Normal",
-        mapABInfo->minPlayers
-    );
+    //
+    // Inflection point overrides
+    //
+
+    descriptor.hasDungeonOverride = hasDungeonOverride(mapId);
+    descriptor.dungeonOverride    = descriptor.hasDungeonOverride ? dungeonOverrides[mapId] : AutoBalanceInflectionPointSettings();
+    descriptor.hasBossOverride    = hasBossOverride(mapId);
+    descriptor.bossOverride       = descriptor.hasBossOverride ? bossOverrides[mapId] : AutoBalanceInflectionPointSettings();
+
+    //
+    // Stat modifier overrides
+    //
+
+    descriptor.hasStatModifierOverride     = hasStatModifierOverride(mapId);
+    descriptor.statModifierOverride        = descriptor.hasStatModifierOverride ? statModifierOverrides[mapId] : AutoBalanceStatModifiers();
+    descriptor.hasStatModifierBossOverride = hasStatModifierBossOverride(mapId);
+    descriptor.statModifierBossOverride    = descriptor.hasStatModifierBossOverride ? statModifierBossOverrides[mapId] : AutoBalanceStatModifiers();
 
     //
     // Dynamic Level Scaling Floor and Ceiling
     //
 
-    // 5-player normal dungeons
-    if (instanceMap->GetMaxPlayers() <= 5 && !instanceMap->IsHeroic())
-    {
-        mapABInfo->levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingDungeons;
-        mapABInfo->levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorDungeons;
+    if (descriptor.maxPlayers <= 5 && !descriptor.isHeroic)
+    {
+        descriptor.levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingDungeons;
+        descriptor.levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorDungeons;
+    }
+    else if (descriptor.maxPlayers <= 5 && descriptor.isHeroic)
+    {
+        descriptor.levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingHeroicDungeons;
+        descriptor.levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorHeroicDungeons;
+    }
+    else if (!descriptor.isHeroic)
+    {
+        descriptor.levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingRaids;
+        descriptor.levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorRaids;
+    }
+    else
+    {
+        descriptor.levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingHeroicRaids;
+        descriptor.levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorHeroicRaids;
+    }
+
+    //
+    // Level Scaling Skip Levels
+    //
+
+    descriptor.levelScalingSkipHigherLevels = LevelScalingSkipHigherLevels;
+    descriptor.levelScalingSkipLowerLevels  = LevelScalingSkipLowerLevels;
+
+    //
+    // Per-instance level scaling overrides, if applicable
+    //
+
+    if (hasDynamicLevelOverride(mapId))
+    {
+        AutoBalanceLevelScalingDynamicLevelSettings* myDynamicLevelSettings = &levelScalingDynamicLevelOverrides[mapId];
+
+        // LevelScaling.SkipHigherLevels
+        if (myDynamicLevelSettings->skipHigher != -1)
+            descriptor.levelScalingSkipHigherLevels = myDynamicLevelSettings->skipHigher;
+
+        // LevelScaling.SkipLowerLevels
+        if (myDynamicLevelSettings->skipLower != -1)
+            descriptor.levelScalingSkipLowerLevels = myDynamicLevelSettings->skipLower;
+
+        // LevelScaling.DynamicLevelCeiling
+        if (myDynamicLevelSettings->ceiling != -1)
+            descriptor.levelScalingDynamicCeiling = myDynamicLevelSettings->ceiling;
+
+        // LevelScaling.DynamicLevelFloor
+        if (myDynamicLevelSettings->floor != -1)
+            descriptor.levelScalingDynamicFloor = myDynamicLevelSettings->floor;
+    }
+}
+
+void LoadMapDescriptors()
+{
+    //
+    // Descriptors are updated in place so that the pointers held by existing maps stay valid across config reloads
+    //
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    uint32 descriptorCount = 0;
+
+    for (uint32 i = 0; i < sMapStore.GetNumRows(); ++i)
+    {
+        MapEntry const* mapEntry = sMapStore.LookupEntry(i);
+        if (!mapEntry || !mapEntry->IsDungeon())
+            continue;
+
+        for (uint8 difficulty = 0; difficulty < MAX_DIFFICULTY; ++difficulty)
+        {
+            BuildMapDescriptor(mapEntry, Difficulty(difficulty), mapDescriptors[MAKE_PAIR32(mapEntry->MapID, difficulty)]);
+            descriptorCount++;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::LoadMapDescriptors: Built ({}) map descriptors in {} ms.", descriptorCount, elapsed.count());
+}
+
+AutoBalanceMapDescriptor const* GetMapDescriptor(Map* map)
+{
+    auto descriptorIterator = mapDescriptors.find(MAKE_PAIR32(map->GetId(), map->GetDifficulty()));
+    if (descriptorIterator == mapDescriptors.end())
+        return nullptr;
+
+    return &descriptorIterator->second;
+}
 
-    }
-    // 5-player heroic dungeons
-    else if (instanceMap->GetMaxPlayers() <= 5 && instanceMap->IsHeroic())
-    {
-        mapABInfo->levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingHeroicDungeons;
-        mapABInfo->levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorHeroicDungeons;
-    }
-    // Normal raids
-    else if (instanceMap->GetMaxPlayers() > 5 && !instanceMap->IsHeroic())
-    {
-        mapABInfo->levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingRaids;
-        mapABInfo->levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorRaids;
-    }
-    // Heroic raids
-    else if (instanceMap->GetMaxPlayers() > 5 && instanceMap->IsHeroic())
-    {
-        mapABInfo->levelScalingDynamicCeiling = LevelScalingDynamicLevelCeilingHeroicRaids;
-        mapABInfo->levelScalingDynamicFloor   = LevelScalingDynamicLevelFloorHeroicRaids;
-    }
-    // something went wrong
-    else
-    {
-        LOG_ERROR("module.AutoBalance", "AutoBalance::LoadMapSettings: Map {} ({}{}, {}-player {}) | Unable to determine dynamic scaling floor and ceiling for instance.",
-            map->GetMapName(),
-            map->GetId(),
-            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-            instanceMap->GetMaxPlayers(),
-            instanceMap->IsHeroic() ? "Heroic" : "Normal"
-        );
+AutoBalanceMapDescriptor const* GetMapDescriptor(uint32 mapId, Difficulty difficulty)
+{
+    auto descriptorIterator = mapDescriptors.find(MAKE_PAIR32(mapId, difficulty));
+    if (descriptorIterator == mapDescriptors.end())
+        return nullptr;
 
-        mapABInfo->levelScalingDynamicCeiling = 3;
-        mapABInfo->levelScalingDynamicFloor   = 5;
+    return &descriptorIterator->second;
+}
 
-    }
+AutoBalanceMapDescriptor const* GetInstanceMapDescriptor(InstanceMap* instanceMap)
+{
+    if (AutoBalanceMapDescriptor const* descriptor = GetMapInfo(instanceMap)->descriptor)
+        return descriptor;
 
     //
-    // Level Scaling Skip Levels
+    // Maps created before the descriptors were built get a private copy
     //
 
-    // Load the global settings into the map
-    mapABInfo->levelScalingSkipHigherLevels = LevelScalingSkipHigherLevels;
-    mapABInfo->levelScalingSkipLowerLevels  = LevelScalingSkipLowerLevels;
+    AutoBalanceMapDescriptor* fallbackDescriptor = instanceMap->CustomData.GetDefault<AutoBalanceMapDescriptor>("AutoBalanceMapDescriptor");
+    if (!fallbackDescriptor->mapId)
+        BuildMapDescriptor(instanceMap->GetEntry(), instanceMap->GetDifficulty(), *fallbackDescriptor);
+
+    return fallbackDescriptor;
+}
 
+void LoadMapSettings(Map* map)
+{
     //
-    // Per-instance overrides, if applicable
+    // Load (or create) the map's info
     //
 
-    if (hasDynamicLevelOverride(map->GetId()))
-    {
-        AutoBalanceLevelScalingDynamicLevelSettings* myDynamicLevelSettings = &levelScalingDynamicLevelOverrides[map->GetId()];
+    AutoBalanceMapInfo*             mapABInfo  = GetMapInfo(map);
+    AutoBalanceMapDescriptor const* descriptor = mapABInfo->descriptor;
 
-        // LevelScaling.SkipHigherLevels
-        if (myDynamicLevelSettings->skipHigher != -1)
-            mapABInfo->levelScalingSkipHigherLevels = myDynamicLevelSettings->skipHigher;
+    if (!descriptor)
+        return;
 
-        // LevelScaling.SkipLowerLevels
-        if (myDynamicLevelSettings->skipLower != -1)
-            mapABInfo->levelScalingSkipLowerLevels = myDynamicLevelSettings->skipLower;
+    LOG_DEBUG("module.AutoBalance", "AutoBalance::LoadMapSettings: Map {} ({}{}, {}-player {}) | Loading settings.",
+        map->GetMapName(),
+        map->GetId(),
+        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+        descriptor->maxPlayers,
+        descriptor->isHeroic ? "Heroic" : "Normal"
+    );
 
-        // LevelScaling.DynamicLevelCeiling
-        if (myDynamicLevelSettings->ceiling != -1)
-            mapABInfo->levelScalingDynamicCeiling = myDynamicLevelSettings->ceiling;
+    //
+    // Everything below was resolved when the descriptor was built
+    //
 
-        // LevelScaling.DynamicLevelFloor
-        if (myDynamicLevelSettings->floor != -1)
-            mapABInfo->levelScalingDynamicFloor = myDynamicLevelSettings->floor;
-    }
+    mapABInfo->minPlayers                   = descriptor->minPlayers;
+    mapABInfo->levelScalingDynamicCeiling   = descriptor->levelScalingDynamicCeiling;
+    mapABInfo->levelScalingDynamicFloor     = descriptor->levelScalingDynamicFloor;
+    mapABInfo->levelScalingSkipHigherLevels = descriptor->levelScalingSkipHigherLevels;
+    mapABInfo->levelScalingSkipLowerLevels  = descriptor->levelScalingSkipLowerLevels;
+
+    LOG_DEBUG("module.AutoBalance", "AutoBalance::LoadMapSettings: Map {} ({}{}, {}-player {}) | has a minimum player count of {}.",
+        map->GetMapName(),
+        map->GetId(),
+        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+        descriptor->maxPlayers,
+        descriptor->isHeroic ? "Heroic" : "Normal",
+        mapABInfo->minPlayers
+    );
 }
 
 // Used for reading the string from the configuration file for per-dungeon minimum player count overrides
@@ -2843,91 +2213,30 @@ bool ShouldMapBeEnabled(Map* map)
             return false;
         }
 
-        // if the player count is less than 1, then we're not in an instance
-        if (instanceMap->GetMaxPlayers() < 1)
-        {
-            LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: {} ({}{}, {}-player {}) - Not enabled because GetMaxPlayers < 1",
-                      map->GetMapName(),
-                      map->GetId(),
-                      map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                      instanceMap->GetMaxPlayers(),
-                      instanceMap->IsHeroic() ? "Heroic" : "Normal"
-            );
-            return false;
-        }
+        // the size, difficulty and per-instance settings were resolved into the map's descriptor
+        AutoBalanceMapDescriptor const* descriptor = GetMapInfo(map)->descriptor;
 
-        // if the Dungeon is disabled via configuration, do not enable it
-        if (isDungeonInDisabledDungeonIds(map->GetId()))
+        if (!descriptor || !descriptor->enabled)
         {
-            LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: {} ({}{}, {}-player {}) - Not enabled because the map ID is disabled via configuration.",
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: Map {} ({}{}, {}-player {}) | Not enabled via configuration.",
                       map->GetMapName(),
                       map->GetId(),
                       map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
                       instanceMap->GetMaxPlayers(),
                       instanceMap->IsHeroic() ? "Heroic" : "Normal"
             );
-
             return false;
         }
 
-        // use the configuration variables to determine if this instance type/size should have scaling enabled
-        bool sizeDifficultyEnabled;
-        if (instanceMap->IsHeroic())
-        {
-            //LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: Heroic Enables - 5:{} 10:{} 25:{} Other:{}",
-            //            Enable5MHeroic, Enable10MHeroic, Enable25MHeroic, EnableOtherHeroic);
-
-            if (instanceMap->GetMaxPlayers() <= 5)
-                sizeDifficultyEnabled = Enable5MHeroic;
-            else if (instanceMap->GetMaxPlayers() <= 10)
-                sizeDifficultyEnabled = Enable10MHeroic;
-            else if (instanceMap->GetMaxPlayers() <= 25)
-                sizeDifficultyEnabled = Enable25MHeroic;
-            else
-                sizeDifficultyEnabled = EnableOtherHeroic;
-        }
-        else
-        {
-            //LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: Normal Enables - 5:{} 10:{} 15:{} 20:{} 25:{} 40:{} Other:{}",
-            //            Enable5M, Enable10M, Enable15M, Enable20M, Enable25M, Enable40M, EnableOtherNormal);
-            if (instanceMap->GetMaxPlayers() <= 5)
-                sizeDifficultyEnabled = Enable5M;
-            else if (instanceMap->GetMaxPlayers() <= 10)
-                sizeDifficultyEnabled = Enable10M;
-            else if (instanceMap->GetMaxPlayers() <= 15)
-                sizeDifficultyEnabled = Enable15M;
-            else if (instanceMap->GetMaxPlayers() <= 20)
-                sizeDifficultyEnabled = Enable20M;
-            else if (instanceMap->GetMaxPlayers() <= 25)
-                sizeDifficultyEnabled = Enable25M;
-            else if (instanceMap->GetMaxPlayers() <= 40)
-                sizeDifficultyEnabled = Enable40M;
-            else
-                sizeDifficultyEnabled = EnableOtherNormal;
-        }
-
-        if (sizeDifficultyEnabled)
-        {
-            LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: Map {} ({}{}, {}-player {}) | Enabled for AutoBalancing.",
-                      map->GetMapName(),
-                      map->GetId(),
-                      map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                      instanceMap->GetMaxPlayers(),
-                      instanceMap->IsHeroic() ? "Heroic" : "Normal"
-            );
-        }
-        else
-        {
-            LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: Map {} ({}{}, {}-player {}) | Not enabled because its size and difficulty are disabled via configuration.",
-                      map->GetMapName(),
-                      map->GetId(),
-                      map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                      instanceMap->GetMaxPlayers(),
-                      instanceMap->IsHeroic() ? "Heroic" : "Normal"
-            );
-        }
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::ShouldMapBeEnabled: Map {} ({}{}, {}-player {}) | Enabled for AutoBalancing.",
+                  map->GetMapName(),
+                  map->GetId(),
+                  map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                  instanceMap->GetMaxPlayers(),
+                  instanceMap->IsHeroic() ? "Heroic" : "Normal"
+        );
 
-        return sizeDifficultyEnabled;
+        return true;
     }
     else
     {
@@ -2943,7 +2252,7 @@ bool ShouldMapBeEnabled(Map* map)
     }
 }
 
-void UpdateMapPlayerStats(Map* map)
+void UpdateMapPlayerStats(Map* map, bool publish)
 {
     //
     // If this isn't a dungeon instance, just bail out immediately
@@ -2981,27 +2290,12 @@ void UpdateMapPlayerStats(Map* map)
     if (UseGroupSizeForDifficulty)
     {
         // Use group/raid size instead of actual in-dungeon player count
-        uint8 groupSize = 0;
-        Group* firstGroup = nullptr;
-        
-        // Find the first player in a group/raid and use that group's size
-        for (Player* player : mapABInfo->allMapPlayers)
-        {
-            if (!player)
-                continue;
-                
-            Group* group = player->GetGroup();
-            if (group)
-            {
-                firstGroup = group;
-                groupSize = group->GetMembersCount();
-                break;
-            }
-        }
-        
+        // The size is kept up to date by the group membership hooks, so the players don't need to be searched here
+        uint8 groupSize = mapABInfo->groupSize;
+
         // If we found a group, use its size; otherwise fall back to in-map count
         mapABInfo->playerCount = (groupSize > 0) ? groupSize : (mapABInfo->allMapPlayers.size() ? mapABInfo->allMapPlayers.size() : 1);
-        
+
         LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Using group size: groupSize = ({}), playerCount = ({}).",
             instanceMap->GetMapName(),
             instanceMap->GetId(),
@@ -3030,40 +2324,55 @@ void UpdateMapPlayerStats(Map* map)
     uint8 adjustedPlayerCount = 0;
 
     //
-    // If combat is locked and the new player count is higher than the combat lock, update the combat lock
+    // If combat is locked and the new player count is higher than the combat lock, raise the floor right away
+    // Any other change is recorded and applied once when combat ends; intermediate joins and leaves collapse into the most recent player count
     //
 
-    if(mapABInfo->combatLocked &&
-       mapABInfo->playerCount > oldPlayerCount &&
-       mapABInfo->playerCount > mapABInfo->combatLockMinPlayers)
+    if (mapABInfo->combatLocked)
     {
-        //
-        // Start with the actual player count
-        //
+        if (mapABInfo->playerCount > oldPlayerCount &&
+            mapABInfo->playerCount > mapABInfo->combatLockMinPlayers)
+        {
+            mapABInfo->combatLockMinPlayers = mapABInfo->playerCount;
 
-        adjustedPlayerCount = mapABInfo->playerCount;
+            // an earlier leave that is still pending is checked against the new count when combat ends
+            if (mapABInfo->pendingCombatChange.pending)
+                mapABInfo->pendingCombatChange.playerCount = mapABInfo->playerCount;
 
-        //
-        // This is the new floor
-        //
+            LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Combat is locked. Combat floor increased. New floor is ({}).",
+                instanceMap->GetMapName(),
+                instanceMap->GetId(),
+                instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
+                mapABInfo->combatLockMinPlayers);
+        }
+        else if (mapABInfo->playerCount != oldPlayerCount)
+        {
+            AutoBalancePendingChange& pendingChange = mapABInfo->pendingCombatChange;
 
-        mapABInfo->combatLockMinPlayers = mapABInfo->playerCount;
+            if (mapABInfo->playerCount > oldPlayerCount)
+                pendingChange.joins  += mapABInfo->playerCount - oldPlayerCount;
+            else
+                pendingChange.leaves += oldPlayerCount - mapABInfo->playerCount;
 
-        LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Combat is locked. Combat floor increased. New floor is ({}).",
-            instanceMap->GetMapName(),
-            instanceMap->GetId(),
-            instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
-            mapABInfo->combatLockMinPlayers);
+            pendingChange.pending     = true;
+            pendingChange.playerCount = mapABInfo->playerCount;
+
+            mapABInfo->combatLockTripped = true;
+
+            LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Combat is locked. Player count change ({}->{}) deferred until combat ends ({} join(s), {} leave(s) pending).",
+                instanceMap->GetMapName(),
+                instanceMap->GetId(),
+                instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
+                oldPlayerCount,
+                mapABInfo->playerCount,
+                pendingChange.joins,
+                pendingChange.leaves);
+        }
 
-    }
-    //
-    // If combat is otherwise locked
-    //
-    else if (mapABInfo->combatLocked)
-    {
         //
         // Start with the saved floor
         //
+
         adjustedPlayerCount = mapABInfo->combatLockMinPlayers ? mapABInfo->combatLockMinPlayers : mapABInfo->playerCount;
 
         LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Combat is locked. Combat floor is ({}).",
@@ -3091,90 +2400,253 @@ void UpdateMapPlayerStats(Map* map)
         adjustedPlayerCount = mapABInfo->minPlayers;
 
     //
-    // Adjust by the PlayerDifficultyOffset
+    // Adjust by the PlayerDifficultyOffset
+    //
+
+    adjustedPlayerCount += PlayerCountDifficultyOffset;
+
+    //
+    // Hold the previous difficulty while a change is waiting out the debounce window
+    //
+
+    adjustedPlayerCount = DebounceAdjustedPlayerCount(map, oldAdjustedPlayerCount, adjustedPlayerCount);
+
+    //
+    // Store the adjusted player count in the map's info
+    //
+
+    mapABInfo->adjustedPlayerCount = adjustedPlayerCount;
+
+    //
+    // If the adjustedPlayerCount changed, schedule this map for a reconfiguration
+    //
+
+    if (oldAdjustedPlayerCount != mapABInfo->adjustedPlayerCount)
+    {
+        mapABInfo->mapConfigTime = 1;
+
+        LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Player difficulty changes ({}->{}). Force map update. {} ({}{}) map config time set to ({}).",
+            instanceMap->GetMapName(),
+            instanceMap->GetId(),
+            instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
+            oldAdjustedPlayerCount,
+            mapABInfo->adjustedPlayerCount,
+            instanceMap->GetMapName(),
+            instanceMap->GetId(),
+            instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
+            mapABInfo->mapConfigTime);
+    }
+
+    //
+    // Read the highest and lowest player levels from the map's level counts
+    //
+
+    uint8 highestPlayerLevel = mapABInfo->playerLevels.highest;
+    uint8 lowestPlayerLevel  = mapABInfo->playerLevels.lowest;
+
+    mapABInfo->highestPlayerLevel = highestPlayerLevel;
+    mapABInfo->lowestPlayerLevel  = lowestPlayerLevel;
+
+    // with no counted players both levels fall back to the LFG target level, as they always have
+    if (!highestPlayerLevel)
+    {
+        mapABInfo->highestPlayerLevel = mapABInfo->lfgTargetLevel;
+        mapABInfo->lowestPlayerLevel  = mapABInfo->lfgTargetLevel;
+
+        //
+        // No non-GM players on the map
+        //
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}, {}-player {}) | has no non-GM players. Player stats derived from LFG target level.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            instanceMap->GetMaxPlayers(),
+            instanceMap->IsHeroic() ? "Heroic" : "Normal");
+    }
+    else
+    {
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}, {}-player {}) | has {} player(s) with level range ({})-({}). Difficulty is {} player(s).",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            instanceMap->GetMaxPlayers(),
+            instanceMap->IsHeroic() ? "Heroic" : "Normal",
+            mapABInfo->playerCount,
+            mapABInfo->lowestPlayerLevel,
+            mapABInfo->highestPlayerLevel,
+            mapABInfo->adjustedPlayerCount);
+    }
+
+    //
+    // Publish the new counts for `.ab instances`, even if the difficulty didn't change or the change was deferred
+    // A map refresh publishes once at its end instead
+    //
+
+    if (publish)
+        PublishInstanceSummary(map);
+}
+
+uint8 DebounceAdjustedPlayerCount(Map* map, uint8 oldAdjustedPlayerCount, uint8 adjustedPlayerCount)
+{
+    AutoBalanceMapInfo*             mapABInfo = GetMapInfo(map);
+    AutoBalancePlayerCountDebounce& debounce  = mapABInfo->playerCountDebounce;
+
+    //
+    // Combat locking decides the difficulty while it is active and a change it deferred is applied as is once it ends;
+    // a map that was never scaled takes the count as is
+    //
+
+    if (!PlayerCountDebounceWindow || mapABInfo->combatLocked || mapABInfo->pendingCombatChange.pending || !oldAdjustedPlayerCount)
+    {
+        debounce.pending = false;
+        return adjustedPlayerCount;
+    }
+
+    //
+    // Back to the current difficulty before the window passed, the rescale is avoided entirely
+    //
+
+    if (adjustedPlayerCount == oldAdjustedPlayerCount)
+    {
+        if (debounce.pending)
+        {
+            debounce.pending = false;
+            ++debounce.suppressedChanges;
+
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::DebounceAdjustedPlayerCount: Map {} ({}{}) | Pending change to ({}) reverted after {} ms, difficulty stays at ({}).",
+                map->GetMapName(),
+                map->GetId(),
+                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                debounce.adjustedPlayerCount,
+                debounce.stableTime,
+                oldAdjustedPlayerCount);
+        }
+
+        return adjustedPlayerCount;
+    }
+
+    //
+    // Increases may skip the window
+    //
+
+    if (adjustedPlayerCount > oldAdjustedPlayerCount && PlayerCountDebounceImmediateIncrease)
+    {
+        if (debounce.pending)
+        {
+            debounce.pending = false;
+            ++debounce.suppressedChanges;
+        }
+
+        return adjustedPlayerCount;
+    }
+
+    //
+    // Wait for the new count to be stable for the whole window; another change restarts it
+    //
+
+    if (!debounce.pending || debounce.adjustedPlayerCount != adjustedPlayerCount)
+    {
+        debounce.pending             = true;
+        debounce.adjustedPlayerCount = adjustedPlayerCount;
+        debounce.stableTime          = 0;
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::DebounceAdjustedPlayerCount: Map {} ({}{}) | Change ({}->{}) held for {} second(s).",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            oldAdjustedPlayerCount,
+            adjustedPlayerCount,
+            PlayerCountDebounceWindow);
+    }
+
+    return oldAdjustedPlayerCount;
+}
+
+void UpdatePlayerCountDebounce(Map* map, uint32 diff)
+{
+    AutoBalanceMapInfo*             mapABInfo = GetMapInfo(map);
+    AutoBalancePlayerCountDebounce& debounce  = mapABInfo->playerCountDebounce;
+
+    //
+    // Combat locking takes precedence, a pending change never lands mid-fight
+    //
+
+    if (!debounce.pending || mapABInfo->combatLocked)
+        return;
+
+    debounce.stableTime += diff;
+
+    if (debounce.stableTime < PlayerCountDebounceWindow * IN_MILLISECONDS)
+        return;
+
+    //
+    // The count has been stable for the whole window, apply it and schedule the map for an update
     //
 
-    adjustedPlayerCount += PlayerCountDifficultyOffset;
+    LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdatePlayerCountDebounce: Map {} ({}{}) | Change ({}->{}) applied after {} ms.",
+        map->GetMapName(),
+        map->GetId(),
+        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+        mapABInfo->adjustedPlayerCount,
+        debounce.adjustedPlayerCount,
+        debounce.stableTime);
 
-    //
-    // Store the adjusted player count in the map's info
-    //
+    debounce.pending               = false;
+    ++debounce.appliedChanges;
 
-    mapABInfo->adjustedPlayerCount = adjustedPlayerCount;
+    mapABInfo->adjustedPlayerCount = debounce.adjustedPlayerCount;
+    mapABInfo->mapConfigTime       = 1;
+}
 
+uint8 GetGroupSizeForDifficulty(Group* group, ObjectGuid leavingMember)
+{
     //
-    // If the adjustedPlayerCount changed, schedule this map for a reconfiguration
+    // The remove member hook runs before the member is taken out of the group
     //
 
-    if (oldAdjustedPlayerCount != mapABInfo->adjustedPlayerCount)
-    {
-        mapABInfo->mapConfigTime = 1;
+    uint32 memberCount = group->GetMembersCount();
 
-        LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}) | Player difficulty changes ({}->{}). Force map update. {} ({}{}) map config time set to ({}).",
-            instanceMap->GetMapName(),
-            instanceMap->GetId(),
-            instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
-            oldAdjustedPlayerCount,
-            mapABInfo->adjustedPlayerCount,
-            instanceMap->GetMapName(),
-            instanceMap->GetId(),
-            instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
-            mapABInfo->mapConfigTime);
-    }
+    if (leavingMember && memberCount && group->IsMember(leavingMember))
+        --memberCount;
+
+    return memberCount;
+}
+
+void TrackMapGroup(Map* map, ObjectGuid leavingMember)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
 
-    uint8 highestPlayerLevel = 0;
-    uint8 lowestPlayerLevel  = 80;
+    mapABInfo->groupGuid.Clear();
+    mapABInfo->groupSize = 0;
+
+    if (!UseGroupSizeForDifficulty)
+        return;
 
     //
-    // Iterate through the players and update the highest and lowest player levels
+    // Use the group of the first grouped player in the map
+    // From here on the size follows the group's membership hooks
     //
 
-    for (std::vector<Player*>::const_iterator playerIterator = mapABInfo->allMapPlayers.begin(); playerIterator != mapABInfo->allMapPlayers.end(); ++playerIterator)
+    for (Player* player : mapABInfo->allMapPlayers)
     {
-        Player* thisPlayer = *playerIterator;
+        // a member that is leaving its group no longer ties the map to it
+        if (!player || player->GetGUID() == leavingMember)
+            continue;
 
-        if (thisPlayer && !thisPlayer->IsGameMaster())
+        if (Group* group = player->GetGroup())
         {
-            if (thisPlayer->GetLevel() > highestPlayerLevel || highestPlayerLevel == 0)
-                highestPlayerLevel = thisPlayer->GetLevel();
-
-            if (thisPlayer->GetLevel() < lowestPlayerLevel || lowestPlayerLevel == 0)
-                lowestPlayerLevel = thisPlayer->GetLevel();
+            mapABInfo->groupGuid = group->GetGUID();
+            mapABInfo->groupSize = GetGroupSizeForDifficulty(group, leavingMember);
+            break;
         }
     }
 
-    mapABInfo->highestPlayerLevel = highestPlayerLevel;
-    mapABInfo->lowestPlayerLevel  = lowestPlayerLevel;
-
-    if (!highestPlayerLevel)
-    {
-        mapABInfo->highestPlayerLevel = mapABInfo->lfgTargetLevel;
-        mapABInfo->lowestPlayerLevel  = mapABInfo->lfgTargetLevel;
-
-        //
-        // No non-GM players on the map
-        //
-
-        LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}, {}-player {}) | has no non-GM players. Player stats derived from LFG target level.",
-            map->GetMapName(),
-            map->GetId(),
-            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-            instanceMap->GetMaxPlayers(),
-            instanceMap->IsHeroic() ? "Heroic" : "Normal");
-    }
-    else
-    {
-        LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapPlayerStats: Map {} ({}{}, {}-player {}) | has {} player(s) with level range ({})-({}). Difficulty is {} player(s).",
-            map->GetMapName(),
-            map->GetId(),
-            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-            instanceMap->GetMaxPlayers(),
-            instanceMap->IsHeroic() ? "Heroic" : "Normal",
-            mapABInfo->playerCount,
-            mapABInfo->lowestPlayerLevel,
-            mapABInfo->highestPlayerLevel,
-            mapABInfo->adjustedPlayerCount);
-    }
+    LOG_DEBUG("module.AutoBalance", "AutoBalance::TrackMapGroup: Map {} ({}{}) | groupSize = ({}).",
+        map->GetMapName(),
+        map->GetId(),
+        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+        mapABInfo->groupSize);
 }
 
 void AddPlayerToMap(Map* map, Player* player)
@@ -3209,7 +2681,7 @@ void AddPlayerToMap(Map* map, Player* player)
     //
     // If this player is already in the map's player list, skip
     //
-    else if (std::find(mapABInfo->allMapPlayers.begin(), mapABInfo->allMapPlayers.end(), player) != mapABInfo->allMapPlayers.end())
+    else if (mapABInfo->allMapPlayerLevels.find(player) != mapABInfo->allMapPlayerLevels.end())
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance::AddPlayerToMap: Player {} ({}) | is already in the map's player list.",
             player->GetName(),
@@ -3224,6 +2696,24 @@ void AddPlayerToMap(Map* map, Player* player)
     mapABInfo->allMapPlayers.push_back(player);
     LOG_DEBUG("module.AutoBalance", "AutoBalance::AddPlayerToMap: Player {} ({}) | added to the map's player list.", player->GetName(), player->GetLevel());
 
+    //
+    // Count the player's level, GMs that are included in the player count don't affect the level range
+    //
+
+    uint8 countedLevel = player->IsGameMaster() ? 0 : player->GetLevel();
+
+    mapABInfo->allMapPlayerLevels[player] = countedLevel;
+
+    if (countedLevel)
+        mapABInfo->playerLevels.Add(countedLevel);
+
+    //
+    // The first grouped player to enter decides which group the map follows
+    //
+
+    if (UseGroupSizeForDifficulty && !mapABInfo->groupGuid && player->GetGroup())
+        TrackMapGroup(map);
+
     //
     // Update the map's player stats
     //
@@ -3231,6 +2721,57 @@ void AddPlayerToMap(Map* map, Player* player)
     UpdateMapPlayerStats(map);
 }
 
+void UpdateMapPlayerLevel(Map* map, Player* player)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    auto playerLevelItr = mapABInfo->allMapPlayerLevels.find(player);
+
+    if (playerLevelItr == mapABInfo->allMapPlayerLevels.end() || !playerLevelItr->second)
+        return;
+
+    //
+    // Move the player's count to their new level
+    //
+
+    mapABInfo->playerLevels.Remove(playerLevelItr->second);
+    playerLevelItr->second = player->GetLevel();
+    mapABInfo->playerLevels.Add(playerLevelItr->second);
+}
+
+void RecountMapPlayerLevels(Map* map)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    //
+    // GM mode can be toggled after a player was counted, move players in or out of the level counts to match
+    //
+
+    for (auto& [player, countedLevel] : mapABInfo->allMapPlayerLevels)
+    {
+        uint8 level = player->IsGameMaster() ? 0 : player->GetLevel();
+
+        if (level == countedLevel)
+            continue;
+
+        LOG_DEBUG("module.AutoBalance", "AutoBalance::RecountMapPlayerLevels: Map {} ({}{}) | Player {} counted level ({}->{}).",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+            player->GetName(),
+            countedLevel,
+            level);
+
+        if (countedLevel)
+            mapABInfo->playerLevels.Remove(countedLevel);
+
+        if (level)
+            mapABInfo->playerLevels.Add(level);
+
+        countedLevel = level;
+    }
+}
+
 bool RemovePlayerFromMap(Map* map, Player* player)
 {
     //
@@ -3243,7 +2784,9 @@ bool RemovePlayerFromMap(Map* map, Player* player)
     // If this player isn't in the map's player list, skip
     //
 
-    if (std::find(mapABInfo->allMapPlayers.begin(), mapABInfo->allMapPlayers.end(), player) == mapABInfo->allMapPlayers.end())
+    auto playerLevelItr = mapABInfo->allMapPlayerLevels.find(player);
+
+    if (playerLevelItr == mapABInfo->allMapPlayerLevels.end())
     {
         LOG_DEBUG("module.AutoBalance", "AutoBalance::RemovePlayerFromMap: Player {} ({}) | was not in the map's player list.", player->GetName(), player->GetLevel());
         return false;
@@ -3253,18 +2796,23 @@ bool RemovePlayerFromMap(Map* map, Player* player)
     // Remove the player from the map's player list
     //
 
+    if (playerLevelItr->second)
+        mapABInfo->playerLevels.Remove(playerLevelItr->second);
+
+    mapABInfo->allMapPlayerLevels.erase(playerLevelItr);
     mapABInfo->allMapPlayers.erase(std::remove(mapABInfo->allMapPlayers.begin(), mapABInfo->allMapPlayers.end(), player), mapABInfo->allMapPlayers.end());
     LOG_DEBUG("module.AutoBalance", "AutoBalance::RemovePlayerFromMap: Player {} ({}) | removed from the map's player list.", player->GetName(), player->GetLevel());
 
     //
-    // If the map is combat locked, schedule a map update for when combat ends
+    // Pick the map's group again if this player belonged to it, so the map stops following a group none of its players are in
     //
 
-    if (mapABInfo->combatLocked)
-        mapABInfo->combatLockTripped = true;
+    if (mapABInfo->groupGuid && player->GetGroup() && player->GetGroup()->GetGUID() == mapABInfo->groupGuid)
+        TrackMapGroup(map);
 
     //
     // Update the map's player stats
+    // If the map is combat locked, the change is recorded and applied when combat ends
     //
 
     UpdateMapPlayerStats(map);
@@ -3272,6 +2820,124 @@ bool RemovePlayerFromMap(Map* map, Player* player)
     return true;
 }
 
+void UpdateMapLevel(Map* map, bool forceWorldMultipliers, bool publish)
+{
+    AutoBalanceMapInfo* mapABInfo = GetMapInfo(map);
+
+    //
+    // If LevelScaling is disabled OR if the average creature level is inside the skip range,
+    // Set the map level to the average creature level, rounded to the nearest integer
+    //
+
+    if (!LevelScaling ||
+        ((mapABInfo->avgCreatureLevel <= mapABInfo->highestPlayerLevel + mapABInfo->levelScalingSkipHigherLevels && mapABInfo->levelScalingSkipHigherLevels != 0) &&
+         (mapABInfo->avgCreatureLevel >= mapABInfo->highestPlayerLevel - mapABInfo->levelScalingSkipLowerLevels && mapABInfo->levelScalingSkipLowerLevels != 0)))
+    {
+        mapABInfo->prevMapLevel          = mapABInfo->mapLevel;
+        mapABInfo->mapLevel              = (uint8)(mapABInfo->avgCreatureLevel + 0.5f);
+        mapABInfo->isLevelScalingEnabled = false;
+
+        //
+        // Only log if the mapLevel has changed
+        //
+
+        if (mapABInfo->prevMapLevel != mapABInfo->mapLevel)
+        {
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapLevel: Map {} ({}{}, {}-player {}) | Level scaling is disabled. Map level tracking stat updated {}{} (original level).",
+                map->GetMapName(),
+                map->GetId(),
+                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                map->ToInstanceMap()->GetMaxPlayers(),
+                map->ToInstanceMap()->IsHeroic() ? "Heroic" : "Normal",
+                mapABInfo->mapLevel != mapABInfo->prevMapLevel ? std::to_string(mapABInfo->prevMapLevel) + "->" : "",
+                mapABInfo->mapLevel);
+        }
+
+    }
+    //
+    // If the average creature level is lower than the highest player level,
+    // Set the map level to the average creature level, rounded to the nearest integer
+    //
+    else if (mapABInfo->avgCreatureLevel <= mapABInfo->highestPlayerLevel)
+    {
+        mapABInfo->prevMapLevel          = mapABInfo->mapLevel;
+        mapABInfo->mapLevel              = (uint8)(mapABInfo->avgCreatureLevel + 0.5f);
+        mapABInfo->isLevelScalingEnabled = true;
+
+        //
+        // Only log if the mapLevel has changed
+        //
+        if (mapABInfo->prevMapLevel != mapABInfo->mapLevel)
+        {
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapLevel: Map {} ({}{}, {}-player {}) | Level scaling is enabled. Map level updated ({}{}) (average creature level).",
+                map->GetMapName(),
+                map->GetId(),
+                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                map->ToInstanceMap()->GetMaxPlayers(),
+                map->ToInstanceMap()->IsHeroic() ? "Heroic" : "Normal",
+                mapABInfo->mapLevel != mapABInfo->prevMapLevel ? std::to_string(mapABInfo->prevMapLevel) + "->" : "",
+                mapABInfo->mapLevel);
+        }
+    }
+    //
+    // Caps at the highest player level
+    //
+    else
+    {
+        mapABInfo->prevMapLevel          = mapABInfo->mapLevel;
+        mapABInfo->mapLevel              = mapABInfo->highestPlayerLevel;
+        mapABInfo->isLevelScalingEnabled = true;
+
+        //
+        // Only log if the mapLevel has changed
+        //
+        if (mapABInfo->prevMapLevel != mapABInfo->mapLevel)
+        {
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapLevel: Map {} ({}{}, {}-player {}) | Level scaling is enabled. Map level updated ({}{}) (highest player level).",
+                map->GetMapName(),
+                map->GetId(),
+                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                map->ToInstanceMap()->GetMaxPlayers(),
+                map->ToInstanceMap()->IsHeroic() ? "Heroic" : "Normal",
+                mapABInfo->mapLevel != mapABInfo->prevMapLevel ? std::to_string(mapABInfo->prevMapLevel) + "->" : "",
+                mapABInfo->mapLevel);
+        }
+    }
+
+    //
+    // World multipliers only need to be updated if the mapLevel has changed OR if the map config is out of date
+    //
+
+    if (mapABInfo->prevMapLevel != mapABInfo->mapLevel || forceWorldMultipliers)
+    {
+        //
+        // Update World Health multiplier
+        // Used for scaling damage against destructible game objects
+        //
+
+        World_Multipliers health = getWorldMultiplier(map, BaseValueType::AUTOBALANCE_HEALTH);
+
+        mapABInfo->worldHealthMultiplier = health.unscaled;
+
+        //
+        // Update World Damage or Healing multiplier
+        // Used for scaling damage and healing between players and/or non-creatures
+        //
+
+        World_Multipliers damageHealing               = getWorldMultiplier(map, BaseValueType::AUTOBALANCE_DAMAGE_HEALING);
+
+        mapABInfo->worldDamageHealingMultiplier       = damageHealing.unscaled;
+        mapABInfo->scaledWorldDamageHealingMultiplier = damageHealing.scaled;
+    }
+
+    //
+    // Publish the new map level for `.ab instances`, unless a map refresh will publish it
+    //
+
+    if (publish)
+        PublishInstanceSummary(map);
+}
+
 bool UpdateMapDataIfNeeded(Map* map, bool force)
 {
     //
@@ -3337,6 +3003,8 @@ bool UpdateMapDataIfNeeded(Map* map, bool force)
             //
 
             mapABInfo->allMapPlayers.clear();
+            mapABInfo->allMapPlayerLevels.clear();
+            mapABInfo->playerLevels.Clear();
 
             //
             // Reset the combat lock
@@ -3350,6 +3018,8 @@ bool UpdateMapDataIfNeeded(Map* map, bool force)
 
             Map::PlayerList const& playerList = map->GetPlayers();
 
+            bool combatLockStarted = false;
+
             //
             // Re-count the players in the dungeon
             //
@@ -3364,7 +3034,14 @@ bool UpdateMapDataIfNeeded(Map* map, bool force)
 
                 if (thisPlayer->IsInCombat())
                 {
-                    mapABInfo->combatLocked = true;
+                    if (!mapABInfo->combatLocked)
+                    {
+                        mapABInfo->combatLocked         = true;
+                        mapABInfo->combatLockStartTime  = getMSTime();
+                        mapABInfo->combatLockEncounters = 0;
+
+                        combatLockStarted = true;
+                    }
 
                     LOG_DEBUG("module.AutoBalance_CombatLocking", "AutoBalance::UpdateMapDataIfNeeded: Map {} ({}{}) | Player {} is in combat. Map is combat locked.",
                         map->GetMapName(),
@@ -3380,6 +3057,13 @@ bool UpdateMapDataIfNeeded(Map* map, bool force)
                 AddPlayerToMap(map, thisPlayer);
             }
 
+            //
+            // Every combat_end telemetry row needs its combat_start; recorded once the players are counted again
+            //
+
+            if (combatLockStarted)
+                RecordEncounterTelemetry(map, AUTOBALANCE_TELEMETRY_COMBAT_START);
+
             //
             // Map's player count will be updated in UpdateMapPlayerStats below
             //
@@ -3450,123 +3134,49 @@ bool UpdateMapDataIfNeeded(Map* map, bool force)
         LoadMapSettings(map);
 
         //
-        // Update the map's player stats
+        // The group size option may have been toggled by a config reload, find the map's group again
         //
 
-        UpdateMapPlayerStats(map);
+        if (isGlobalConfigOutOfDate)
+            TrackMapGroup(map);
 
         //
-        // If LevelScaling is disabled OR if the average creature level is inside the skip range,
-        // Set the map level to the average creature level, rounded to the nearest integer
+        // Update the map's player stats, catching up on any GM mode changes since the players were counted
         //
 
-        if (!LevelScaling ||
-            ((mapABInfo->avgCreatureLevel <= mapABInfo->highestPlayerLevel + mapABInfo->levelScalingSkipHigherLevels && mapABInfo->levelScalingSkipHigherLevels != 0) &&
-             (mapABInfo->avgCreatureLevel >= mapABInfo->highestPlayerLevel - mapABInfo->levelScalingSkipLowerLevels && mapABInfo->levelScalingSkipLowerLevels != 0)))
-        {
-            mapABInfo->prevMapLevel          = mapABInfo->mapLevel;
-            mapABInfo->mapLevel              = (uint8)(mapABInfo->avgCreatureLevel + 0.5f);
-            mapABInfo->isLevelScalingEnabled = false;
-
-            //
-            // Only log if the mapLevel has changed
-            //
-
-            if (mapABInfo->prevMapLevel != mapABInfo->mapLevel)
-            {
-                LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapDataIfNeeded: Map {} ({}{}, {}-player {}) | Level scaling is disabled. Map level tracking stat updated {}{} (original level).",
-                    map->GetMapName(),
-                    map->GetId(),
-                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                    map->ToInstanceMap()->GetMaxPlayers(),
-                    map->ToInstanceMap()->IsHeroic() ? "Heroic" : "Normal",
-                    mapABInfo->mapLevel != mapABInfo->prevMapLevel ? std::to_string(mapABInfo->prevMapLevel) + "->" : "",
-                    mapABInfo->mapLevel);
-            }
+        RecountMapPlayerLevels(map);
+        UpdateMapPlayerStats(map, false);
 
-        }
         //
-        // If the average creature level is lower than the highest player level,
-        // Set the map level to the average creature level, rounded to the nearest integer
+        // Update the map level and the world multipliers that follow it
         //
-        else if (mapABInfo->avgCreatureLevel <= mapABInfo->highestPlayerLevel)
-        {
-            mapABInfo->prevMapLevel          = mapABInfo->mapLevel;
-            mapABInfo->mapLevel              = (uint8)(mapABInfo->avgCreatureLevel + 0.5f);
-            mapABInfo->isLevelScalingEnabled = true;
 
-            //
-            // Only log if the mapLevel has changed
-            //
-            if (mapABInfo->prevMapLevel != mapABInfo->mapLevel)
-            {
-                LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapDataIfNeeded: Map {} ({}{}, {}-player {}) | Level scaling is enabled. Map level updated ({}{}) (average creature level).",
-                    map->GetMapName(),
-                    map->GetId(),
-                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                    map->ToInstanceMap()->GetMaxPlayers(),
-                    map->ToInstanceMap()->IsHeroic() ? "Heroic" : "Normal",
-                    mapABInfo->mapLevel != mapABInfo->prevMapLevel ? std::to_string(mapABInfo->prevMapLevel) + "->" : "",
-                    mapABInfo->mapLevel);
-            }
-        }
+        UpdateMapLevel(map, isMapConfigOutOfDate, false);
+
         //
-        // Caps at the highest player level
+        // Mark the config updated
         //
-        else
-        {
-            mapABInfo->prevMapLevel          = mapABInfo->mapLevel;
-            mapABInfo->mapLevel              = mapABInfo->highestPlayerLevel;
-            mapABInfo->isLevelScalingEnabled = true;
 
-            //
-            // Only log if the mapLevel has changed
-            //
-            if (mapABInfo->prevMapLevel != mapABInfo->mapLevel)
-            {
-                LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapDataIfNeeded: Map {} ({}{}, {}-player {}) | Lcaling is enabled. Map level updated ({}{}) (highest player level).",
-                    map->GetMapName(),
-                    map->GetId(),
-                    map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
-                    map->ToInstanceMap()->GetMaxPlayers(),
-                    map->ToInstanceMap()->IsHeroic() ? "Heroic" : "Normal",
-                    mapABInfo->mapLevel != mapABInfo->prevMapLevel ? std::to_string(mapABInfo->prevMapLevel) + "->" : "",
-                    mapABInfo->mapLevel);
-            }
-        }
+        mapABInfo->globalConfigTime = globalConfigTime;
+        mapABInfo->mapConfigTime    = GetCurrentConfigTime();
 
         //
-        // World multipliers only need to be updated if the mapLevel has changed OR if the map config is out of date
+        // Refresh the multipliers announced to players while the map's settings are at hand
         //
 
-        if (mapABInfo->prevMapLevel != mapABInfo->mapLevel || isMapConfigOutOfDate)
-        {
-            //
-            // Update World Health multiplier
-            // Used for scaling damage against destructible game objects
-            //
-
-            World_Multipliers health = getWorldMultiplier(map, BaseValueType::AUTOBALANCE_HEALTH);
-
-            mapABInfo->worldHealthMultiplier = health.unscaled;
-
-            //
-            // Update World Damage or Healing multiplier
-            // Used for scaling damage and healing between players and/or non-creatures
-            //
+        UpdateMapDisplayMultipliers(map);
 
-            World_Multipliers damageHealing               = getWorldMultiplier(map, BaseValueType::AUTOBALANCE_DAMAGE_HEALING);
+        //
+        // Publish the new state for `.ab instances`, once the counts, level and multipliers are all current
+        //
 
-            mapABInfo->worldDamageHealingMultiplier       = damageHealing.unscaled;
-            mapABInfo->scaledWorldDamageHealingMultiplier = damageHealing.scaled;
-        }
+        PublishInstanceSummary(map);
 
         //
-        // Mark the config updated
+        // Every creature in the map is now out of date, queue them for the next map update
         //
 
-        mapABInfo->globalConfigTime = globalConfigTime;
-        mapABInfo->mapConfigTime    = GetCurrentConfigTime();
+        QueueMapCreaturesForUpdate(map);
 
         LOG_DEBUG("module.AutoBalance", "AutoBalance::UpdateMapDataIfNeeded: {} ({}{}) | Global config time set to ({}).",
             map->GetMapName(),
@@ -3612,42 +3222,77 @@ AutoBalanceMapInfo* GetMapInfo(Map* map)
     if (!map->IsDungeon())
         return mapABInfo;
 
-    // get the map's LFG stats even if not enabled
-    LFGDungeonEntry const* dungeon = GetLFGDungeon(map->GetId(), map->GetDifficulty());
-    if (dungeon) {
-        mapABInfo->lfgMinLevel = dungeon->MinLevel;
-        mapABInfo->lfgMaxLevel = dungeon->MaxLevel;
-        mapABInfo->lfgTargetLevel = dungeon->TargetLevel;
-    }
-    // if this is a heroic dungeon that isn't in LFG, get the stats from the non-heroic version
-    else if (map->IsHeroic())
-    {
-        LFGDungeonEntry const* nonHeroicDungeon = nullptr;
-        if (map->GetDifficulty() == DUNGEON_DIFFICULTY_HEROIC)
-            nonHeroicDungeon = GetLFGDungeon(map->GetId(), DUNGEON_DIFFICULTY_NORMAL);
-        else if (map->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
-            nonHeroicDungeon = GetLFGDungeon(map->GetId(), RAID_DIFFICULTY_10MAN_NORMAL);
-        else if (map->GetDifficulty() == RAID_DIFFICULTY_25MAN_HEROIC)
-            nonHeroicDungeon = GetLFGDungeon(map->GetId(), RAID_DIFFICULTY_25MAN_NORMAL);
-
-        LOG_DEBUG("module.AutoBalance", "AutoBalance::InitializeMap: Map {} ({}{}) | is a Heroic dungeon that is not in LFG. Using non-heroic LFG levels.",
+    // reuse the containers of an unloaded instance of the same map
+    AcquireMapInfoStorage(map, mapABInfo);
+
+    // point the map at its static descriptor and copy the LFG stats even if not enabled
+    mapABInfo->descriptor = GetMapDescriptor(map);
+    if (mapABInfo->descriptor)
+    {
+        mapABInfo->lfgMinLevel    = mapABInfo->descriptor->lfgMinLevel;
+        mapABInfo->lfgMaxLevel    = mapABInfo->descriptor->lfgMaxLevel;
+        mapABInfo->lfgTargetLevel = mapABInfo->descriptor->lfgTargetLevel;
+    }
+    else
+    {
+        LOG_ERROR("module.AutoBalance", "AutoBalance::InitializeMap: Map {} ({}{}) | has no map descriptor. Level will bet set to 0.",
             map->GetMapName(),
             map->GetId(),
             map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
         );
+    }
+
+    //
+    // Seed the creature level stats from the spawn profile built at startup
+    // Maps with a distance check override derive their stats from nearby creatures and are not seeded
+    //
 
-        if (nonHeroicDungeon)
+    AutoBalanceCachedLevelProfile const* profile = precomputeCache.FindLevelProfile(MAKE_PAIR32(map->GetId(), map->GetDifficulty()));
+    if (profile &&
+        mapABInfo->lfgMinLevel && mapABInfo->lfgMaxLevel &&
+        !hasLevelScalingDistanceCheckOverride(map->GetId()))
+    {
+        AutoBalanceCachedLevelBucket const* buckets = precomputeCache.GetLevelBuckets(*profile);
+
+        uint8  minLevel   = (uint8)(((float)mapABInfo->lfgMinLevel * 0.85f) + 0.5f);
+        uint8  maxLevel   = (uint8)(((float)mapABInfo->lfgMaxLevel * 1.15f) + 0.5f);
+        uint32 levelTotal = 0;
+        uint32 spawnCount = 0;
+
+        for (uint32 i = 0; i < profile->bucketCount; ++i)
         {
-            mapABInfo->lfgMinLevel = nonHeroicDungeon->MinLevel;
-            mapABInfo->lfgMaxLevel = nonHeroicDungeon->MaxLevel;
-            mapABInfo->lfgTargetLevel = nonHeroicDungeon->TargetLevel;
+            uint8  level = (uint8)buckets[i].level;
+            uint32 count = buckets[i].count;
+
+            if (level < minLevel || level > maxLevel)
+                continue;
+
+            if (!spawnCount)
+                mapABInfo->profileLowestCreatureLevel = level;
+
+            mapABInfo->profileHighestCreatureLevel = level;
+            levelTotal += level * count;
+            spawnCount += count;
         }
-        else
+
+        if (spawnCount)
         {
-            LOG_ERROR("module.AutoBalance", "AutoBalance::InitializeMap: Map {} ({}{}) | Could not determine LFG level ranges for this map. Level will bet set to 0.",
+            mapABInfo->hasLevelProfile         = true;
+            mapABInfo->profileAvgCreatureLevel = (float)levelTotal / (float)spawnCount;
+            mapABInfo->profileCreatureCount    = spawnCount;
+            mapABInfo->profileBossCount        = profile->bossCount;
+
+            ResetMapCreatureLevelStats(map);
+
+            LOG_DEBUG("module.AutoBalance", "AutoBalance::InitializeMap: Map {} ({}{}) | seeded from spawn profile: ({}) spawns, ({}) bosses, levels ({}-{}), average ({}).",
                 map->GetMapName(),
                 map->GetId(),
-                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
+                map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : "",
+                mapABInfo->profileCreatureCount,
+                mapABInfo->profileBossCount,
+                mapABInfo->profileLowestCreatureLevel,
+                mapABInfo->profileHighestCreatureLevel,
+                mapABInfo->profileAvgCreatureLevel
             );
         }
     }
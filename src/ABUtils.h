@@ -5,30 +5,40 @@
 #ifndef __AB_UTILS_H
 #define __AB_UTILS_H
 
+#include "ABCreatureInfo.h"
 #include "ABInflectionPointSettings.h"
 #include "ABLevelScalingDynamicLevelSettings.h"
+#include "ABMapDescriptor.h"
 #include "ABMapInfo.h"
+#include "ABScalingCore.h"
 #include "ABStatModifiers.h"
 #include "AutoBalance.h"
 
 #include "Creature.h"
+#include "Group.h"
 #include "Map.h"
 #include "SharedDefines.h"
 
 #include <list>
 #include <map>
+#include <set>
 #include <string>
 
 void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = true, bool forceRecalculation = false);
 void RemoveCreatureFromMapData(Creature* creature);
+void RegisterScalableCreature(Creature* creature);
+void UnregisterScalableCreature(Creature* creature);
+void QueueCreatureForUpdate(Creature* creature);
+void QueueMapCreaturesForUpdate(Map* map);
+void ResetMapCreatureLevelStats(Map* map);
+bool JoinSpawnBurst(Creature* creature);
 
 uint64_t GetCurrentConfigTime();
-uint32 getBaseExpansionValueForLevel(const uint32 baseValues[3], uint8 targetLevel);
-float getBaseExpansionValueForLevel(const float baseValues[3], uint8 targetLevel);
 float getDefaultMultiplier(Map* map, AutoBalanceInflectionPointSettings inflectionPointSettings, FormulaType formulaType = AUTOBALANCE_FORMULA_TAN);
 int GetForcedNumPlayers(int creatureId);
 World_Multipliers getWorldMultiplier(Map* map, BaseValueType baseValueType);
 AutoBalanceInflectionPointSettings getInflectionPointSettings(InstanceMap* instanceMap, bool isBoss = false, StatType statType = AUTOBALANCE_STAT_HEALTH);
+AutoBalanceInflectionPointSettings getInflectionPointSettings(AutoBalanceMapDescriptor const* descriptor, bool isBoss = false, StatType statType = AUTOBALANCE_STAT_HEALTH);
 void getStatModifiersDebug(Map* map, Creature* creature, std::string message);
 AutoBalanceStatModifiers getStatModifiers(Map* map, Creature* creature = nullptr);
 
@@ -37,10 +47,11 @@ bool hasDungeonOverride(uint32 dungeonId);
 bool hasDynamicLevelOverride(uint32 dungeonId);
 bool hasLevelScalingDistanceCheckOverride(uint32 dungeonId);
 bool hasStatModifierBossOverride(uint32 dungeonId);
-bool hasStatModifierCreatureOverride(uint32 creatureId);
 bool hasStatModifierOverride(uint32 dungeonId);
 
 bool isBossOrBossSummon(Creature* creature, bool log = false);
+// the creature's policy, resolved on first use and again after a config reload; pass creatureABInfo if it's at hand
+AutoBalanceCreaturePolicy const& GetCreaturePolicy(Creature* creature, AutoBalanceCreatureInfo* creatureABInfo = nullptr);
 bool isCreatureRelevant(Creature* creature);
 bool isDungeonInDisabledDungeonIds(uint32 dungeonId);
 bool isDungeonInMinPlayerMap(uint32 dungeonId, bool isHeroic);
@@ -50,25 +61,38 @@ std::list<uint32> LoadDisabledDungeons(std::string dungeonIdString);
 std::map <uint32, uint32> LoadDistanceCheckOverrides(std::string dungeonIdString);
 std::map <uint8 , AutoBalanceLevelScalingDynamicLevelSettings> LoadDynamicLevelOverrides(std::string dungeonIdString);
 std::map <uint32, AutoBalanceInflectionPointSettings> LoadInflectionPointOverrides(std::string dungeonIdString);
+std::set<uint32> LoadIdSet(std::string idString);
+void LoadPrecomputeCache();
+void LoadMapDescriptors();
 void LoadMapSettings(Map* map);
 std::map <uint32, uint8> LoadMinPlayersPerDungeonId(std::string minPlayersString);
 std::map <uint32, AutoBalanceStatModifiers> LoadStatModifierOverrides(std::string dungeonIdString);
 
 bool ShouldMapBeEnabled (Map* map);
-void UpdateMapPlayerStats (Map* map);
+void UpdateMapPlayerStats (Map* map, bool publish = true);
+uint8 DebounceAdjustedPlayerCount(Map* map, uint8 oldAdjustedPlayerCount, uint8 adjustedPlayerCount);
+void UpdatePlayerCountDebounce(Map* map, uint32 diff);
+uint8 GetGroupSizeForDifficulty(Group* group, ObjectGuid leavingMember = ObjectGuid::Empty);
+void TrackMapGroup(Map* map, ObjectGuid leavingMember = ObjectGuid::Empty);
 void AddPlayerToMap(Map* map, Player* player);
 bool RemovePlayerFromMap(Map* map, Player* player);
+void UpdateMapPlayerLevel(Map* map, Player* player);
+void RecountMapPlayerLevels(Map* map);
+void UpdateMapLevel(Map* map, bool forceWorldMultipliers, bool publish = true);
 bool UpdateMapDataIfNeeded(Map* map, bool force = false);
 AutoBalanceMapInfo* GetMapInfo(Map* map);
-
-// Helper struct for stat multiplier display
-struct StatMultiplierDisplay
-{
-    float healthPercent;
-    float damagePercent;
-};
+AutoBalanceMapDescriptor const* GetMapDescriptor(Map* map);
+AutoBalanceMapDescriptor const* GetMapDescriptor(uint32 mapId, Difficulty difficulty);
+AutoBalanceMapDescriptor const* GetInstanceMapDescriptor(InstanceMap* instanceMap);
 
 StatMultiplierDisplay CalculateStatMultipliersForDisplay(InstanceMap* instanceMap, bool isBoss);
+void UpdateMapDisplayMultipliers(Map* map);
+StatMultiplierDisplay const& GetMapDisplayMultipliers(Map* map, bool isBoss);
 AutoBalanceStatModifiers getStatModifiersForDisplay(Map* map, bool isBoss);
+AutoBalanceStatModifiers getStatModifiersForDisplay(AutoBalanceMapDescriptor const* descriptor, bool isBoss);
+
+// The scaling core's view of the map descriptor; the overrides point into the descriptor
+AutoBalanceScalingMap GetScalingMap(AutoBalanceMapDescriptor const* descriptor);
+CreatureCurveMultipliers getCurveMultipliers(InstanceMap* instanceMap, bool isBoss);
 
 #endif
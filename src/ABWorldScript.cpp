@@ -1,17 +1,87 @@
 #include "ABWorldScript.h"
 
+#include "ABCombatCapture.h"
 #include "ABConfig.h"
+#include "ABEncounterTelemetry.h"
+#include "ABMetrics.h"
 #include "ABUtils.h"
 
 #include "Configuration/Config.h"
 #include "Log.h"
 
-void AutoBalance_WorldScript::OnBeforeConfigLoad(bool /*reload*/)
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// The scaling settings' view of worldserver's config
+class AutoBalance_WorldConfigSource : public AutoBalanceConfigSource
+{
+public:
+    bool GetBool(std::string const& name, bool defaultValue) const override
+    {
+        return sConfigMgr->GetOption<bool>(name, defaultValue, false);
+    }
+
+    float GetFloat(std::string const& name, float defaultValue) const override
+    {
+        return sConfigMgr->GetOption<float>(name, defaultValue, false);
+    }
+
+    std::string GetString(std::string const& name, std::string const& defaultValue) const override
+    {
+        return sConfigMgr->GetOption<std::string>(name, defaultValue, false);
+    }
+};
+
+void AutoBalance_WorldScript::OnBeforeConfigLoad(bool reload)
 {
+    auto startTime = std::chrono::steady_clock::now();
+
     SetInitialWorldSettings();
     globalConfigTime = GetCurrentConfigTime();
 
-    LOG_INFO("module.AutoBalance", "AutoBalance::OnBeforeConfigLoad: Config loaded. Global config time set to ({}).", globalConfigTime);
+    // open, reopen or close the capture file to match the new settings
+    OpenCombatCapture();
+    OpenEncounterTelemetry();
+    OpenMetricsExport();
+
+    // on startup the DBC stores aren't loaded yet, the descriptors are built in OnStartup instead
+    // the multiplier tables depend on the config, so the cache is checked again
+    if (reload)
+    {
+        LoadMapDescriptors();
+        LoadPrecomputeCache();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::OnBeforeConfigLoad: Config loaded in {} ms. Global config time set to ({}).", elapsed.count(), globalConfigTime);
+}
+
+void AutoBalance_WorldScript::OnStartup()
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    // the DBC stores and spawn data are only available once the world has been loaded
+    LoadMapDescriptors();
+    LoadPrecomputeCache();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    LOG_INFO("module.AutoBalance", "AutoBalance::OnStartup: Startup data built in {} ms.", elapsed.count());
+}
+
+void AutoBalance_WorldScript::OnUpdate(uint32 diff)
+{
+    UpdateMetricsExport(diff);
+}
+
+void AutoBalance_WorldScript::OnShutdown()
+{
+    // write out any combat events, encounter records and metrics that are still buffered
+    CloseCombatCapture();
+    CloseEncounterTelemetry();
+    CloseMetricsExport();
 }
 
 void AutoBalance_WorldScript::SetInitialWorldSettings()
@@ -147,215 +217,6 @@ void AutoBalance_WorldScript::SetInitialWorldSettings()
     if (sConfigMgr->GetOption<float>("AutoBalance.BossInflectionMult", false, false))
         LOG_WARN("server.loading", "mod-autobalance: deprecated value `AutoBalance.BossInflectionMult` defined in `AutoBalance.conf`. This variable will be removed in a future release. Please see `AutoBalance.conf.dist` for more details.");
 
-    InflectionPoint                          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint", 0.5f, false);
-    InflectionPointCurveFloor                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.CurveFloor", 0.0f, false);
-    InflectionPointCurveCeiling              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.CurveCeiling", 1.0f, false);
-    InflectionPointBoss                      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.BossModifier", sConfigMgr->GetOption<float>("AutoBalance.BossInflectionMult", 1.0f, false), false); // `AutoBalance.BossInflectionMult` for backwards compatibility
-    InflectionPointBossInflection            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.BossInflection", -1.0f, false);
-    InflectionPointHealth                    = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Health", -1.0f, false);
-    InflectionPointMana                      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Mana", -1.0f, false);
-    InflectionPointArmor                     = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Armor", -1.0f, false);
-    InflectionPointDamage                    = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Damage", -1.0f, false);
-    InflectionPointBossHealth                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Boss.Health", -1.0f, false);
-    InflectionPointBossMana                  = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Boss.Mana", -1.0f, false);
-    InflectionPointBossArmor                 = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Boss.Armor", -1.0f, false);
-    InflectionPointBossDamage                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPoint.Boss.Damage", -1.0f, false);
-
-    InflectionPointHeroic                    = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic", 0.5f, false);
-    InflectionPointHeroicCurveFloor          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.CurveFloor", 0.0f, false);
-    InflectionPointHeroicCurveCeiling        = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.CurveCeiling", 1.0f, false);
-    InflectionPointHeroicBoss                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.BossModifier", sConfigMgr->GetOption<float>("AutoBalance.BossInflectionMult", 1.0f, false), false); // `AutoBalance.BossInflectionMult` for backwards compatibility
-    InflectionPointHeroicBossInflection      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.BossInflection", -1.0f, false);
-    InflectionPointHeroicHealth              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Health", -1.0f, false);
-    InflectionPointHeroicMana                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Mana", -1.0f, false);
-    InflectionPointHeroicArmor               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Armor", -1.0f, false);
-    InflectionPointHeroicDamage              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Damage", -1.0f, false);
-    InflectionPointHeroicBossHealth          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Boss.Health", -1.0f, false);
-    InflectionPointHeroicBossMana            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Boss.Mana", -1.0f, false);
-    InflectionPointHeroicBossArmor           = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Boss.Armor", -1.0f, false);
-    InflectionPointHeroicBossDamage          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointHeroic.Boss.Damage", -1.0f, false);
-
-    InflectionPointRaid                      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid", 0.5f, false);
-    InflectionPointRaidCurveFloor            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.CurveFloor", 0.0f, false);
-    InflectionPointRaidCurveCeiling          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.CurveCeiling", 1.0f, false);
-    InflectionPointRaidBoss                  = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.BossModifier", sConfigMgr->GetOption<float>("AutoBalance.BossInflectionMult", 1.0f, false), false); // `AutoBalance.BossInflectionMult` for backwards compatibility
-    InflectionPointRaidBossInflection        = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.BossInflection", -1.0f, false);
-    InflectionPointRaidHealth                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Health", -1.0f, false);
-    InflectionPointRaidMana                  = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Mana", -1.0f, false);
-    InflectionPointRaidArmor                 = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Armor", -1.0f, false);
-    InflectionPointRaidDamage                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Damage", -1.0f, false);
-    InflectionPointRaidBossHealth            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Boss.Health", -1.0f, false);
-    InflectionPointRaidBossMana              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Boss.Mana", -1.0f, false);
-    InflectionPointRaidBossArmor             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Boss.Armor", -1.0f, false);
-    InflectionPointRaidBossDamage            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid.Boss.Damage", -1.0f, false);
-
-    InflectionPointRaidHeroic                = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic", 0.5f, false);
-    InflectionPointRaidHeroicCurveFloor      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.CurveFloor", 0.0f, false);
-    InflectionPointRaidHeroicCurveCeiling    = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.CurveCeiling", 1.0f, false);
-    InflectionPointRaidHeroicBoss            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.BossModifier", sConfigMgr->GetOption<float>("AutoBalance.BossInflectionMult", 1.0f, false), false); // `AutoBalance.BossInflectionMult` for backwards compatibility
-    InflectionPointRaidHeroicBossInflection  = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.BossInflection", -1.0f, false);
-    InflectionPointRaidHeroicHealth          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Health", -1.0f, false);
-    InflectionPointRaidHeroicMana            = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Mana", -1.0f, false);
-    InflectionPointRaidHeroicArmor           = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Armor", -1.0f, false);
-    InflectionPointRaidHeroicDamage          = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Damage", -1.0f, false);
-    InflectionPointRaidHeroicBossHealth      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Boss.Health", -1.0f, false);
-    InflectionPointRaidHeroicBossMana        = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Boss.Mana", -1.0f, false);
-    InflectionPointRaidHeroicBossArmor       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Boss.Armor", -1.0f, false);
-    InflectionPointRaidHeroicBossDamage      = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaidHeroic.Boss.Damage", -1.0f, false);
-
-    InflectionPointRaid10M                   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M", InflectionPointRaid, false);
-    InflectionPointRaid10MCurveFloor         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.CurveFloor", InflectionPointRaidCurveFloor, false);
-    InflectionPointRaid10MCurveCeiling       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-    InflectionPointRaid10MBoss               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.BossModifier", InflectionPointRaidBoss, false);
-    InflectionPointRaid10MBossInflection     = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.BossInflection", InflectionPointRaidBossInflection, false);
-    InflectionPointRaid10MHealth             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.Health", InflectionPointRaidHealth, false);
-    InflectionPointRaid10MMana               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.Mana", InflectionPointRaidMana, false);
-    InflectionPointRaid10MArmor              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.Armor", InflectionPointRaidArmor, false);
-    InflectionPointRaid10MDamage             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10M.Damage", InflectionPointRaidDamage, false);
-
-    InflectionPointRaid10MHeroic             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic", InflectionPointRaidHeroic, false);
-    InflectionPointRaid10MHeroicCurveFloor   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.CurveFloor", InflectionPointRaidHeroicCurveFloor, false);
-    InflectionPointRaid10MHeroicCurveCeiling = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.CurveCeiling", InflectionPointRaidHeroicCurveCeiling, false);
-    InflectionPointRaid10MHeroicBoss         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.BossModifier", InflectionPointRaidHeroicBoss, false);
-    InflectionPointRaid10MHeroicBossInflection = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.BossInflection", InflectionPointRaidHeroicBossInflection, false);
-    InflectionPointRaid10MHeroicHealth       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.Health", InflectionPointRaidHeroicHealth, false);
-    InflectionPointRaid10MHeroicMana         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.Mana", InflectionPointRaidHeroicMana, false);
-    InflectionPointRaid10MHeroicArmor        = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.Armor", InflectionPointRaidHeroicArmor, false);
-    InflectionPointRaid10MHeroicDamage       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid10MHeroic.Damage", InflectionPointRaidHeroicDamage, false);
-
-    InflectionPointRaid15M                   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M", InflectionPointRaid, false);
-    InflectionPointRaid15MCurveFloor         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.CurveFloor", InflectionPointRaidCurveFloor, false);
-    InflectionPointRaid15MCurveCeiling       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-    InflectionPointRaid15MBoss               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.BossModifier", InflectionPointRaidBoss, false);
-    InflectionPointRaid15MBossInflection     = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.BossInflection", InflectionPointRaidBossInflection, false);
-    InflectionPointRaid15MHealth             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.Health", InflectionPointRaidHealth, false);
-    InflectionPointRaid15MMana               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.Mana", InflectionPointRaidMana, false);
-    InflectionPointRaid15MArmor              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.Armor", InflectionPointRaidArmor, false);
-    InflectionPointRaid15MDamage             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid15M.Damage", InflectionPointRaidDamage, false);
-
-    InflectionPointRaid20M                   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M", InflectionPointRaid, false);
-    InflectionPointRaid20MCurveFloor         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.CurveFloor", InflectionPointRaidCurveFloor, false);
-    InflectionPointRaid20MCurveCeiling       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-    InflectionPointRaid20MBoss               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.BossModifier", InflectionPointRaidBoss, false);
-    InflectionPointRaid20MBossInflection     = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.BossInflection", InflectionPointRaidBossInflection, false);
-    InflectionPointRaid20MHealth             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.Health", InflectionPointRaidHealth, false);
-    InflectionPointRaid20MMana               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.Mana", InflectionPointRaidMana, false);
-    InflectionPointRaid20MArmor              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.Armor", InflectionPointRaidArmor, false);
-    InflectionPointRaid20MDamage             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid20M.Damage", InflectionPointRaidDamage, false);
-
-    InflectionPointRaid25M                   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M", InflectionPointRaid, false);
-    InflectionPointRaid25MCurveFloor         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.CurveFloor", InflectionPointRaidCurveFloor, false);
-    InflectionPointRaid25MCurveCeiling       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-    InflectionPointRaid25MBoss               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.BossModifier", InflectionPointRaidBoss, false);
-    InflectionPointRaid25MBossInflection     = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.BossInflection", InflectionPointRaidBossInflection, false);
-    InflectionPointRaid25MHealth             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.Health", InflectionPointRaidHealth, false);
-    InflectionPointRaid25MMana               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.Mana", InflectionPointRaidMana, false);
-    InflectionPointRaid25MArmor              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.Armor", InflectionPointRaidArmor, false);
-    InflectionPointRaid25MDamage             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25M.Damage", InflectionPointRaidDamage, false);
-
-    InflectionPointRaid25MHeroic             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic", InflectionPointRaidHeroic, false);
-    InflectionPointRaid25MHeroicCurveFloor   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.CurveFloor", InflectionPointRaidHeroicCurveFloor, false);
-    InflectionPointRaid25MHeroicCurveCeiling = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.CurveCeiling", InflectionPointRaidHeroicCurveCeiling, false);
-    InflectionPointRaid25MHeroicBoss         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.BossModifier", InflectionPointRaidHeroicBoss, false);
-    InflectionPointRaid25MHeroicBossInflection = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.BossInflection", InflectionPointRaidHeroicBossInflection, false);
-    InflectionPointRaid25MHeroicHealth       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.Health", InflectionPointRaidHeroicHealth, false);
-    InflectionPointRaid25MHeroicMana         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.Mana", InflectionPointRaidHeroicMana, false);
-    InflectionPointRaid25MHeroicArmor        = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.Armor", InflectionPointRaidHeroicArmor, false);
-    InflectionPointRaid25MHeroicDamage       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid25MHeroic.Damage", InflectionPointRaidHeroicDamage, false);
-
-    InflectionPointRaid40M                   = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M", InflectionPointRaid, false);
-    InflectionPointRaid40MCurveFloor         = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.CurveFloor", InflectionPointRaidCurveFloor, false);
-    InflectionPointRaid40MCurveCeiling       = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-    InflectionPointRaid40MBoss               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.BossModifier", InflectionPointRaidBoss, false);
-    InflectionPointRaid40MHealth             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.Health", InflectionPointRaidHealth, false);
-    InflectionPointRaid40MMana               = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.Mana", InflectionPointRaidMana, false);
-    InflectionPointRaid40MArmor              = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.Armor", InflectionPointRaidArmor, false);
-    InflectionPointRaid40MDamage             = sConfigMgr->GetOption<float>("AutoBalance.InflectionPointRaid40M.Damage", InflectionPointRaidDamage, false);
-
-    //
-    // FormulaType* (Health, Mana, Armor, and Damage formula selection)
-    //
-    std::string formulaTypeHealthStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Health", "tan", false);
-    std::string formulaTypeManaStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Mana", "tan", false);
-    std::string formulaTypeArmorStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Armor", "tan", false);
-    std::string formulaTypeDamageStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Damage", "tan", false);
-    std::string formulaTypeBossHealthStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Boss.Health", "tan", false);
-    std::string formulaTypeBossManaStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Boss.Mana", "tan", false);
-    std::string formulaTypeBossArmorStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Boss.Armor", "tan", false);
-    std::string formulaTypeBossDamageStr = sConfigMgr->GetOption<std::string>("AutoBalance.FormulaType.Boss.Damage", "tan", false);
-
-    if (formulaTypeHealthStr == "log")
-        FormulaTypeHealth = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeHealthStr == "exp")
-        FormulaTypeHealth = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeHealthStr == "pol")
-        FormulaTypeHealth = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeHealth = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeManaStr == "log")
-        FormulaTypeMana = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeManaStr == "exp")
-        FormulaTypeMana = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeManaStr == "pol")
-        FormulaTypeMana = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeMana = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeArmorStr == "log")
-        FormulaTypeArmor = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeArmorStr == "exp")
-        FormulaTypeArmor = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeArmorStr == "pol")
-        FormulaTypeArmor = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeArmor = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeDamageStr == "log")
-        FormulaTypeDamage = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeDamageStr == "exp")
-        FormulaTypeDamage = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeDamageStr == "pol")
-        FormulaTypeDamage = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeDamage = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeBossHealthStr == "log")
-        FormulaTypeBossHealth = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeBossHealthStr == "exp")
-        FormulaTypeBossHealth = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeBossHealthStr == "pol")
-        FormulaTypeBossHealth = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeBossHealth = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeBossManaStr == "log")
-        FormulaTypeBossMana = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeBossManaStr == "exp")
-        FormulaTypeBossMana = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeBossManaStr == "pol")
-        FormulaTypeBossMana = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeBossMana = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeBossArmorStr == "log")
-        FormulaTypeBossArmor = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeBossArmorStr == "exp")
-        FormulaTypeBossArmor = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeBossArmorStr == "pol")
-        FormulaTypeBossArmor = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeBossArmor = AUTOBALANCE_FORMULA_TAN; // default
-
-    if (formulaTypeBossDamageStr == "log")
-        FormulaTypeBossDamage = AUTOBALANCE_FORMULA_LOG;
-    else if (formulaTypeBossDamageStr == "exp")
-        FormulaTypeBossDamage = AUTOBALANCE_FORMULA_EXP;
-    else if (formulaTypeBossDamageStr == "pol")
-        FormulaTypeBossDamage = AUTOBALANCE_FORMULA_POL;
-    else
-        FormulaTypeBossDamage = AUTOBALANCE_FORMULA_TAN; // default
-
     //
     // StatModifier*
     // warn the console if deprecated values are detected
@@ -372,214 +233,6 @@ void AutoBalance_WorldScript::SetInitialWorldSettings()
     if (sConfigMgr->GetOption<float>("AutoBalance.rate.damage", false, false))
         LOG_WARN("server.loading", "mod-autobalance: deprecated value `AutoBalance.rate.damage` defined in `AutoBalance.conf`. This variable will be removed in a future release. Please see `AutoBalance.conf.dist` for more details.");
 
-    //
-    // 5-player dungeons
-    //
-
-    StatModifier_Global                       = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifier_Health                       = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifier_Mana                         = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifier_Armor                        = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifier_Damage                       = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifier_CCDuration                   = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.CCDuration", -1.0f, false);
-
-    StatModifier_Boss_Global                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Boss.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifier_Boss_Health                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Boss.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifier_Boss_Mana                    = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Boss.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifier_Boss_Armor                   = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Boss.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifier_Boss_Damage                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Boss.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifier_Boss_CCDuration              = sConfigMgr->GetOption<float>("AutoBalance.StatModifier.Boss.CCDuration", -1.0f, false);
-
-    //
-    // 5-player heroic dungeons
-    //
-
-    StatModifierHeroic_Global                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifierHeroic_Health                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifierHeroic_Mana                   = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifierHeroic_Armor                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifierHeroic_Damage                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifierHeroic_CCDuration             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.CCDuration", -1.0f, false);
-
-    StatModifierHeroic_Boss_Global            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Boss.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifierHeroic_Boss_Health            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Boss.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifierHeroic_Boss_Mana              = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Boss.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifierHeroic_Boss_Armor             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Boss.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifierHeroic_Boss_Damage            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Boss.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifierHeroic_Boss_CCDuration        = sConfigMgr->GetOption<float>("AutoBalance.StatModifierHeroic.Boss.CCDuration", -1.0f, false);
-
-    //
-    // Default for all raids
-    //
-
-    StatModifierRaid_Global                   = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifierRaid_Health                   = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifierRaid_Mana                     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifierRaid_Armor                    = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifierRaid_Damage                   = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifierRaid_CCDuration               = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.CCDuration", -1.0f, false);
-
-    StatModifierRaid_Boss_Global              = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Boss.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifierRaid_Boss_Health              = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Boss.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifierRaid_Boss_Mana                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Boss.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifierRaid_Boss_Armor               = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Boss.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifierRaid_Boss_Damage              = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Boss.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifierRaid_Boss_CCDuration          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid.Boss.CCDuration", -1.0f, false);
-
-    //
-    // Default for all heroic raids
-    //
-
-    StatModifierRaidHeroic_Global             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifierRaidHeroic_Health             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifierRaidHeroic_Mana               = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifierRaidHeroic_Armor              = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifierRaidHeroic_Damage             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifierRaidHeroic_CCDuration         = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.CCDuration", -1.0f, false);
-
-    StatModifierRaidHeroic_Boss_Global        = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Boss.Global", sConfigMgr->GetOption<float>("AutoBalance.rate.global", 1.0f, false), false); // `AutoBalance.rate.global` for backwards compatibility
-    StatModifierRaidHeroic_Boss_Health        = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Boss.Health", sConfigMgr->GetOption<float>("AutoBalance.rate.health", 1.0f, false), false); // `AutoBalance.rate.health` for backwards compatibility
-    StatModifierRaidHeroic_Boss_Mana          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Boss.Mana", sConfigMgr->GetOption<float>("AutoBalance.rate.mana", 1.0f, false), false); // `AutoBalance.rate.mana` for backwards compatibility
-    StatModifierRaidHeroic_Boss_Armor         = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Boss.Armor", sConfigMgr->GetOption<float>("AutoBalance.rate.armor", 1.0f, false), false); // `AutoBalance.rate.armor` for backwards compatibility
-    StatModifierRaidHeroic_Boss_Damage        = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Boss.Damage", sConfigMgr->GetOption<float>("AutoBalance.rate.damage", 1.0f, false), false); // `AutoBalance.rate.damage` for backwards compatibility
-    StatModifierRaidHeroic_Boss_CCDuration    = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaidHeroic.Boss.CCDuration", -1.0f, false);
-
-    //
-    // 10-player raids
-    //
-
-    StatModifierRaid10M_Global                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Global", StatModifierRaid_Global, false);
-    StatModifierRaid10M_Health                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Health", StatModifierRaid_Health, false);
-    StatModifierRaid10M_Mana                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Mana", StatModifierRaid_Mana, false);
-    StatModifierRaid10M_Armor                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Armor", StatModifierRaid_Armor, false);
-    StatModifierRaid10M_Damage                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Damage", StatModifierRaid_Damage, false);
-    StatModifierRaid10M_CCDuration            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.CCDuration", StatModifierRaid_CCDuration, false);
-
-    StatModifierRaid10M_Boss_Global           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Boss.Global", StatModifierRaid_Boss_Global, false);
-    StatModifierRaid10M_Boss_Health           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Boss.Health", StatModifierRaid_Boss_Health, false);
-    StatModifierRaid10M_Boss_Mana             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-    StatModifierRaid10M_Boss_Armor            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-    StatModifierRaid10M_Boss_Damage           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-    StatModifierRaid10M_Boss_CCDuration       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
-
-    //
-    // 10-player heroic raids
-    //
-
-    StatModifierRaid10MHeroic_Global          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Global", StatModifierRaidHeroic_Global, false);
-    StatModifierRaid10MHeroic_Health          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Health", StatModifierRaidHeroic_Health, false);
-    StatModifierRaid10MHeroic_Mana            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Mana", StatModifierRaidHeroic_Mana, false);
-    StatModifierRaid10MHeroic_Armor           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Armor", StatModifierRaidHeroic_Armor, false);
-    StatModifierRaid10MHeroic_Damage          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Damage", StatModifierRaidHeroic_Damage, false);
-    StatModifierRaid10MHeroic_CCDuration      = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.CCDuration", StatModifierRaidHeroic_CCDuration, false);
-
-    StatModifierRaid10MHeroic_Boss_Global     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Boss.Global", StatModifierRaidHeroic_Boss_Global, false);
-    StatModifierRaid10MHeroic_Boss_Health     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Boss.Health", StatModifierRaidHeroic_Boss_Health, false);
-    StatModifierRaid10MHeroic_Boss_Mana       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Boss.Mana", StatModifierRaidHeroic_Boss_Mana, false);
-    StatModifierRaid10MHeroic_Boss_Armor      = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Boss.Armor", StatModifierRaidHeroic_Boss_Armor, false);
-    StatModifierRaid10MHeroic_Boss_Damage     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Boss.Damage", StatModifierRaidHeroic_Boss_Damage, false);
-    StatModifierRaid10MHeroic_Boss_CCDuration = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid10MHeroic.Boss.CCDuration", StatModifierRaidHeroic_Boss_CCDuration, false);
-
-    //
-    // 15-player raids
-    //
-
-    StatModifierRaid15M_Global                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Global", StatModifierRaid_Global, false);
-    StatModifierRaid15M_Health                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Health", StatModifierRaid_Health, false);
-    StatModifierRaid15M_Mana                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Mana", StatModifierRaid_Mana, false);
-    StatModifierRaid15M_Armor                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Armor", StatModifierRaid_Armor, false);
-    StatModifierRaid15M_Damage                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Damage", StatModifierRaid_Damage, false);
-    StatModifierRaid15M_CCDuration            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.CCDuration", StatModifierRaid_CCDuration, false);
-
-    StatModifierRaid15M_Boss_Global           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Boss.Global", StatModifierRaid_Boss_Global, false);
-    StatModifierRaid15M_Boss_Health           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Boss.Health", StatModifierRaid_Boss_Health, false);
-    StatModifierRaid15M_Boss_Mana             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-    StatModifierRaid15M_Boss_Armor            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-    StatModifierRaid15M_Boss_Damage           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-    StatModifierRaid15M_Boss_CCDuration       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid15M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
-
-    //
-    // 20-player raids
-    //
-
-    StatModifierRaid20M_Global                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Global", StatModifierRaid_Global, false);
-    StatModifierRaid20M_Health                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Health", StatModifierRaid_Health, false);
-    StatModifierRaid20M_Mana                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Mana", StatModifierRaid_Mana, false);
-    StatModifierRaid20M_Armor                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Armor", StatModifierRaid_Armor, false);
-    StatModifierRaid20M_Damage                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Damage", StatModifierRaid_Damage, false);
-    StatModifierRaid20M_CCDuration            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.CCDuration", StatModifierRaid_CCDuration, false);
-
-    StatModifierRaid20M_Boss_Global           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Boss.Global", StatModifierRaid_Boss_Global, false);
-    StatModifierRaid20M_Boss_Health           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Boss.Health", StatModifierRaid_Boss_Health, false);
-    StatModifierRaid20M_Boss_Mana             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-    StatModifierRaid20M_Boss_Armor            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-    StatModifierRaid20M_Boss_Damage           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-    StatModifierRaid20M_Boss_CCDuration       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid20M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
-
-    //
-    // 25-player raids
-    //
-
-    StatModifierRaid25M_Global                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Global", StatModifierRaid_Global, false);
-    StatModifierRaid25M_Health                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Health", StatModifierRaid_Health, false);
-    StatModifierRaid25M_Mana                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Mana", StatModifierRaid_Mana, false);
-    StatModifierRaid25M_Armor                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Armor", StatModifierRaid_Armor, false);
-    StatModifierRaid25M_Damage                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Damage", StatModifierRaid_Damage, false);
-    StatModifierRaid25M_CCDuration            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.CCDuration", StatModifierRaid_CCDuration, false);
-
-    StatModifierRaid25M_Boss_Global           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Boss.Global", StatModifierRaid_Boss_Global, false);
-    StatModifierRaid25M_Boss_Health           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Boss.Health", StatModifierRaid_Boss_Health, false);
-    StatModifierRaid25M_Boss_Mana             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-    StatModifierRaid25M_Boss_Armor            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-    StatModifierRaid25M_Boss_Damage           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-    StatModifierRaid25M_Boss_CCDuration       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
-
-    //
-    // 25-player heroic raids
-    //
-
-    StatModifierRaid25MHeroic_Global          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Global", StatModifierRaidHeroic_Global, false);
-    StatModifierRaid25MHeroic_Health          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Health", StatModifierRaidHeroic_Health, false);
-    StatModifierRaid25MHeroic_Mana            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Mana", StatModifierRaidHeroic_Mana, false);
-    StatModifierRaid25MHeroic_Armor           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Armor", StatModifierRaidHeroic_Armor, false);
-    StatModifierRaid25MHeroic_Damage          = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Damage", StatModifierRaidHeroic_Damage, false);
-    StatModifierRaid25MHeroic_CCDuration      = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.CCDuration", StatModifierRaidHeroic_CCDuration, false);
-
-    StatModifierRaid25MHeroic_Boss_Global     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Boss.Global", StatModifierRaidHeroic_Boss_Global, false);
-    StatModifierRaid25MHeroic_Boss_Health     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Boss.Health", StatModifierRaidHeroic_Boss_Health, false);
-    StatModifierRaid25MHeroic_Boss_Mana       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Boss.Mana", StatModifierRaidHeroic_Boss_Mana, false);
-    StatModifierRaid25MHeroic_Boss_Armor      = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Boss.Armor", StatModifierRaidHeroic_Boss_Armor, false);
-    StatModifierRaid25MHeroic_Boss_Damage     = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Boss.Damage", StatModifierRaidHeroic_Boss_Damage, false);
-    StatModifierRaid25MHeroic_Boss_CCDuration = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid25MHeroic.Boss.CCDuration", StatModifierRaidHeroic_Boss_CCDuration, false);
-
-    //
-    // 40-player raids
-    //
-
-    StatModifierRaid40M_Global                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Global", StatModifierRaid_Global, false);
-    StatModifierRaid40M_Health                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Health", StatModifierRaid_Health, false);
-    StatModifierRaid40M_Mana                  = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Mana", StatModifierRaid_Mana, false);
-    StatModifierRaid40M_Armor                 = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Armor", StatModifierRaid_Armor, false);
-    StatModifierRaid40M_Damage                = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Damage", StatModifierRaid_Damage, false);
-    StatModifierRaid40M_CCDuration            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.CCDuration", StatModifierRaid_CCDuration, false);
-
-    StatModifierRaid40M_Boss_Global           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Boss.Global", StatModifierRaid_Boss_Global, false);
-    StatModifierRaid40M_Boss_Health           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Boss.Health", StatModifierRaid_Boss_Health, false);
-    StatModifierRaid40M_Boss_Mana             = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-    StatModifierRaid40M_Boss_Armor            = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-    StatModifierRaid40M_Boss_Damage           = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-    StatModifierRaid40M_Boss_CCDuration       = sConfigMgr->GetOption<float>("AutoBalance.StatModifierRaid40M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
-
-    //
-    // Modifier Min/Max
-    //
-
-    MinHPModifier         = sConfigMgr->GetOption<float>("AutoBalance.MinHPModifier", 0.1f);
-    MinManaModifier       = sConfigMgr->GetOption<float>("AutoBalance.MinManaModifier", 0.01f);
-    MinDamageModifier     = sConfigMgr->GetOption<float>("AutoBalance.MinDamageModifier", 0.01f);
-    MinCCDurationModifier = sConfigMgr->GetOption<float>("AutoBalance.MinCCDurationModifier", 0.25f);
-    MaxCCDurationModifier = sConfigMgr->GetOption<float>("AutoBalance.MaxCCDurationModifier", 1.0f);
-
     //
     // LevelScaling.*
     //
@@ -639,27 +292,58 @@ void AutoBalance_WorldScript::SetInitialWorldSettings()
     if (sConfigMgr->GetOption<float>("AutoBalance.DungeonScaleDownMoney", false, false))
         LOG_WARN("server.loading", "mod-autobalance: deprecated value `AutoBalance.DungeonScaleDownMoney` defined in `AutoBalance.conf`. This variable will be removed in a future release. Please see `AutoBalance.conf.dist` for more details.");
 
-    std::string RewardScalingMethodString = sConfigMgr->GetOption<std::string>("AutoBalance.RewardScaling.Method", "dynamic", false);
-
-    if (RewardScalingMethodString == "fixed")
-        RewardScalingMethod = AUTOBALANCE_SCALING_FIXED;
-    else if (RewardScalingMethodString == "dynamic")
-        RewardScalingMethod = AUTOBALANCE_SCALING_DYNAMIC;
-    else
-    {
-        LOG_ERROR("server.loading", "mod-autobalance: invalid value `{}` for `AutoBalance.RewardScaling.Method` defined in `AutoBalance.conf`. Defaulting to a value of `dynamic`.", RewardScalingMethodString);
-        RewardScalingMethod = AUTOBALANCE_SCALING_DYNAMIC;
-    }
+    //
+    // InflectionPoint*, StatModifier*, FormulaType*, Min/Max modifiers and RewardScaling.*
+    // the key names and their fallbacks live with the scaling core, which the offline tools share
+    //
 
-    RewardScalingXP            = sConfigMgr->GetOption<bool>("AutoBalance.RewardScaling.XP", sConfigMgr->GetOption<bool>("AutoBalance.DungeonScaleDownXP", true, false));
-    RewardScalingXPModifier    = sConfigMgr->GetOption<float>("AutoBalance.RewardScaling.XP.Modifier", 1.0f, false);
+    std::vector<std::string> scalingSettingsErrors;
+    LoadScalingSettings(ScalingSettings, AutoBalance_WorldConfigSource(), scalingSettingsErrors);
 
-    RewardScalingMoney         = sConfigMgr->GetOption<bool>("AutoBalance.RewardScaling.Money", sConfigMgr->GetOption<bool>("AutoBalance.DungeonScaleDownMoney", true, false));
-    RewardScalingMoneyModifier = sConfigMgr->GetOption<float>("AutoBalance.RewardScaling.Money.Modifier", 1.0f, false);
+    for (std::string const& error : scalingSettingsErrors)
+        LOG_ERROR("server.loading", "mod-autobalance: {}", error);
 
     //
     // Announcement
     //
 
     Announcement = sConfigMgr->GetOption<bool>("AutoBalanceAnnounce.enable", true);
+
+    //
+    // Logging
+    //
+
+    DamageHealingDebugSampleRate   = sConfigMgr->GetOption<uint32>("AutoBalance.Logging.DamageHealingCC.SampleRate", 1);
+    DamageHealingDebugMaxPerSecond = sConfigMgr->GetOption<uint32>("AutoBalance.Logging.DamageHealingCC.MaxPerSecond", 0);
+    DamageHealingDebugSpellIds     = LoadIdSet(sConfigMgr->GetOption<std::string>("AutoBalance.Logging.DamageHealingCC.SpellIds", ""));
+    DamageHealingDebugCreatureIds  = LoadIdSet(sConfigMgr->GetOption<std::string>("AutoBalance.Logging.DamageHealingCC.CreatureIds", ""));
+
+    //
+    // Performance
+    //
+
+    SpawnBurst = sConfigMgr->GetOption<bool>("AutoBalance.SpawnBurst", true);
+
+    PlayerCountDebounceWindow            = sConfigMgr->GetOption<uint32>("AutoBalance.PlayerCountDebounce.Window", 0);
+    PlayerCountDebounceImmediateIncrease = sConfigMgr->GetOption<bool>("AutoBalance.PlayerCountDebounce.ImmediateIncrease", true);
+
+    CombatCaptureEnable    = sConfigMgr->GetOption<bool>("AutoBalance.Capture.Enable", false);
+    CombatCaptureFile      = sConfigMgr->GetOption<std::string>("AutoBalance.Capture.File", "autobalance_capture.bin");
+    CombatCaptureMaxEvents = sConfigMgr->GetOption<uint32>("AutoBalance.Capture.MaxEvents", 1000000);
+
+    PrecomputeCacheEnable = sConfigMgr->GetOption<bool>("AutoBalance.PrecomputeCache.Enable", false);
+    PrecomputeCacheFile   = sConfigMgr->GetOption<std::string>("AutoBalance.PrecomputeCache.File", "autobalance_precompute.bin");
+
+    DecisionTraceEnable = sConfigMgr->GetOption<bool>("AutoBalance.Trace.Enable", false);
+
+    EncounterTelemetryEnable = sConfigMgr->GetOption<bool>("AutoBalance.Telemetry.Enable", false);
+    EncounterTelemetryFile   = sConfigMgr->GetOption<std::string>("AutoBalance.Telemetry.File", "autobalance_encounters.csv");
+
+    MetricsEnable       = sConfigMgr->GetOption<bool>("AutoBalance.Metrics.Enable", false);
+    MetricsFile         = sConfigMgr->GetOption<std::string>("AutoBalance.Metrics.File", "autobalance.prom");
+    MetricsInterval     = std::max<uint32>(1, sConfigMgr->GetOption<uint32>("AutoBalance.Metrics.Interval", 15));
+    MetricsMaxInstances = sConfigMgr->GetOption<uint32>("AutoBalance.Metrics.MaxInstances", 200);
+
+    // the exported time counters need the timers too
+    ProfilingEnable     = sConfigMgr->GetOption<bool>("AutoBalance.Profiling.Enable", false) || MetricsEnable;
 }
@@ -12,12 +12,18 @@ class AutoBalance_WorldScript : public WorldScript
 public:
     AutoBalance_WorldScript()
         : WorldScript("AutoBalance_WorldScript", {
-            WORLDHOOK_ON_BEFORE_CONFIG_LOAD
+            WORLDHOOK_ON_BEFORE_CONFIG_LOAD,
+            WORLDHOOK_ON_STARTUP,
+            WORLDHOOK_ON_UPDATE,
+            WORLDHOOK_ON_SHUTDOWN
         })
     {
     }
 
-    void OnBeforeConfigLoad(bool /*reload*/) override;
+    void OnBeforeConfigLoad(bool reload) override;
+    void OnStartup() override;
+    void OnUpdate(uint32 diff) override;
+    void OnShutdown() override;
 
     void SetInitialWorldSettings();
 };
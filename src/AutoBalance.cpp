@@ -37,6 +37,7 @@
 #include "ABCreatureInfo.h"
 #include "ABGameObjectScript.h"
 #include "ABGlobalScript.h"
+#include "ABGroupScript.h"
 #include "ABInflectionPointSettings.h"
 #include "ABLevelScalingDynamicLevelSettings.h"
 #include "ABMapInfo.h"
@@ -82,4 +83,5 @@ void AddAutoBalanceScripts()
     new AutoBalance_AllMapScript();
     new AutoBalance_CommandScript();
     new AutoBalance_GlobalScript();
+    new AutoBalance_GroupScript();
 }
@@ -26,7 +26,24 @@ enum StatType
     AUTOBALANCE_STAT_HEALTH,
     AUTOBALANCE_STAT_MANA,
     AUTOBALANCE_STAT_ARMOR,
-    AUTOBALANCE_STAT_DAMAGE
+    AUTOBALANCE_STAT_DAMAGE,
+    AUTOBALANCE_STAT_COUNT
+};
+
+enum Scaling_Tier
+{
+    AUTOBALANCE_TIER_DUNGEON,          // 1 to 5 player normal
+    AUTOBALANCE_TIER_RAID_10M,
+    AUTOBALANCE_TIER_RAID_15M,
+    AUTOBALANCE_TIER_RAID_20M,
+    AUTOBALANCE_TIER_RAID_25M,
+    AUTOBALANCE_TIER_RAID_40M,
+    AUTOBALANCE_TIER_RAID,             // more than 40 players
+    AUTOBALANCE_TIER_HEROIC_DUNGEON,   // 1 to 5 player heroic
+    AUTOBALANCE_TIER_HEROIC_RAID_10M,
+    AUTOBALANCE_TIER_HEROIC_RAID_25M,
+    AUTOBALANCE_TIER_HEROIC_RAID,      // more than 25 players
+    AUTOBALANCE_TIER_COUNT
 };
 
 enum Relevance
@@ -42,6 +59,61 @@ enum Damage_Healing_Debug_Phase
     AUTOBALANCE_DAMAGE_HEALING_DEBUG_PHASE_AFTER
 };
 
+enum Combat_Capture_Hook
+{
+    AUTOBALANCE_CAPTURE_HOOK_PERIODIC_DAMAGE_AURAS_TICK,
+    AUTOBALANCE_CAPTURE_HOOK_SPELL_DAMAGE_TAKEN,
+    AUTOBALANCE_CAPTURE_HOOK_MELEE_DAMAGE,
+    AUTOBALANCE_CAPTURE_HOOK_HEAL_RECEIVED,
+    AUTOBALANCE_CAPTURE_HOOK_AURA_APPLY
+};
+
+enum Combat_Capture_Role
+{
+    AUTOBALANCE_CAPTURE_ROLE_NONE,
+    AUTOBALANCE_CAPTURE_ROLE_PLAYER,
+    AUTOBALANCE_CAPTURE_ROLE_PLAYER_CONTROLLED,
+    AUTOBALANCE_CAPTURE_ROLE_CREATURE,
+    AUTOBALANCE_CAPTURE_ROLE_BOSS
+};
+
+enum Decision_Trace_Reason
+{
+    AUTOBALANCE_TRACE_GLOBAL_DISABLED,
+    AUTOBALANCE_TRACE_SOURCE_NOT_IN_WORLD,
+    AUTOBALANCE_TRACE_SPELL_NEVER_MODIFIED,
+    AUTOBALANCE_TRACE_MAP_NOT_ENABLED,
+    AUTOBALANCE_TRACE_PLAYER_SELF_HEAL,
+    AUTOBALANCE_TRACE_PLAYER_SPENDS_HEALTH,
+    AUTOBALANCE_TRACE_ENEMY_PLAYER,
+    AUTOBALANCE_TRACE_SHARED_DAMAGE_AURA,
+    AUTOBALANCE_TRACE_PLAYER_PET,
+    AUTOBALANCE_TRACE_MAP_MULTIPLIER,
+    AUTOBALANCE_TRACE_MAP_MULTIPLIER_UNSCALED,
+    AUTOBALANCE_TRACE_CREATURE_MULTIPLIER,
+    AUTOBALANCE_TRACE_CREATURE_MULTIPLIER_UNSCALED,
+    AUTOBALANCE_TRACE_CC_DURATION,
+    AUTOBALANCE_TRACE_UNCHANGED,        // returned unchanged without a trace (outside instances, or a CC that isn't scaled)
+    AUTOBALANCE_TRACE_REASON_COUNT
+};
+
+enum Map_Metric_Type
+{
+    AUTOBALANCE_METRIC_HOOKS,       // damage, healing and CC hooks
+    AUTOBALANCE_METRIC_CREATURES,   // creature level selection and add/remove world hooks
+    AUTOBALANCE_METRIC_SCALING,     // ModifyCreatureAttributes, also counted in the category it was called from
+    AUTOBALANCE_METRIC_MAP_UPDATE,  // map update hook
+    AUTOBALANCE_METRIC_COUNT
+};
+
+enum Encounter_Telemetry_Event
+{
+    AUTOBALANCE_TELEMETRY_COMBAT_START,  // the map became combat locked
+    AUTOBALANCE_TELEMETRY_COMBAT_END,    // the map's combat lock was lifted
+    AUTOBALANCE_TELEMETRY_ENCOUNTER,     // an encounter was credited
+    AUTOBALANCE_TELEMETRY_EVENT_COUNT
+};
+
 struct World_Multipliers
 {
     float scaled   = 1.0f;
@@ -3,10 +3,90 @@
 #define AB_MESSAGE_H
 
 #include "Common.h"
-#include "ItemTemplate.h"
+#include "StringFormat.h"
 
+#include <array>
+#include <optional>
 #include <string>
+#include <string_view>
 
-std::string ABGetLocaleText(LocaleConstant locale, const std::string& titleType);
+enum AutoBalanceMessage
+{
+    AB_MSG_WELCOME_TO_PLAYER,
+    AB_MSG_WELCOME_TO_GM,
+    AB_MSG_ANNOUNCE_NON_GM_ENTERING_INSTANCE,
+    AB_MSG_LEAVING_INSTANCE_COMBAT,
+    AB_MSG_LEAVING_INSTANCE,
+    AB_MSG_SET_OFFSET_COMMAND_DESCRIPTION,
+    AB_MSG_SET_OFFSET_COMMAND_SUCCESS,
+    AB_MSG_SET_OFFSET_COMMAND_ERROR,
+    AB_MSG_GET_OFFSET_COMMAND_SUCCESS,
+    AB_MSG_ADJUSTED_PLAYER_COUNT_COMBAT_LOCKED,
+    AB_MSG_ADJUSTED_PLAYER_COUNT_MAP_MINIMUM,
+    AB_MSG_ADJUSTED_PLAYER_COUNT_MAP_MINIMUM_DIFFICULTY_OFFSET,
+    AB_MSG_ADJUSTED_PLAYER_COUNT_DIFFICULTY_OFFSET,
+    AB_MSG_ADJUSTED_PLAYER_COUNT,
+    AB_MSG_LFG_RANGE,
+    AB_MSG_MAP_LEVEL,
+    AB_MSG_LEVEL_SCALING_ENABLED,
+    AB_MSG_LEVEL_SCALING_DISABLED,
+    AB_MSG_WORLD_HEALTH_MULTIPLIER,
+    AB_MSG_WORLD_HOSTILE_DAMAGE_HEALING_MULTIPLIER_TO,
+    AB_MSG_WORLD_HOSTILE_DAMAGE_HEALING_MULTIPLIER,
+    AB_MSG_ORIGINAL_CREATURE_LEVEL_RANGE,
+    AB_MSG_ACTIVE_TOTAL_CREATURES_IN_MAP,
+    AB_MSG_COMMAND_ONLY_IN_INSTANCE,
+    AB_MSG_TARGET_NO_IN_INSTANCE,
+    AB_MSG_ACTIVE_FOR_MAP_STATS,
+    AB_MSG_IGNORED_FOR_MAP_STATS,
+    AB_MSG_CREATURE_DIFFICULTY_LEVEL,
+    AB_MSG_CLONE_OF_SUMMON,
+    AB_MSG_SUMMON_OF_SUMMON,
+    AB_MSG_SUMMON_WITHOUT_SUMMONER,
+    AB_MSG_HEALTH_MULTIPLIER_TO,
+    AB_MSG_MANA_MULTIPLIER_TO,
+    AB_MSG_ARMOR_MULTIPLIER_TO,
+    AB_MSG_DAMAGE_MULTIPLIER_TO,
+    AB_MSG_HEALTH_MULTIPLIER,
+    AB_MSG_MANA_MULTIPLIER,
+    AB_MSG_ARMOR_MULTIPLIER,
+    AB_MSG_DAMAGE_MULTIPLIER,
+    AB_MSG_CC_DURATION_MULTIPLIER,
+    AB_MSG_XP_MONEY_MULTIPLIER,
+    AB_MSG_LEAVING_INSTANCE_COMBAT_CHANGE,
+    AB_MSG_SPAWN_BURST_STATS,
+    AB_MSG_SPAWN_PROFILE,
+    AB_MSG_DISPLAY_MULTIPLIERS,
+    AB_MSG_DEBOUNCE_PENDING_CHANGE,
+    AB_MSG_DEBOUNCE_CHANGES,
+    AB_MSG_COUNT
+};
+
+std::string_view ABGetLocaleText(LocaleConstant locale, AutoBalanceMessage message);
+
+//
+// Formats a message at most once per locale, for messages that are sent to every player in a map
+//
+class ABLocaleMessageCache
+{
+public:
+    explicit ABLocaleMessageCache(AutoBalanceMessage message) : _message(message) {}
+
+    template<typename... Args>
+    std::string const& Get(LocaleConstant locale, Args&&... args)
+    {
+        if (locale >= TOTAL_LOCALES)
+            locale = LOCALE_enUS;
+
+        if (!_formatted[locale])
+            _formatted[locale] = Acore::StringFormat(ABGetLocaleText(locale, _message), std::forward<Args>(args)...);
+
+        return *_formatted[locale];
+    }
+
+private:
+    AutoBalanceMessage                                    _message;
+    std::array<std::optional<std::string>, TOTAL_LOCALES> _formatted;
+};
 
 #endif // AB_MESSAGE_H
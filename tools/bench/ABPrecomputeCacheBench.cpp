@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABPrecomputeCache.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <random>
+
+//
+// LoadPrecomputeCache's startup work without the world database: the key both paths pay for, building and writing
+// the cache when the key changed, and mapping it when it didn't
+// The spawns and map descriptors are synthetic, sized after a WotLK world's instance spawns and map difficulties
+//
+
+namespace
+{
+    uint64_t const KeyHash = 42;
+
+    struct BenchWorld
+    {
+        std::vector<AutoBalanceProfileSpawn> spawns;
+        std::vector<std::pair<uint32_t, AutoBalanceScalingMap>> maps;
+        AutoBalanceScalingSettings settings;
+    };
+
+    BenchWorld const& GetWorld(std::size_t spawnCount)
+    {
+        static std::map<std::size_t, BenchWorld> worlds;
+
+        auto worldIterator = worlds.find(spawnCount);
+        if (worldIterator != worlds.end())
+            return worldIterator->second;
+
+        BenchWorld& world = worlds[spawnCount];
+        std::mt19937 random(42);
+
+        // 150 instance maps with up to 4 difficulties each
+        uint32_t const maxPlayers[] = { 5, 10, 25, 40 };
+        for (uint32_t mapId = 0; mapId < 150; ++mapId)
+        {
+            for (uint32_t difficulty = 0; difficulty < 1 + mapId % 4; ++difficulty)
+            {
+                AutoBalanceScalingMap map;
+                map.maxPlayers = maxPlayers[mapId % 4] == 10 && difficulty % 2 ? 25 : maxPlayers[mapId % 4];
+                map.isHeroic   = difficulty > 0;
+                world.maps.push_back({ mapId | (difficulty << 16), map });
+            }
+        }
+
+        std::uniform_int_distribution<std::size_t> mapIndex(0, world.maps.size() - 1);
+        std::uniform_int_distribution<int> levelOffset(-3, 3);
+        std::uniform_int_distribution<uint32_t> entry(1, 40000);
+
+        for (std::size_t i = 0; i < spawnCount; ++i)
+        {
+            uint32_t key = world.maps[mapIndex(random)].first;
+
+            AutoBalanceProfileSpawn spawn;
+            spawn.key    = key;
+            spawn.entry  = entry(random);
+            spawn.level  = (uint8_t)(20 + (key & 0xFFFF) % 60 + levelOffset(random));
+            spawn.isBoss = i % 50 == 0;
+            world.spawns.push_back(spawn);
+        }
+
+        return world;
+    }
+
+    uint64_t HashWorld(BenchWorld const& world)
+    {
+        AutoBalanceCacheHasher hasher;
+        hasher.Add(world.spawns.data(), world.spawns.size() * sizeof(AutoBalanceProfileSpawn));
+        return hasher.GetHash();
+    }
+
+    std::vector<uint8_t> BuildWorld(BenchWorld const& world)
+    {
+        AutoBalancePrecomputeCacheBuilder builder;
+
+        for (AutoBalanceProfileSpawn const& spawn : world.spawns)
+            builder.AddLevelProfileSpawn(spawn);
+
+        for (auto const& [key, map] : world.maps)
+            builder.AddMultiplierTable(key, world.settings, map);
+
+        for (uint32_t classIndex = 0; classIndex < AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT; ++classIndex)
+            for (uint32_t level = 0; level < AUTOBALANCE_PRECOMPUTE_CACHE_LEVEL_COUNT; ++level)
+                builder.SetBaseValues(classIndex, (uint8_t)level, { 100.0f * level, 10.0f * level });
+
+        return builder.Build(KeyHash);
+    }
+
+    std::string CacheFileName(std::size_t spawnCount)
+    {
+        return "ab_precompute_bench_" + std::to_string(spawnCount) + ".bin";
+    }
+}
+
+static void BM_PrecomputeCacheKey(benchmark::State& state)
+{
+    BenchWorld const& world = GetWorld(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(HashWorld(world));
+}
+
+// A key mismatch: build everything and write the file
+static void BM_PrecomputeCacheBuild(benchmark::State& state)
+{
+    BenchWorld const& world = GetWorld(state.range(0));
+    std::string fileName = CacheFileName(state.range(0));
+    std::string error;
+
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> data = BuildWorld(world);
+        if (!writePrecomputeCache(fileName, data, error))
+            state.SkipWithError(error.c_str());
+
+        AutoBalancePrecomputeCache cache;
+        cache.Load(std::move(data), KeyHash, error);
+        benchmark::DoNotOptimize(cache.GetSize());
+    }
+}
+
+// A key match: map the file and validate it
+static void BM_PrecomputeCacheMap(benchmark::State& state)
+{
+    BenchWorld const& world = GetWorld(state.range(0));
+    std::string fileName = CacheFileName(state.range(0));
+    std::string error;
+
+    if (!writePrecomputeCache(fileName, BuildWorld(world), error))
+        state.SkipWithError(error.c_str());
+
+    for (auto _ : state)
+    {
+        AutoBalancePrecomputeCache cache;
+        if (!cache.Map(fileName, KeyHash, error))
+            state.SkipWithError(error.c_str());
+        benchmark::DoNotOptimize(cache.GetSize());
+    }
+
+    std::remove(fileName.c_str());
+}
+
+BENCHMARK(BM_PrecomputeCacheKey)->Arg(50000)->Arg(150000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PrecomputeCacheBuild)->Arg(50000)->Arg(150000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PrecomputeCacheMap)->Arg(50000)->Arg(150000)->Unit(benchmark::kMillisecond);
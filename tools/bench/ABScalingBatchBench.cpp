@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingBatch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+//
+// A full rescale of a map's creatures: calculateCreatureMultipliers per creature against the batch kernel
+// The batch timings include filling the batch, as ProcessUpdateQueue does
+//
+
+namespace
+{
+    struct BenchCreatures
+    {
+        std::vector<CreatureCurveMultipliers>   curves;
+        std::vector<AutoBalanceScalingCreature> creatures;
+    };
+
+    BenchCreatures MakeCreatures(std::size_t count)
+    {
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> curve(0.2f, 1.0f);
+        std::uniform_real_distribution<float> modifier(0.5f, 1.5f);
+        std::uniform_real_distribution<float> base(1000.0f, 500000.0f);
+
+        BenchCreatures bench;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            AutoBalanceScalingCreature creature;
+            creature.statModifiers    = AutoBalanceStatModifiers(modifier(random), modifier(random), modifier(random), modifier(random), modifier(random), i % 4 ? modifier(random) : -1.0f);
+            creature.baseHealth       = base(random);
+            creature.baseMana         = i % 3 ? base(random) : 0.0f;
+            creature.baseArmor        = base(random) / 10.0f;
+            creature.healthLevelRatio = modifier(random);
+            creature.damageLevelRatio = modifier(random);
+
+            bench.curves.push_back({ curve(random), curve(random), curve(random), curve(random) });
+            creature.defaultMultiplier = bench.curves.back().health;
+            bench.creatures.push_back(creature);
+        }
+
+        return bench;
+    }
+}
+
+static void BM_CreatureMultipliersScalar(benchmark::State& state)
+{
+    AutoBalanceScalingSettings settings;
+    BenchCreatures bench = MakeCreatures(state.range(0));
+    std::vector<AutoBalanceCreatureMultipliers> results(bench.creatures.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < bench.creatures.size(); ++i)
+            results[i] = calculateCreatureMultipliers(settings, bench.curves[i], bench.creatures[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_CreatureMultipliersBatch(benchmark::State& state)
+{
+    AutoBalanceScalingSettings settings;
+    BenchCreatures bench = MakeCreatures(state.range(0));
+    AutoBalanceCreatureBatch batch;
+
+    for (auto _ : state)
+    {
+        batch.Resize(bench.creatures.size());
+
+        for (std::size_t i = 0; i < bench.creatures.size(); ++i)
+            batch.Set(i, bench.curves[i], bench.creatures[i]);
+
+        calculateCreatureMultipliersBatch(settings, batch);
+
+        benchmark::DoNotOptimize(batch.health.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(getCreatureBatchKernelName());
+}
+
+// The kernel alone, on a batch that is already filled
+static void BM_CreatureMultipliersBatchKernel(benchmark::State& state)
+{
+    AutoBalanceScalingSettings settings;
+    BenchCreatures bench = MakeCreatures(state.range(0));
+    AutoBalanceCreatureBatch batch;
+    batch.Resize(bench.creatures.size());
+
+    for (std::size_t i = 0; i < bench.creatures.size(); ++i)
+        batch.Set(i, bench.curves[i], bench.creatures[i]);
+
+    for (auto _ : state)
+    {
+        calculateCreatureMultipliersBatch(settings, batch);
+
+        benchmark::DoNotOptimize(batch.health.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(getCreatureBatchKernelName());
+}
+
+BENCHMARK(BM_CreatureMultipliersScalar)->Arg(2000);
+BENCHMARK(BM_CreatureMultipliersBatch)->Arg(2000);
+BENCHMARK(BM_CreatureMultipliersBatchKernel)->Arg(2000);
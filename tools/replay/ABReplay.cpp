@@ -0,0 +1,377 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABCombatCaptureFormat.h"
+#include "ABCombatDecision.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+//
+// ab_replay: makes the damage, healing and CC duration decisions of a combat capture (AutoBalance.Capture.Enable) again
+// Each event's recorded flags and multiplier go through the same decision code as the UnitScript hooks, and the
+// replayed reason, multiplier source and amount are compared with the recorded ones
+//
+//   ab_replay [--repeat N] [--mismatches N] <capture.bin>...
+//   ab_replay --synthesize N <capture.bin>
+//
+// The multipliers themselves are replayed as recorded, they depend on the creatures and maps of the running server
+// --synthesize writes N random events whose outcomes come from the current decision code, then replays them
+//
+
+namespace
+{
+    char const* const hookNames[] =
+    {
+        "periodic_damage_auras_tick",
+        "spell_damage_taken",
+        "melee_damage",
+        "heal_received",
+        "aura_apply"
+    };
+
+    std::size_t const hookCount = sizeof(hookNames) / sizeof(hookNames[0]);
+
+    // the replayed amounts are added up here so the compiler can't drop the timed work
+    volatile int64_t replaySink = 0;
+
+    char const* GetHookName(uint8_t hook)
+    {
+        return hook < hookCount ? hookNames[hook] : "unknown";
+    }
+
+    struct ReplayResult
+    {
+        int32_t amountOut;
+        uint8_t reason;
+        uint8_t multiplierSource;
+    };
+
+    ReplayResult Replay(AutoBalanceCombatCaptureEvent const& event)
+    {
+        AutoBalanceCombatDecision decision;
+        decision.flags      = event.flags;
+        decision.multiplier = event.multiplier;
+
+        if (event.hook == AUTOBALANCE_CAPTURE_HOOK_AURA_APPLY)
+        {
+            decideCCDuration(decision);
+            return { applyCCDurationDecision(decision, event.amountIn), decision.reason, decision.multiplierSource };
+        }
+
+        decideDamageHealing(decision, event.amountIn);
+        return { applyDamageHealingDecision(decision, event.amountIn), decision.reason, decision.multiplierSource };
+    }
+
+    bool Matches(AutoBalanceCombatCaptureEvent const& event, ReplayResult const& result)
+    {
+        return result.amountOut == event.amountOut && result.reason == event.reason && result.multiplierSource == event.multiplierSource;
+    }
+
+    bool ReadCapture(std::string const& fileName, std::vector<AutoBalanceCombatCaptureEvent>& events)
+    {
+        FILE* file = std::fopen(fileName.c_str(), "rb");
+
+        if (!file)
+        {
+            std::fprintf(stderr, "ab_replay: can't read %s\n", fileName.c_str());
+            return false;
+        }
+
+        AutoBalanceCombatCaptureHeader header;
+        bool valid = std::fread(&header, sizeof(header), 1, file) == 1 && header.magic == AUTOBALANCE_COMBAT_CAPTURE_MAGIC;
+
+        if (!valid)
+            std::fprintf(stderr, "ab_replay: %s is not a combat capture\n", fileName.c_str());
+        else if (header.version != AUTOBALANCE_COMBAT_CAPTURE_VERSION || header.eventSize != sizeof(AutoBalanceCombatCaptureEvent))
+        {
+            // version 1 captures didn't record the decision inputs
+            std::fprintf(stderr, "ab_replay: %s is a version %u capture with %u byte events, only version %u with %zu byte events can be replayed\n",
+                fileName.c_str(), header.version, header.eventSize, AUTOBALANCE_COMBAT_CAPTURE_VERSION, sizeof(AutoBalanceCombatCaptureEvent));
+            valid = false;
+        }
+
+        if (valid)
+        {
+            AutoBalanceCombatCaptureEvent event;
+
+            // a capture that is still being written may end with a partial event
+            while (std::fread(&event, sizeof(event), 1, file) == 1)
+                events.push_back(event);
+        }
+
+        std::fclose(file);
+        return valid;
+    }
+
+    bool WriteSyntheticCapture(std::string const& fileName, std::size_t count)
+    {
+        FILE* file = std::fopen(fileName.c_str(), "wb");
+
+        if (!file)
+        {
+            std::fprintf(stderr, "ab_replay: can't write %s\n", fileName.c_str());
+            return false;
+        }
+
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> hook(0, hookCount - 1);
+        std::uniform_int_distribution<uint32_t> damageHealingFlags(0, 0x3FFF);
+        std::uniform_int_distribution<uint32_t> ccDurationFlags(0, 0xFF);
+        std::uniform_int_distribution<int32_t> amount(1, 50000);
+        std::uniform_int_distribution<int32_t> duration(1000, 30000);
+        std::uniform_real_distribution<float> multiplier(0.1f, 3.0f);
+
+        // mostly events that get scaled, like a real instance
+        uint32_t const scaled = AUTOBALANCE_DAMAGE_HEALING_GLOBAL_ENABLED | AUTOBALANCE_DAMAGE_HEALING_IN_INSTANCE |
+                                AUTOBALANCE_DAMAGE_HEALING_SOURCE_IN_WORLD | AUTOBALANCE_DAMAGE_HEALING_MAPS_ENABLED;
+
+        AutoBalanceCombatCaptureHeader header;
+        header.eventSize = sizeof(AutoBalanceCombatCaptureEvent);
+        std::fwrite(&header, sizeof(header), 1, file);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            AutoBalanceCombatCaptureEvent event;
+            AutoBalanceCombatDecision decision;
+
+            event.timestamp = i;
+            event.hook      = hook(random);
+
+            if (event.hook == AUTOBALANCE_CAPTURE_HOOK_AURA_APPLY)
+            {
+                decision.flags      = ccDurationFlags(random);
+                decision.multiplier = (i % 5) ? multiplier(random) : 1.0f;
+                event.amountIn      = duration(random);
+
+                decideCCDuration(decision);
+                event.amountOut = applyCCDurationDecision(decision, event.amountIn);
+            }
+            else
+            {
+                decision.flags = damageHealingFlags(random);
+
+                if (i % 4)
+                    decision.flags |= scaled;
+
+                event.amountIn = event.hook == AUTOBALANCE_CAPTURE_HOOK_HEAL_RECEIVED || (i % 7) == 0 ? amount(random) : -amount(random);
+
+                // the hooks only look a multiplier up when the decision uses one
+                decideDamageHealing(decision, event.amountIn);
+
+                if (decision.multiplierSource != AUTOBALANCE_MULTIPLIER_NONE)
+                    decision.multiplier = multiplier(random);
+
+                event.amountOut = applyDamageHealingDecision(decision, event.amountIn);
+            }
+
+            event.flags            = decision.flags;
+            event.multiplier       = decision.multiplier;
+            event.reason           = decision.reason;
+            event.multiplierSource = decision.multiplierSource;
+
+            std::fwrite(&event, sizeof(event), 1, file);
+        }
+
+        std::fclose(file);
+        return true;
+    }
+
+    struct Counts
+    {
+        uint64_t events     = 0;
+        uint64_t mismatches = 0;
+    };
+
+    // Every event once, with a time stamp around each; the timer's own cost is measured the same way and subtracted
+    void ReportLatency(std::vector<AutoBalanceCombatCaptureEvent> const& events)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::vector<int64_t> overheads(std::min<std::size_t>(events.size(), 100000));
+
+        for (int64_t& overhead : overheads)
+        {
+            Clock::time_point start = Clock::now();
+            overhead = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        }
+
+        std::sort(overheads.begin(), overheads.end());
+        int64_t timerOverhead = overheads.empty() ? 0 : overheads[overheads.size() / 2];
+
+        std::vector<int64_t> latencies(events.size());
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            Clock::time_point start = Clock::now();
+            ReplayResult result = Replay(events[i]);
+            latencies[i] = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count() - timerOverhead);
+
+            replaySink = replaySink + result.amountOut;
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        auto percentile = [&latencies](double fraction)
+        {
+            return latencies[std::min<std::size_t>(latencies.size() - 1, latencies.size() * fraction)];
+        };
+
+        std::printf("latency: p50 %lld ns, p90 %lld ns, p99 %lld ns, p99.9 %lld ns, max %lld ns per event (timer overhead of %lld ns subtracted)\n",
+            (long long)percentile(0.5),
+            (long long)percentile(0.9),
+            (long long)percentile(0.99),
+            (long long)percentile(0.999),
+            (long long)latencies.back(),
+            (long long)timerOverhead
+        );
+    }
+
+    void ReportThroughput(std::vector<AutoBalanceCombatCaptureEvent> const& events, uint32_t repeat)
+    {
+        int64_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t pass = 0; pass < repeat; ++pass)
+            for (AutoBalanceCombatCaptureEvent const& event : events)
+                sum += Replay(event).amountOut;
+
+        replaySink = replaySink + sum;
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        uint64_t total = (uint64_t)events.size() * repeat;
+
+        std::printf("throughput: %llu events in %.3f ms (%u passes), %.1f million events/s\n",
+            (unsigned long long)total,
+            seconds * 1000.0,
+            repeat,
+            seconds > 0.0 ? total / seconds / 1000000.0 : 0.0
+        );
+    }
+
+    // Adds the number of events whose replayed outcome differs from the recorded one to totalMismatches
+    bool ReplayCapture(std::string const& fileName, uint32_t repeat, uint32_t mismatchLimit, uint64_t& totalMismatches)
+    {
+        std::vector<AutoBalanceCombatCaptureEvent> events;
+
+        if (!ReadCapture(fileName, events))
+            return false;
+
+        std::printf("%s: %zu events\n", fileName.c_str(), events.size());
+
+        if (events.empty())
+            return true;
+
+        Counts hookCounts[hookCount + 1];
+        Counts reasonCounts[AUTOBALANCE_TRACE_REASON_COUNT + 1];
+        uint64_t mismatches = 0;
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            AutoBalanceCombatCaptureEvent const& event = events[i];
+            ReplayResult result = Replay(event);
+            bool matches = Matches(event, result);
+
+            Counts& hook   = hookCounts[std::min<std::size_t>(event.hook, hookCount)];
+            Counts& reason = reasonCounts[std::min<std::size_t>(event.reason, AUTOBALANCE_TRACE_REASON_COUNT)];
+
+            ++hook.events;
+            ++reason.events;
+
+            if (matches)
+                continue;
+
+            ++hook.mismatches;
+            ++reason.mismatches;
+
+            if (mismatches++ == 0 && mismatchLimit)
+                std::printf("\nmismatches (recorded -> replayed):\n");
+
+            if (mismatches <= mismatchLimit)
+                std::printf("  #%zu %s spell %u, flags %#06x, multiplier %g: %s -> %s, %s -> %s, %d -> %d\n",
+                    i,
+                    GetHookName(event.hook),
+                    event.spellId,
+                    event.flags,
+                    event.multiplier,
+                    getDecisionTraceReasonName(event.reason),
+                    getDecisionTraceReasonName(result.reason),
+                    getCombatMultiplierSourceName(event.multiplierSource),
+                    getCombatMultiplierSourceName(result.multiplierSource),
+                    event.amountOut,
+                    result.amountOut
+                );
+        }
+
+        std::printf("\n%-30s %12s %12s\n", "hook", "events", "mismatches");
+
+        for (std::size_t hook = 0; hook <= hookCount; ++hook)
+            if (hookCounts[hook].events)
+                std::printf("%-30s %12llu %12llu\n", hook < hookCount ? hookNames[hook] : "unknown", (unsigned long long)hookCounts[hook].events, (unsigned long long)hookCounts[hook].mismatches);
+
+        std::printf("\n%-30s %12s %12s\n", "recorded reason", "events", "mismatches");
+
+        for (std::size_t reason = 0; reason <= AUTOBALANCE_TRACE_REASON_COUNT; ++reason)
+            if (reasonCounts[reason].events)
+                std::printf("%-30s %12llu %12llu\n", getDecisionTraceReasonName(reason), (unsigned long long)reasonCounts[reason].events, (unsigned long long)reasonCounts[reason].mismatches);
+
+        std::printf("\n");
+        ReportThroughput(events, repeat);
+        ReportLatency(events);
+        std::printf("differences: %llu of %zu events\n\n", (unsigned long long)mismatches, events.size());
+
+        totalMismatches += mismatches;
+        return true;
+    }
+
+    int Usage()
+    {
+        std::fprintf(stderr, "usage: ab_replay [--repeat N] [--mismatches N] <capture.bin>...\n");
+        std::fprintf(stderr, "       ab_replay --synthesize N <capture.bin>\n");
+        return 2;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t repeat = 10;
+    uint32_t mismatchLimit = 20;
+    std::size_t synthesize = 0;
+    std::vector<std::string> captureFiles;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeat = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--mismatches") && i + 1 < argc)
+            mismatchLimit = std::max(0, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--synthesize") && i + 1 < argc)
+            synthesize = std::max(1, std::atoi(argv[++i]));
+        else if (argv[i][0] == '-')
+            return Usage();
+        else
+            captureFiles.push_back(argv[i]);
+    }
+
+    if (captureFiles.empty() || (synthesize && captureFiles.size() != 1))
+        return Usage();
+
+    if (synthesize && !WriteSyntheticCapture(captureFiles[0], synthesize))
+        return 1;
+
+    uint64_t mismatches = 0;
+
+    for (std::string const& captureFile : captureFiles)
+        if (!ReplayCapture(captureFile, repeat, mismatchLimit, mismatches))
+            return 1;
+
+    return mismatches ? 1 : 0;
+}
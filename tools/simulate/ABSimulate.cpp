@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingCore.h"
+#include "ABScalingSettings.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// ab_simulate: every multiplier an AutoBalance.conf produces, for every instance tier, difficulty, player count and boss status
+// The same math as the worldserver, without the per-instance and per-creature overrides (they need map and creature IDs) or level scaling
+//
+//   ab_simulate [--format csv|json] [--repeat N] <AutoBalance.conf>...
+//
+// --repeat loads each config and calculates its grid N times, and reports the configs per second on stderr
+//
+
+namespace
+{
+    // An AzerothCore style config file: `Name = Value` lines, `#` comments, optionally quoted values
+    // Like the worldserver, values that don't parse as the requested type are replaced by the default
+    class ConfFileSource : public AutoBalanceConfigSource
+    {
+    public:
+        bool Load(std::string const& fileName)
+        {
+            std::ifstream file(fileName);
+
+            if (!file)
+                return false;
+
+            std::string line;
+
+            while (std::getline(file, line))
+            {
+                std::string::size_type equals = line.find('=');
+                std::string name = Trim(line.substr(0, equals));
+
+                if (equals == std::string::npos || name.empty() || name[0] == '#' || name[0] == '[')
+                    continue;
+
+                std::string value = Trim(line.substr(equals + 1));
+
+                if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                    value = value.substr(1, value.size() - 2);
+
+                _values[name] = value;
+            }
+
+            return true;
+        }
+
+        bool GetBool(std::string const& name, bool defaultValue) const override
+        {
+            std::string const* value = Find(name);
+
+            if (!value)
+                return defaultValue;
+
+            std::string lower = *value;
+            std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+
+            if (lower == "1" || lower == "true" || lower == "yes")
+                return true;
+            else if (lower == "0" || lower == "false" || lower == "no")
+                return false;
+
+            return defaultValue;
+        }
+
+        float GetFloat(std::string const& name, float defaultValue) const override
+        {
+            std::string const* value = Find(name);
+
+            if (!value)
+                return defaultValue;
+
+            char* end = nullptr;
+            float result = std::strtof(value->c_str(), &end);
+
+            return end != value->c_str() && *end == '\0' ? result : defaultValue;
+        }
+
+        std::string GetString(std::string const& name, std::string const& defaultValue) const override
+        {
+            std::string const* value = Find(name);
+            return value ? *value : defaultValue;
+        }
+
+    private:
+        static std::string Trim(std::string const& text)
+        {
+            std::string::size_type begin = text.find_first_not_of(" \t\r\n");
+            std::string::size_type end   = text.find_last_not_of(" \t\r\n");
+
+            return begin == std::string::npos ? "" : text.substr(begin, end - begin + 1);
+        }
+
+        // an empty value counts as unset
+        std::string const* Find(std::string const& name) const
+        {
+            auto itr = _values.find(name);
+            return itr == _values.end() || itr->second.empty() ? nullptr : &itr->second;
+        }
+
+        std::unordered_map<std::string, std::string> _values;
+    };
+
+    // One map size per tier that has instances
+    struct SimulatedMap
+    {
+        uint32_t maxPlayers;
+        bool     isHeroic;
+    };
+
+    SimulatedMap const simulatedMaps[] =
+    {
+        { 5,  false }, { 10, false }, { 15, false }, { 20, false }, { 25, false }, { 40, false },
+        { 5,  true  }, { 10, true  }, { 25, true  }
+    };
+
+    struct SimulatedRow
+    {
+        SimulatedMap                   map;
+        uint32_t                       playerCount;
+        bool                           isBoss;
+        AutoBalanceCreatureMultipliers multipliers;
+    };
+
+    void CalculateGrid(AutoBalanceScalingSettings const& settings, std::vector<SimulatedRow>& rows)
+    {
+        rows.clear();
+
+        for (SimulatedMap const& simulatedMap : simulatedMaps)
+        {
+            AutoBalanceScalingMap map;
+            map.maxPlayers = simulatedMap.maxPlayers;
+            map.isHeroic   = simulatedMap.isHeroic;
+
+            for (uint32_t playerCount = 1; playerCount <= simulatedMap.maxPlayers; ++playerCount)
+                for (bool isBoss : { false, true })
+                    rows.push_back({ simulatedMap, playerCount, isBoss, calculateMapMultipliers(settings, map, isBoss, (float)playerCount) });
+        }
+    }
+
+    void PrintCsvHeader()
+    {
+        std::printf("config,tier,max_players,heroic,players,boss,health,mana,armor,damage,cc_duration,xp,money\n");
+    }
+
+    void PrintCsv(std::string const& config, std::vector<SimulatedRow> const& rows)
+    {
+        for (SimulatedRow const& row : rows)
+        {
+            AutoBalanceCreatureMultipliers const& multipliers = row.multipliers;
+
+            std::printf("%s,%s,%u,%d,%u,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+                config.c_str(),
+                getScalingTierName(getScalingTier(row.map.isHeroic, row.map.maxPlayers)),
+                row.map.maxPlayers,
+                row.map.isHeroic ? 1 : 0,
+                row.playerCount,
+                row.isBoss ? 1 : 0,
+                multipliers.healthMultiplier,
+                multipliers.manaMultiplier,
+                multipliers.armorMultiplier,
+                multipliers.damageMultiplier,
+                multipliers.ccDurationMultiplier,
+                multipliers.xpModifier,
+                multipliers.moneyModifier
+            );
+        }
+    }
+
+    void PrintJson(std::string const& config, std::vector<SimulatedRow> const& rows, std::vector<std::string> const& errors, bool first)
+    {
+        std::string escapedConfig;
+
+        for (char c : config)
+        {
+            if (c == '"' || c == '\\')
+                escapedConfig += '\\';
+
+            escapedConfig += c;
+        }
+
+        std::printf("%s  { \"config\": \"%s\", \"errors\": %zu, \"rows\": [\n", first ? "" : ",\n", escapedConfig.c_str(), errors.size());
+
+        for (std::size_t i = 0; i < rows.size(); ++i)
+        {
+            SimulatedRow const& row = rows[i];
+            AutoBalanceCreatureMultipliers const& multipliers = row.multipliers;
+
+            std::printf("    { \"tier\": \"%s\", \"max_players\": %u, \"heroic\": %s, \"players\": %u, \"boss\": %s, "
+                "\"health\": %.4f, \"mana\": %.4f, \"armor\": %.4f, \"damage\": %.4f, \"cc_duration\": %.4f, \"xp\": %.4f, \"money\": %.4f }%s\n",
+                getScalingTierName(getScalingTier(row.map.isHeroic, row.map.maxPlayers)),
+                row.map.maxPlayers,
+                row.map.isHeroic ? "true" : "false",
+                row.playerCount,
+                row.isBoss ? "true" : "false",
+                multipliers.healthMultiplier,
+                multipliers.manaMultiplier,
+                multipliers.armorMultiplier,
+                multipliers.damageMultiplier,
+                multipliers.ccDurationMultiplier,
+                multipliers.xpModifier,
+                multipliers.moneyModifier,
+                i + 1 < rows.size() ? "," : ""
+            );
+        }
+
+        std::printf("  ] }");
+    }
+
+    int Usage()
+    {
+        std::fprintf(stderr, "usage: ab_simulate [--format csv|json] [--repeat N] <AutoBalance.conf>...\n");
+        return 2;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    uint32_t repeat = 1;
+    std::vector<std::string> configFiles;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--format") && i + 1 < argc)
+        {
+            ++i;
+
+            if (!std::strcmp(argv[i], "json"))
+                json = true;
+            else if (std::strcmp(argv[i], "csv"))
+                return Usage();
+        }
+        else if (!std::strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeat = std::max(1, std::atoi(argv[++i]));
+        else if (argv[i][0] == '-')
+            return Usage();
+        else
+            configFiles.push_back(argv[i]);
+    }
+
+    if (configFiles.empty())
+        return Usage();
+
+    if (json)
+        std::printf("[\n");
+    else
+        PrintCsvHeader();
+
+    std::vector<SimulatedRow> rows;
+    std::chrono::steady_clock::duration elapsed {};
+    std::size_t gridRows = 0;
+
+    for (std::size_t configIndex = 0; configIndex < configFiles.size(); ++configIndex)
+    {
+        std::string const& configFile = configFiles[configIndex];
+        ConfFileSource config;
+
+        if (!config.Load(configFile))
+        {
+            std::fprintf(stderr, "ab_simulate: can't read %s\n", configFile.c_str());
+            return 1;
+        }
+
+        AutoBalanceScalingSettings settings;
+        std::vector<std::string> errors;
+
+        // the settings are loaded again on every repeat, that's part of what a config costs
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < repeat; ++i)
+        {
+            settings = AutoBalanceScalingSettings();
+            errors.clear();
+
+            LoadScalingSettings(settings, config, errors);
+            CalculateGrid(settings, rows);
+        }
+
+        elapsed  += std::chrono::steady_clock::now() - start;
+        gridRows += rows.size();
+
+        for (std::string const& error : errors)
+            std::fprintf(stderr, "ab_simulate: %s: %s\n", configFile.c_str(), error.c_str());
+
+        if (json)
+            PrintJson(configFile, rows, errors, !configIndex);
+        else
+            PrintCsv(configFile, rows);
+    }
+
+    if (json)
+        std::printf("\n]\n");
+
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    std::size_t configCount = configFiles.size() * repeat;
+
+    std::fprintf(stderr, "ab_simulate: %zu config(s), %zu grid rows each, %.3f ms, %.0f configs/s\n",
+        configCount,
+        gridRows / configFiles.size(),
+        seconds * 1000.0,
+        seconds > 0.0 ? configCount / seconds : 0.0
+    );
+
+    return 0;
+}
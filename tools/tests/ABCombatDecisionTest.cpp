@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABCombatDecision.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    // An event that got through the pre-flight checks
+    uint32_t const scaled = AUTOBALANCE_DAMAGE_HEALING_GLOBAL_ENABLED | AUTOBALANCE_DAMAGE_HEALING_IN_INSTANCE |
+                            AUTOBALANCE_DAMAGE_HEALING_SOURCE_IN_WORLD | AUTOBALANCE_DAMAGE_HEALING_MAPS_ENABLED;
+
+    uint32_t const playerSelf       = scaled | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_TARGET | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER;
+    uint32_t const creatureOnPlayer = scaled | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_CREATURE | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER;
+
+    AutoBalanceCombatDecision DecideDamageHealing(uint32_t flags, int32_t amount)
+    {
+        AutoBalanceCombatDecision decision;
+        decision.flags = flags;
+
+        decideDamageHealing(decision, amount);
+
+        return decision;
+    }
+
+    void ExpectDecision(uint32_t flags, int32_t amount, Decision_Trace_Reason reason, Combat_Multiplier_Source multiplierSource)
+    {
+        AutoBalanceCombatDecision decision = DecideDamageHealing(flags, amount);
+
+        SCOPED_TRACE(std::string("expected ") + getDecisionTraceReasonName(reason) + ", got " + getDecisionTraceReasonName(decision.reason));
+
+        EXPECT_EQ(decision.reason, reason);
+        EXPECT_EQ(decision.multiplierSource, multiplierSource);
+    }
+
+    uint32_t const ccScaled = AUTOBALANCE_CC_DURATION_GLOBAL_ENABLED | AUTOBALANCE_CC_DURATION_HAS_TARGET_AND_CASTER | AUTOBALANCE_CC_DURATION_JUST_CAST |
+                              AUTOBALANCE_CC_DURATION_TARGET_IS_PLAYER | AUTOBALANCE_CC_DURATION_IN_INSTANCE | AUTOBALANCE_CC_DURATION_IS_CROWD_CONTROL;
+
+    AutoBalanceCombatDecision DecideCCDuration(uint32_t flags, float multiplier)
+    {
+        AutoBalanceCombatDecision decision;
+        decision.flags      = flags;
+        decision.multiplier = multiplier;
+
+        decideCCDuration(decision);
+
+        return decision;
+    }
+}
+
+TEST(ABCombatDecision, PreFlightChecksLeaveTheAmountAlone)
+{
+    ExpectDecision(0, -100, AUTOBALANCE_TRACE_GLOBAL_DISABLED, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(AUTOBALANCE_DAMAGE_HEALING_GLOBAL_ENABLED, -100, AUTOBALANCE_TRACE_UNCHANGED, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(scaled & ~AUTOBALANCE_DAMAGE_HEALING_SOURCE_IN_WORLD, -100, AUTOBALANCE_TRACE_SOURCE_NOT_IN_WORLD, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(scaled | AUTOBALANCE_DAMAGE_HEALING_SPELL_NEVER_MODIFIED, -100, AUTOBALANCE_TRACE_SPELL_NEVER_MODIFIED, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(scaled & ~AUTOBALANCE_DAMAGE_HEALING_MAPS_ENABLED, -100, AUTOBALANCE_TRACE_MAP_NOT_ENABLED, AUTOBALANCE_MULTIPLIER_NONE);
+}
+
+TEST(ABCombatDecision, PlayersOnThemselves)
+{
+    ExpectDecision(playerSelf, 100, AUTOBALANCE_TRACE_PLAYER_SELF_HEAL, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(playerSelf, 0, AUTOBALANCE_TRACE_PLAYER_SELF_HEAL, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(playerSelf | AUTOBALANCE_DAMAGE_HEALING_SPELL_SPENDS_HEALTH, -100, AUTOBALANCE_TRACE_PLAYER_SPENDS_HEALTH, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(playerSelf, -100, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_SOURCE_MAP_SCALED_WORLD);
+    ExpectDecision(playerSelf | AUTOBALANCE_DAMAGE_HEALING_PERCENT_HEALTH_AURA, -100, AUTOBALANCE_TRACE_MAP_MULTIPLIER_UNSCALED, AUTOBALANCE_MULTIPLIER_SOURCE_MAP_WORLD);
+}
+
+TEST(ABCombatDecision, PlayersOnOthers)
+{
+    uint32_t const playerOnPlayer = scaled | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER;
+
+    // healing another player, or damaging an enemy, is left alone
+    ExpectDecision(playerOnPlayer, 100, AUTOBALANCE_TRACE_ENEMY_PLAYER, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(playerOnPlayer, -100, AUTOBALANCE_TRACE_ENEMY_PLAYER, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(scaled | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER, -100, AUTOBALANCE_TRACE_ENEMY_PLAYER, AUTOBALANCE_MULTIPLIER_NONE);
+
+    // damaging a friendly unit is scaled
+    ExpectDecision(playerOnPlayer | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_FRIENDLY, -100, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD);
+    ExpectDecision(scaled | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_FRIENDLY, -100, AUTOBALANCE_TRACE_CREATURE_MULTIPLIER, AUTOBALANCE_MULTIPLIER_SOURCE_SCALED_DAMAGE);
+    ExpectDecision(playerOnPlayer | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_FRIENDLY, 100, AUTOBALANCE_TRACE_ENEMY_PLAYER, AUTOBALANCE_MULTIPLIER_NONE);
+}
+
+TEST(ABCombatDecision, CreaturesAndPets)
+{
+    uint32_t const creatureSelf = scaled | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_CREATURE | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_TARGET;
+
+    ExpectDecision(creatureSelf | AUTOBALANCE_DAMAGE_HEALING_SHARED_DAMAGE_AURA, -100, AUTOBALANCE_TRACE_SHARED_DAMAGE_AURA, AUTOBALANCE_MULTIPLIER_NONE);
+    ExpectDecision(creatureSelf, -100, AUTOBALANCE_TRACE_CREATURE_MULTIPLIER, AUTOBALANCE_MULTIPLIER_SOURCE_SCALED_DAMAGE);
+    ExpectDecision(creatureOnPlayer | AUTOBALANCE_DAMAGE_HEALING_SOURCE_IS_PLAYER_PET, -100, AUTOBALANCE_TRACE_PLAYER_PET, AUTOBALANCE_MULTIPLIER_NONE);
+
+    // creatures damaging players use their own multiplier, healing players uses the map's
+    ExpectDecision(creatureOnPlayer, -100, AUTOBALANCE_TRACE_CREATURE_MULTIPLIER, AUTOBALANCE_MULTIPLIER_SOURCE_SCALED_DAMAGE);
+    ExpectDecision(creatureOnPlayer | AUTOBALANCE_DAMAGE_HEALING_PERCENT_HEALTH_AURA, -100, AUTOBALANCE_TRACE_CREATURE_MULTIPLIER_UNSCALED, AUTOBALANCE_MULTIPLIER_SOURCE_DAMAGE);
+    ExpectDecision(creatureOnPlayer, 100, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD);
+
+    // something that is neither a player nor a creature damaging a player uses the map's multiplier
+    ExpectDecision(scaled | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER, -100, AUTOBALANCE_TRACE_MAP_MULTIPLIER, AUTOBALANCE_MULTIPLIER_TARGET_MAP_SCALED_WORLD);
+    ExpectDecision(scaled | AUTOBALANCE_DAMAGE_HEALING_TARGET_IS_PLAYER | AUTOBALANCE_DAMAGE_HEALING_PERCENT_HEALTH_AURA, -100, AUTOBALANCE_TRACE_MAP_MULTIPLIER_UNSCALED, AUTOBALANCE_MULTIPLIER_TARGET_MAP_WORLD);
+}
+
+TEST(ABCombatDecision, AppliesTheMultiplierLikeTheHooks)
+{
+    AutoBalanceCombatDecision decision = DecideDamageHealing(creatureOnPlayer, -999);
+    decision.multiplier = 0.5f;
+
+    // the float product is truncated towards zero
+    EXPECT_EQ(applyDamageHealingDecision(decision, -999), -499);
+    EXPECT_EQ(applyDamageHealingDecision(decision, 999), 499);
+
+    // the multiplier is ignored when the decision doesn't use one
+    decision = DecideDamageHealing(playerSelf, 100);
+    decision.multiplier = 0.5f;
+
+    EXPECT_EQ(applyDamageHealingDecision(decision, 100), 100);
+}
+
+TEST(ABCombatDecision, CCDurations)
+{
+    AutoBalanceCombatDecision decision = DecideCCDuration(ccScaled, 0.5f);
+
+    EXPECT_EQ(decision.reason, AUTOBALANCE_TRACE_CC_DURATION);
+    EXPECT_EQ(decision.multiplierSource, AUTOBALANCE_MULTIPLIER_CASTER_CC_DURATION);
+    EXPECT_EQ(applyCCDurationDecision(decision, 8000), 4000);
+
+    // every required flag, and every excluded one
+    for (uint32_t flag = 1; flag <= AUTOBALANCE_CC_DURATION_IS_CROWD_CONTROL; flag <<= 1)
+    {
+        uint32_t flags = ccScaled ^ flag;
+        decision = DecideCCDuration(flags, 0.5f);
+
+        SCOPED_TRACE("flags " + std::to_string(flags));
+
+        EXPECT_EQ(decision.reason, AUTOBALANCE_TRACE_UNCHANGED);
+        EXPECT_EQ(applyCCDurationDecision(decision, 8000), 8000);
+    }
+
+    // a multiplier of 1 isn't a CC duration decision
+    decision = DecideCCDuration(ccScaled, 1.0f);
+    EXPECT_EQ(decision.reason, AUTOBALANCE_TRACE_UNCHANGED);
+}
+
+TEST(ABCombatDecision, EveryReasonAndMultiplierSourceHasAName)
+{
+    for (uint8_t reason = 0; reason < AUTOBALANCE_TRACE_REASON_COUNT; ++reason)
+        EXPECT_STRNE(getDecisionTraceReasonName(reason), "unknown");
+
+    for (uint8_t source = 0; source < AUTOBALANCE_MULTIPLIER_SOURCE_COUNT; ++source)
+        EXPECT_STRNE(getCombatMultiplierSourceName(source), "unknown");
+
+    EXPECT_STREQ(getDecisionTraceReasonName(AUTOBALANCE_TRACE_REASON_COUNT), "unknown");
+}
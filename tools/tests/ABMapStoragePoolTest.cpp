@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABMapStoragePool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//
+// Counts the test binary's operator new calls while a test has counting turned on
+//
+
+namespace
+{
+    std::atomic<bool>        countAllocations { false };
+    std::atomic<std::size_t> allocationCount  { 0 };
+}
+
+void* operator new(std::size_t size)
+{
+    if (countAllocations.load(std::memory_order_relaxed))
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace
+{
+    uint32_t const    DungeonId     = 36;
+    uint32_t const    OtherId       = 43;
+    uint32_t const    MaxPlayers    = 5;
+    std::size_t const CreatureCount = 400;
+
+    // what an instance of the dungeon grows to while it is loaded
+    void FillStorage(AutoBalanceMapStorage& storage)
+    {
+        for (std::size_t i = 1; i <= CreatureCount; ++i)
+        {
+            Creature* creature = reinterpret_cast<Creature*>(i * 16);
+
+            storage.allMapCreatures.push_back(creature);
+            storage.allScalableCreatures.push_back(creature);
+            storage.creatureUpdateQueue.push_back(creature);
+        }
+
+        for (std::size_t i = 1; i <= MaxPlayers; ++i)
+        {
+            Player* player = reinterpret_cast<Player*>(i * 32);
+
+            storage.allMapPlayers.push_back(player);
+            storage.allMapPlayerLevels[player] = 80;
+        }
+
+        storage.creatureBatch.Resize(CreatureCount);
+    }
+
+    // one instance of the map being created, played through and unloaded
+    void RunInstance(AutoBalanceMapStoragePool& pool, uint32_t mapId)
+    {
+        AutoBalanceMapStorage storage;
+        pool.Acquire(mapId, MaxPlayers, storage);
+        FillStorage(storage);
+        pool.Release(mapId, storage);
+    }
+
+    std::size_t CountAllocations(void (*work)(AutoBalanceMapStoragePool&), AutoBalanceMapStoragePool& pool)
+    {
+        allocationCount = 0;
+        countAllocations = true;
+        work(pool);
+        countAllocations = false;
+        return allocationCount;
+    }
+}
+
+TEST(MapStoragePool, ReusedInstancesOnlyAllocateTheLevelMapNodes)
+{
+    AutoBalanceMapStoragePool pool;
+
+    // the first instance of the map allocates everything
+    std::size_t coldAllocations = CountAllocations([](AutoBalanceMapStoragePool& pool) { RunInstance(pool, DungeonId); }, pool);
+
+    // every later instance of it takes the same storage back; only the player level map allocates, one node per player
+    std::size_t reusedAllocations = CountAllocations([](AutoBalanceMapStoragePool& pool)
+    {
+        for (int cycle = 0; cycle < 100; ++cycle)
+            RunInstance(pool, DungeonId);
+    }, pool);
+
+    EXPECT_GT(coldAllocations, MaxPlayers);
+    EXPECT_LE(reusedAllocations, 100 * MaxPlayers);
+
+    AutoBalanceMapInfoPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.cold, 1u);
+    EXPECT_EQ(stats.reused, 100u);
+    EXPECT_EQ(stats.released, 101u);
+    EXPECT_EQ(stats.dropped, 0u);
+}
+
+TEST(MapStoragePool, AcquireAndReleaseDontAllocate)
+{
+    AutoBalanceMapStoragePool pool;
+    RunInstance(pool, DungeonId);
+
+    // without the level map's nodes, a reused cycle doesn't allocate at all
+    std::size_t allocations = CountAllocations([](AutoBalanceMapStoragePool& pool)
+    {
+        for (int cycle = 0; cycle < 100; ++cycle)
+        {
+            AutoBalanceMapStorage storage;
+            pool.Acquire(DungeonId, MaxPlayers, storage);
+
+            for (std::size_t i = 1; i <= CreatureCount; ++i)
+                storage.allMapCreatures.push_back(reinterpret_cast<Creature*>(i * 16));
+            storage.creatureBatch.Resize(CreatureCount);
+
+            pool.Release(DungeonId, storage);
+        }
+    }, pool);
+
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST(MapStoragePool, SizesNewStorageFromEarlierInstances)
+{
+    AutoBalanceMapStoragePool pool;
+
+    AutoBalanceMapStorage first;
+    EXPECT_FALSE(pool.Acquire(DungeonId, MaxPlayers, first));
+    EXPECT_GE(first.allMapPlayers.capacity(), MaxPlayers);
+    FillStorage(first);
+    pool.Release(DungeonId, first);
+
+    // two instances open at once: one takes the released storage, the other is sized from it
+    AutoBalanceMapStorage second;
+    AutoBalanceMapStorage third;
+    EXPECT_TRUE(pool.Acquire(DungeonId, MaxPlayers, second));
+    EXPECT_FALSE(pool.Acquire(DungeonId, MaxPlayers, third));
+
+    EXPECT_GE(second.allMapCreatures.capacity(), CreatureCount);
+    EXPECT_TRUE(second.allMapCreatures.empty());
+    EXPECT_TRUE(second.allMapPlayerLevels.empty());
+    EXPECT_EQ(second.creatureBatch.Size(), 0u);
+    EXPECT_GE(third.allMapCreatures.capacity(), CreatureCount);
+    EXPECT_GE(third.creatureUpdateQueue.capacity(), CreatureCount);
+
+    // another map has nothing to go by
+    AutoBalanceMapStorage other;
+    EXPECT_FALSE(pool.Acquire(OtherId, MaxPlayers, other));
+    EXPECT_EQ(other.allMapCreatures.capacity(), 0u);
+
+    AutoBalanceMapInfoPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.reused, 1u);
+    EXPECT_EQ(stats.reserved, 1u);
+    EXPECT_EQ(stats.cold, 2u);
+}
+
+TEST(MapStoragePool, KeepsAtMostThePoolSizePerMap)
+{
+    AutoBalanceMapStoragePool pool;
+    AutoBalanceMapStorage storage[AUTOBALANCE_MAP_INFO_POOL_SIZE + 2];
+
+    for (AutoBalanceMapStorage& instance : storage)
+    {
+        pool.Acquire(DungeonId, MaxPlayers, instance);
+        FillStorage(instance);
+    }
+
+    for (AutoBalanceMapStorage& instance : storage)
+        pool.Release(DungeonId, instance);
+
+    // the kept storage was handed over, the rest stays with the caller to be freed
+    EXPECT_EQ(storage[0].allMapCreatures.capacity(), 0u);
+    EXPECT_GE(storage[AUTOBALANCE_MAP_INFO_POOL_SIZE].allMapCreatures.capacity(), CreatureCount);
+
+    AutoBalanceMapInfoPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.released, (uint64_t)AUTOBALANCE_MAP_INFO_POOL_SIZE);
+    EXPECT_EQ(stats.dropped, 2u);
+}
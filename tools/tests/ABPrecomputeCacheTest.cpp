@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABPrecomputeCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    uint32_t const DungeonKey = 36;                   // MAKE_PAIR32(36, 0)
+    uint32_t const RaidKey    = 533 | (1 << 16);      // MAKE_PAIR32(533, 1)
+    uint64_t const KeyHash    = 0x1234567890abcdefULL;
+
+    AutoBalanceProfileSpawn MakeSpawn(uint32_t key, uint32_t entry, uint8_t level, bool isBoss = false)
+    {
+        AutoBalanceProfileSpawn spawn;
+        spawn.key    = key;
+        spawn.entry  = entry;
+        spawn.level  = level;
+        spawn.isBoss = isBoss;
+        return spawn;
+    }
+
+    AutoBalanceScalingMap MakeMap(uint32_t maxPlayers, bool isHeroic = false)
+    {
+        AutoBalanceScalingMap map;
+        map.maxPlayers = maxPlayers;
+        map.isHeroic   = isHeroic;
+        return map;
+    }
+
+    std::vector<uint8_t> BuildCache(AutoBalanceScalingSettings const& settings, uint64_t keyHash = KeyHash)
+    {
+        AutoBalancePrecomputeCacheBuilder builder;
+
+        builder.AddLevelProfileSpawn(MakeSpawn(DungeonKey, 100, 20));
+        builder.AddLevelProfileSpawn(MakeSpawn(DungeonKey, 101, 18));
+        builder.AddLevelProfileSpawn(MakeSpawn(DungeonKey, 101, 18));
+        builder.AddLevelProfileSpawn(MakeSpawn(DungeonKey, 200, 21, true));
+        builder.AddLevelProfileSpawn(MakeSpawn(DungeonKey, 200, 21, true)); // the same boss spawned twice is counted once
+        builder.AddLevelProfileSpawn(MakeSpawn(RaidKey, 300, 83, true));
+
+        builder.AddMultiplierTable(DungeonKey, settings, MakeMap(5));
+        builder.AddMultiplierTable(RaidKey, settings, MakeMap(25, true));
+
+        AutoBalanceCachedBaseValues baseValues;
+        baseValues.health = 8000.0f;
+        baseValues.damage = 350.5f;
+        builder.SetBaseValues(AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_WARRIOR, 80, baseValues);
+
+        return builder.Build(keyHash);
+    }
+
+    std::string WriteCache(std::vector<uint8_t> const& data, char const* name)
+    {
+        std::string fileName = std::string(testing::TempDir()) + name;
+        std::string error;
+        EXPECT_TRUE(writePrecomputeCache(fileName, data, error)) << error;
+        return fileName;
+    }
+
+    std::vector<uint8_t> ReadFile(std::string const& fileName)
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
+
+TEST(PrecomputeCache, LevelProfilesAreSortedHistograms)
+{
+    AutoBalanceScalingSettings settings;
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    ASSERT_TRUE(cache.Load(BuildCache(settings), KeyHash, error)) << error;
+
+    AutoBalanceCachedLevelProfile const* profile = cache.FindLevelProfile(DungeonKey);
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->creatureCount, 5u);
+    EXPECT_EQ(profile->bossCount, 1u);
+    ASSERT_EQ(profile->bucketCount, 3u);
+
+    AutoBalanceCachedLevelBucket const* buckets = cache.GetLevelBuckets(*profile);
+    EXPECT_EQ(buckets[0].level, 18u);
+    EXPECT_EQ(buckets[0].count, 2u);
+    EXPECT_EQ(buckets[1].level, 20u);
+    EXPECT_EQ(buckets[1].count, 1u);
+    EXPECT_EQ(buckets[2].level, 21u);
+    EXPECT_EQ(buckets[2].count, 2u);
+
+    EXPECT_NE(cache.FindLevelProfile(RaidKey), nullptr);
+    EXPECT_EQ(cache.FindLevelProfile(37), nullptr);
+    EXPECT_EQ(cache.GetLevelProfileCount(), 2u);
+}
+
+TEST(PrecomputeCache, MultiplierTablesMatchTheCore)
+{
+    AutoBalanceScalingSettings settings;
+    settings.statModifiers[AUTOBALANCE_TIER_HEROIC_RAID_25M][true].damage = 0.75f;
+
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    ASSERT_TRUE(cache.Load(BuildCache(settings), KeyHash, error)) << error;
+
+    for (uint32_t playerCount = 1; playerCount <= 25; ++playerCount)
+    {
+        for (bool isBoss : { false, true })
+        {
+            StatMultiplierDisplay expected = calculateDisplayMultipliers(settings, MakeMap(25, true), isBoss, (float)playerCount);
+            StatMultiplierDisplay const* cached = cache.FindDisplayMultipliers(RaidKey, playerCount, isBoss);
+
+            ASSERT_NE(cached, nullptr);
+            EXPECT_EQ(cached->healthPercent, expected.healthPercent);
+            EXPECT_EQ(cached->damagePercent, expected.damagePercent);
+        }
+    }
+
+    // outside of the table, the caller calculates instead
+    EXPECT_EQ(cache.FindDisplayMultipliers(RaidKey, 0, false), nullptr);
+    EXPECT_EQ(cache.FindDisplayMultipliers(DungeonKey, 6, false), nullptr);
+    EXPECT_EQ(cache.FindDisplayMultipliers(37, 1, false), nullptr);
+}
+
+TEST(PrecomputeCache, BaseValues)
+{
+    AutoBalanceScalingSettings settings;
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    ASSERT_TRUE(cache.Load(BuildCache(settings), KeyHash, error)) << error;
+
+    AutoBalanceCachedBaseValues const* baseValues = cache.GetBaseValues(AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_WARRIOR, 80);
+    ASSERT_NE(baseValues, nullptr);
+    EXPECT_EQ(baseValues->health, 8000.0f);
+    EXPECT_EQ(baseValues->damage, 350.5f);
+
+    EXPECT_EQ(cache.GetBaseValues(AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_MAGE, 80)->health, 0.0f);
+    EXPECT_EQ(cache.GetBaseValues(AUTOBALANCE_PRECOMPUTE_CACHE_CLASS_COUNT, 80), nullptr);
+}
+
+TEST(PrecomputeCache, MapsWhatWasWritten)
+{
+    AutoBalanceScalingSettings settings;
+    std::vector<uint8_t> data = BuildCache(settings);
+    std::string fileName = WriteCache(data, "ab_precompute_roundtrip.bin");
+
+    EXPECT_EQ(ReadFile(fileName), data);
+
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    ASSERT_TRUE(cache.Map(fileName, KeyHash, error)) << error;
+    EXPECT_TRUE(cache.IsMapped());
+    EXPECT_EQ(cache.GetSize(), data.size());
+    EXPECT_EQ(cache.GetMultiplierTableCount(), 2u);
+    EXPECT_EQ(cache.FindLevelProfile(DungeonKey)->creatureCount, 5u);
+
+    cache.Close();
+    EXPECT_FALSE(cache.IsLoaded());
+    EXPECT_EQ(cache.FindLevelProfile(DungeonKey), nullptr);
+
+    std::remove(fileName.c_str());
+}
+
+TEST(PrecomputeCache, RejectsADifferentKey)
+{
+    AutoBalanceScalingSettings settings;
+    std::string fileName = WriteCache(BuildCache(settings), "ab_precompute_key.bin");
+
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    EXPECT_FALSE(cache.Map(fileName, KeyHash + 1, error));
+    EXPECT_NE(error.find("different config"), std::string::npos) << error;
+    EXPECT_FALSE(cache.IsLoaded());
+
+    std::remove(fileName.c_str());
+}
+
+TEST(PrecomputeCache, RejectsACorruptedPayload)
+{
+    AutoBalanceScalingSettings settings;
+    std::vector<uint8_t> data = BuildCache(settings);
+    data[sizeof(AutoBalancePrecomputeCacheHeader) + 4] ^= 0x01;
+    std::string fileName = WriteCache(data, "ab_precompute_checksum.bin");
+
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    EXPECT_FALSE(cache.Map(fileName, KeyHash, error));
+    EXPECT_NE(error.find("checksum"), std::string::npos) << error;
+
+    std::remove(fileName.c_str());
+}
+
+TEST(PrecomputeCache, RejectsAnotherVersion)
+{
+    AutoBalanceScalingSettings settings;
+    std::vector<uint8_t> data = BuildCache(settings);
+    reinterpret_cast<AutoBalancePrecomputeCacheHeader*>(data.data())->version = AUTOBALANCE_PRECOMPUTE_CACHE_VERSION + 1;
+
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    EXPECT_FALSE(cache.Load(data, KeyHash, error));
+    EXPECT_NE(error.find("version"), std::string::npos) << error;
+}
+
+TEST(PrecomputeCache, RejectsATruncatedFile)
+{
+    AutoBalanceScalingSettings settings;
+    std::vector<uint8_t> data = BuildCache(settings);
+    data.resize(data.size() - 8);
+    std::string fileName = WriteCache(data, "ab_precompute_truncated.bin");
+
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    EXPECT_FALSE(cache.Map(fileName, KeyHash, error));
+    EXPECT_NE(error.find("truncated"), std::string::npos) << error;
+
+    data.resize(16);
+    EXPECT_FALSE(cache.Load(data, KeyHash, error));
+    EXPECT_NE(error.find("too small"), std::string::npos) << error;
+
+    std::remove(fileName.c_str());
+}
+
+TEST(PrecomputeCache, ReportsAMissingFile)
+{
+    AutoBalancePrecomputeCache cache;
+    std::string error;
+    EXPECT_FALSE(cache.Map(std::string(testing::TempDir()) + "ab_precompute_missing.bin", KeyHash, error));
+    EXPECT_NE(error.find("doesn't exist"), std::string::npos) << error;
+}
+
+TEST(PrecomputeCache, HasherSeparatesStrings)
+{
+    AutoBalanceCacheHasher first;
+    first.Add(std::string("AutoBalance.Enable.Global"));
+    first.Add(std::string("1"));
+
+    AutoBalanceCacheHasher second;
+    second.Add(std::string("AutoBalance.Enable.Global1"));
+    second.Add(std::string(""));
+
+    EXPECT_NE(first.GetHash(), second.GetHash());
+    EXPECT_NE(first.GetHash(), AutoBalanceCacheHasher().GetHash());
+}
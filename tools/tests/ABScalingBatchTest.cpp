@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingBatch.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+
+namespace
+{
+    // Random creatures that also hit the edge cases: the minimum caps, creatures without mana, unchanged CC durations and no level scaling
+    void FillBatch(AutoBalanceCreatureBatch& batch, std::vector<CreatureCurveMultipliers>& curves, std::vector<AutoBalanceScalingCreature>& creatures, std::size_t count, uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> curve(0.0f, 1.2f);
+        std::uniform_real_distribution<float> modifier(0.0f, 2.0f);
+        std::uniform_real_distribution<float> ratio(0.2f, 5.0f);
+        std::uniform_real_distribution<float> base(1.0f, 500000.0f);
+        std::uniform_int_distribution<int> edgeCase(0, 5);
+
+        batch.Resize(count);
+        curves.clear();
+        creatures.clear();
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            CreatureCurveMultipliers curveMultipliers = { curve(random), curve(random), curve(random), curve(random) };
+
+            AutoBalanceScalingCreature creature;
+            creature.defaultMultiplier = curveMultipliers.health;
+            creature.statModifiers     = AutoBalanceStatModifiers(modifier(random), modifier(random), modifier(random), modifier(random), modifier(random), modifier(random));
+            creature.baseHealth        = std::floor(base(random));
+            creature.baseMana          = std::floor(base(random));
+            creature.baseArmor         = std::floor(base(random) / 10.0f);
+
+            switch (edgeCase(random))
+            {
+                case 0: creature.statModifiers.health = 0.0f; creature.statModifiers.damage = 0.0f; creature.statModifiers.mana = 0.0f; break;
+                case 1: creature.baseMana = 0.0f; break;
+                case 2: creature.statModifiers.ccduration = -1.0f; break;
+                case 3: break; // not level scaled
+                default:
+                    creature.healthLevelRatio = ratio(random);
+                    creature.manaLevelRatio   = ratio(random);
+                    creature.armorLevelRatio  = ratio(random);
+                    creature.damageLevelRatio = ratio(random);
+                    break;
+            }
+
+            curves.push_back(curveMultipliers);
+            creatures.push_back(creature);
+            batch.Set(i, curveMultipliers, creature);
+        }
+    }
+
+    bool SameFloat(float a, float b)
+    {
+        return std::memcmp(&a, &b, sizeof(float)) == 0;
+    }
+
+    void ExpectSameAsScalar(AutoBalanceScalingSettings const& settings, std::size_t count, uint32_t seed)
+    {
+        AutoBalanceCreatureBatch batch;
+        std::vector<CreatureCurveMultipliers> curves;
+        std::vector<AutoBalanceScalingCreature> creatures;
+
+        FillBatch(batch, curves, creatures, count, seed);
+        calculateCreatureMultipliersBatch(settings, batch);
+
+        ASSERT_EQ(batch.health.size(), count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            AutoBalanceCreatureMultipliers expected = calculateCreatureMultipliers(settings, curves[i], creatures[i]);
+            AutoBalanceCreatureMultipliers actual   = batch.Get(i);
+
+            SCOPED_TRACE("creature " + std::to_string(i) + " of " + std::to_string(count));
+
+            EXPECT_EQ(actual.health, expected.health);
+            EXPECT_EQ(actual.mana, expected.mana);
+            EXPECT_EQ(actual.armor, expected.armor);
+            EXPECT_TRUE(SameFloat(actual.healthMultiplier, expected.healthMultiplier));
+            EXPECT_TRUE(SameFloat(actual.scaledHealthMultiplier, expected.scaledHealthMultiplier));
+            EXPECT_TRUE(SameFloat(actual.manaMultiplier, expected.manaMultiplier));
+            EXPECT_TRUE(SameFloat(actual.scaledManaMultiplier, expected.scaledManaMultiplier));
+            EXPECT_TRUE(SameFloat(actual.armorMultiplier, expected.armorMultiplier));
+            EXPECT_TRUE(SameFloat(actual.scaledArmorMultiplier, expected.scaledArmorMultiplier));
+            EXPECT_TRUE(SameFloat(actual.damageMultiplier, expected.damageMultiplier));
+            EXPECT_TRUE(SameFloat(actual.scaledDamageMultiplier, expected.scaledDamageMultiplier));
+            EXPECT_TRUE(SameFloat(actual.ccDurationMultiplier, expected.ccDurationMultiplier));
+            EXPECT_TRUE(SameFloat(actual.xpModifier, expected.xpModifier));
+            EXPECT_TRUE(SameFloat(actual.moneyModifier, expected.moneyModifier));
+        }
+    }
+}
+
+TEST(ABScalingBatch, KernelIsTheExpectedOne)
+{
+#ifdef AB_EXPECTED_BATCH_KERNEL
+    EXPECT_STREQ(getCreatureBatchKernelName(), AB_EXPECTED_BATCH_KERNEL);
+#else
+    SUCCEED() << "kernel: " << getCreatureBatchKernelName();
+#endif
+}
+
+TEST(ABScalingBatch, MatchesTheScalarPathForEveryBatchSize)
+{
+    AutoBalanceScalingSettings settings;
+
+    // every remainder of the vector width, and a full map
+    for (std::size_t count = 0; count <= 19; ++count)
+        ExpectSameAsScalar(settings, count, 1000 + count);
+
+    ExpectSameAsScalar(settings, 2000, 42);
+}
+
+TEST(ABScalingBatch, MatchesTheScalarPathForEveryRewardSetting)
+{
+    AutoBalanceScalingSettings settings;
+    settings.rewardScalingXPModifier    = 1.5f;
+    settings.rewardScalingMoneyModifier = 0.75f;
+    settings.minCCDurationModifier      = 0.4f;
+    settings.maxCCDurationModifier      = 0.9f;
+
+    for (ScalingMethod method : { AUTOBALANCE_SCALING_FIXED, AUTOBALANCE_SCALING_DYNAMIC })
+    {
+        for (bool rewardScaling : { false, true })
+        {
+            settings.rewardScalingMethod = method;
+            settings.rewardScalingXP     = rewardScaling;
+            settings.rewardScalingMoney  = !rewardScaling;
+
+            ExpectSameAsScalar(settings, 37, 7);
+        }
+    }
+}
+
+TEST(ABScalingBatch, MatchesTheScalarPathWithHighMinimums)
+{
+    AutoBalanceScalingSettings settings;
+    settings.minHPModifier     = 0.9f;
+    settings.minManaModifier   = 0.9f;
+    settings.minDamageModifier = 0.9f;
+
+    ExpectSameAsScalar(settings, 64, 99);
+}
+
+TEST(ABScalingBatch, RoundsLikeTheScalarPath)
+{
+    AutoBalanceScalingSettings settings;
+    std::vector<float> values = { 0.0f, 0.5f, 1.5f, 2.5f, 0.49999997f, 1.4999999f, 8388607.5f, 8388609.0f, 16777216.0f, 2147483520.0f, 2147483648.0f, 3000000000.0f, 4294967040.0f };
+
+    AutoBalanceCreatureBatch batch;
+    batch.Resize(values.size());
+
+    std::vector<AutoBalanceScalingCreature> creatures;
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        AutoBalanceScalingCreature creature;
+        creature.baseHealth = values[i];
+        creature.baseMana   = values[i];
+        creature.baseArmor  = values[i];
+
+        creatures.push_back(creature);
+        batch.Set(i, { 1.0f, 1.0f, 1.0f, 1.0f }, creature);
+    }
+
+    calculateCreatureMultipliersBatch(settings, batch);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        AutoBalanceCreatureMultipliers expected = calculateCreatureMultipliers(settings, { 1.0f, 1.0f, 1.0f, 1.0f }, creatures[i]);
+
+        SCOPED_TRACE("value " + std::to_string(values[i]));
+
+        EXPECT_EQ(batch.health[i], expected.health);
+        EXPECT_EQ(batch.mana[i], expected.mana);
+        EXPECT_EQ(batch.armor[i], expected.armor);
+    }
+}
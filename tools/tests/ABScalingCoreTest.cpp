@@ -0,0 +1,362 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingCore.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    AutoBalanceScalingMap MakeMap(uint32_t maxPlayers, bool isHeroic = false)
+    {
+        AutoBalanceScalingMap map;
+        map.maxPlayers = maxPlayers;
+        map.isHeroic   = isHeroic;
+        return map;
+    }
+}
+
+//
+// Curves
+//
+
+TEST(ABScalingCore, TanCurveReachesTheCeilingAtMaxPlayers)
+{
+    AutoBalanceInflectionPointSettings settings(2.5f, 0.0f, 1.0f);
+
+    EXPECT_NEAR(calculateCurveMultiplier(5.0f, 5, settings, AUTOBALANCE_FORMULA_TAN), 1.0f, 1e-5f);
+
+    settings.curveCeiling = 0.8f;
+    EXPECT_NEAR(calculateCurveMultiplier(5.0f, 5, settings, AUTOBALANCE_FORMULA_TAN), 0.8f, 1e-5f);
+}
+
+TEST(ABScalingCore, CurvesGrowWithThePlayerCount)
+{
+    AutoBalanceInflectionPointSettings settings(12.5f, 0.1f, 1.0f);
+
+    for (FormulaType formulaType : { AUTOBALANCE_FORMULA_TAN, AUTOBALANCE_FORMULA_LOG, AUTOBALANCE_FORMULA_EXP, AUTOBALANCE_FORMULA_POL })
+    {
+        float previous = calculateCurveMultiplier(1.0f, 25, settings, formulaType);
+
+        for (uint32_t playerCount = 2; playerCount <= 25; ++playerCount)
+        {
+            float current = calculateCurveMultiplier((float)playerCount, 25, settings, formulaType);
+            EXPECT_GE(current, previous) << "formula " << formulaType << " at " << playerCount << " players";
+            previous = current;
+        }
+    }
+}
+
+TEST(ABScalingCore, CurveFloorIsTheMinimum)
+{
+    AutoBalanceInflectionPointSettings settings(20.0f, 0.3f, 1.0f);
+
+    for (FormulaType formulaType : { AUTOBALANCE_FORMULA_LOG, AUTOBALANCE_FORMULA_EXP, AUTOBALANCE_FORMULA_POL })
+        EXPECT_GE(calculateCurveMultiplier(1.0f, 40, settings, formulaType), 0.3f - 1e-5f) << "formula " << formulaType;
+}
+
+TEST(ABScalingCore, CCDurationIsClampedAndMinusOneIsUnchanged)
+{
+    EXPECT_FLOAT_EQ(calculateCCDurationMultiplier(0.5f, -1.0f, 0.25f, 1.0f), 1.0f);
+    EXPECT_FLOAT_EQ(calculateCCDurationMultiplier(0.5f,  1.0f, 0.25f, 1.0f), 0.5f);
+    EXPECT_FLOAT_EQ(calculateCCDurationMultiplier(0.1f,  1.0f, 0.25f, 1.0f), 0.25f);
+    EXPECT_FLOAT_EQ(calculateCCDurationMultiplier(0.8f,  2.0f, 0.25f, 1.0f), 1.0f);
+}
+
+TEST(ABScalingCore, BaseExpansionValueBlendsBetweenExpansions)
+{
+    float baseValues[3] = { 100.0f, 200.0f, 300.0f };
+
+    EXPECT_FLOAT_EQ(getBaseExpansionValueForLevel(baseValues, 60), 100.0f);
+    EXPECT_NEAR(getBaseExpansionValueForLevel(baseValues, 61), 133.333f, 1e-2f);
+    EXPECT_FLOAT_EQ(getBaseExpansionValueForLevel(baseValues, 70), 200.0f);
+    EXPECT_NEAR(getBaseExpansionValueForLevel(baseValues, 72), 266.667f, 1e-2f);
+    EXPECT_FLOAT_EQ(getBaseExpansionValueForLevel(baseValues, 80), 300.0f);
+
+    uint32_t intBaseValues[3] = { 100, 200, 300 };
+    EXPECT_EQ(getBaseExpansionValueForLevel(intBaseValues, 70), 200u);
+}
+
+//
+// Tier and inflection point selection
+//
+
+TEST(ABScalingCore, ScalingTierFollowsSizeAndDifficulty)
+{
+    EXPECT_EQ(getScalingTier(false, 5),  AUTOBALANCE_TIER_DUNGEON);
+    EXPECT_EQ(getScalingTier(false, 10), AUTOBALANCE_TIER_RAID_10M);
+    EXPECT_EQ(getScalingTier(false, 15), AUTOBALANCE_TIER_RAID_15M);
+    EXPECT_EQ(getScalingTier(false, 20), AUTOBALANCE_TIER_RAID_20M);
+    EXPECT_EQ(getScalingTier(false, 25), AUTOBALANCE_TIER_RAID_25M);
+    EXPECT_EQ(getScalingTier(false, 40), AUTOBALANCE_TIER_RAID_40M);
+    EXPECT_EQ(getScalingTier(false, 41), AUTOBALANCE_TIER_RAID);
+    EXPECT_EQ(getScalingTier(true,  5),  AUTOBALANCE_TIER_HEROIC_DUNGEON);
+    EXPECT_EQ(getScalingTier(true,  10), AUTOBALANCE_TIER_HEROIC_RAID_10M);
+    EXPECT_EQ(getScalingTier(true,  25), AUTOBALANCE_TIER_HEROIC_RAID_25M);
+    EXPECT_EQ(getScalingTier(true,  26), AUTOBALANCE_TIER_HEROIC_RAID);
+
+    EXPECT_STREQ(getScalingTierName(AUTOBALANCE_TIER_RAID_25M), "25 Player Normal");
+}
+
+TEST(ABScalingCore, InflectionPointUsesTheStatSpecificValueFirst)
+{
+    AutoBalanceScalingSettings settings;
+    settings.inflectionPoints[AUTOBALANCE_TIER_RAID_10M].inflectionPoint                               = 0.5f;
+    settings.inflectionPoints[AUTOBALANCE_TIER_RAID_10M].statInflectionPoint[AUTOBALANCE_STAT_DAMAGE] = 0.8f;
+
+    AutoBalanceScalingMap map = MakeMap(10);
+
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, false, AUTOBALANCE_STAT_HEALTH).value, 5.0f);
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, false, AUTOBALANCE_STAT_DAMAGE).value, 8.0f);
+}
+
+TEST(ABScalingCore, DungeonOverrideReplacesOnlyTheValuesItSets)
+{
+    AutoBalanceScalingSettings settings;
+    settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON].curveFloor   = 0.2f;
+    settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON].curveCeiling = 0.9f;
+
+    AutoBalanceInflectionPointSettings dungeonOverride(0.3f, -1.0f, 1.1f);
+
+    AutoBalanceScalingMap map = MakeMap(5);
+    map.dungeonOverride = &dungeonOverride;
+
+    AutoBalanceInflectionPointSettings selected = selectInflectionPointSettings(settings, map, false, AUTOBALANCE_STAT_HEALTH);
+    EXPECT_FLOAT_EQ(selected.value, 1.5f);
+    EXPECT_FLOAT_EQ(selected.curveFloor, 0.2f);
+    EXPECT_FLOAT_EQ(selected.curveCeiling, 1.1f);
+}
+
+TEST(ABScalingCore, BossInflectionPrecedence)
+{
+    AutoBalanceScalingSettings settings;
+    AutoBalanceInflectionPointTier& tier = settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON];
+    tier.inflectionPoint = 0.5f;
+    tier.bossModifier    = 2.0f;
+
+    AutoBalanceScalingMap map = MakeMap(5);
+
+    // the boss modifier multiplies the tier's inflection point
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, true, AUTOBALANCE_STAT_HEALTH).value, 5.0f);
+
+    // the boss inflection point replaces it
+    tier.bossInflectionPoint = 0.9f;
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, true, AUTOBALANCE_STAT_HEALTH).value, 4.5f);
+
+    // the boss stat-specific inflection point wins over the boss inflection point
+    tier.bossStatInflectionPoint[AUTOBALANCE_STAT_HEALTH] = 0.7f;
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, true, AUTOBALANCE_STAT_HEALTH).value, 3.5f);
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, true, AUTOBALANCE_STAT_MANA).value, 4.5f);
+
+    // the map's boss override wins over all of them
+    AutoBalanceInflectionPointSettings bossOverride(1.5f, -1.0f, -1.0f);
+    map.bossOverride = &bossOverride;
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, true, AUTOBALANCE_STAT_HEALTH).value, 3.75f);
+
+    // and none of this applies to normal creatures
+    EXPECT_FLOAT_EQ(selectInflectionPointSettings(settings, map, false, AUTOBALANCE_STAT_HEALTH).value, 2.5f);
+}
+
+//
+// Stat modifiers
+//
+
+TEST(ABScalingCore, StatModifierOverridePrecedence)
+{
+    AutoBalanceScalingSettings settings;
+    settings.statModifiers[AUTOBALANCE_TIER_RAID_25M][false] = AutoBalanceStatModifiers(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, -1.0f);
+    settings.statModifiers[AUTOBALANCE_TIER_RAID_25M][true]  = AutoBalanceStatModifiers(1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 0.5f);
+
+    AutoBalanceStatModifiers mapOverride(-1.0f, 0.2f, -1.0f, -1.0f, -1.0f, -1.0f);
+    AutoBalanceStatModifiers bossOverride(-1.0f, -1.0f, 0.3f, -1.0f, -1.0f, -1.0f);
+    AutoBalanceStatModifiers creatureOverride(-1.0f, -1.0f, -1.0f, -1.0f, 0.4f, -1.0f);
+
+    AutoBalanceScalingMap map = MakeMap(25);
+
+    EXPECT_FLOAT_EQ(selectStatModifiers(settings, map, false).health, 2.0f);
+    EXPECT_FLOAT_EQ(selectStatModifiers(settings, map, true).health, 2.5f);
+
+    map.statModifierOverride = &mapOverride;
+    EXPECT_FLOAT_EQ(selectStatModifiers(settings, map, false).health, 0.2f);
+
+    // bosses use the normal per-instance override when there is no boss override
+    EXPECT_FLOAT_EQ(selectStatModifiers(settings, map, true).health, 0.2f);
+
+    // and only the boss override when there is one
+    map.statModifierBossOverride = &bossOverride;
+    AutoBalanceStatModifiers boss = selectStatModifiers(settings, map, true, &creatureOverride);
+    EXPECT_FLOAT_EQ(boss.health, 2.5f);
+    EXPECT_FLOAT_EQ(boss.mana, 0.3f);
+    EXPECT_FLOAT_EQ(boss.damage, 0.4f);
+    EXPECT_FLOAT_EQ(boss.ccduration, 0.5f);
+}
+
+TEST(ABScalingCore, DisplayMultipliersIgnoreThePerInstanceStatModifiers)
+{
+    AutoBalanceScalingSettings settings;
+    settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON].curveFloor   = 0.0f;
+    settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON].curveCeiling = 1.0f;
+
+    AutoBalanceStatModifiers mapOverride(-1.0f, 0.01f, -1.0f, -1.0f, -1.0f, -1.0f);
+
+    AutoBalanceScalingMap map = MakeMap(5);
+    map.statModifierOverride = &mapOverride;
+
+    StatMultiplierDisplay display = calculateDisplayMultipliers(settings, map, false, 5.0f);
+    EXPECT_NEAR(display.healthPercent, 100.0f, 1e-3f);
+    EXPECT_NEAR(display.damagePercent, 100.0f, 1e-3f);
+
+    // and are capped at the minimum modifiers
+    settings.statModifiers[AUTOBALANCE_TIER_DUNGEON][false].health = 0.0f;
+    EXPECT_FLOAT_EQ(calculateDisplayMultipliers(settings, map, false, 5.0f).healthPercent, settings.minHPModifier * 100.0f);
+}
+
+TEST(ABScalingCore, WorldMultiplierUsesTheMapStatModifiers)
+{
+    AutoBalanceScalingSettings settings;
+
+    AutoBalanceStatModifiers mapOverride(-1.0f, -1.0f, -1.0f, -1.0f, 0.5f, -1.0f);
+
+    AutoBalanceScalingMap map = MakeMap(5);
+    map.statModifierOverride = &mapOverride;
+
+    EXPECT_NEAR(calculateWorldMultiplier(settings, map, AUTOBALANCE_HEALTH, 5.0f), 1.0f, 1e-5f);
+    EXPECT_NEAR(calculateWorldMultiplier(settings, map, AUTOBALANCE_DAMAGE_HEALING, 5.0f), 0.5f, 1e-5f);
+}
+
+TEST(ABScalingCore, WorldMultiplierLevelScalingSkipRange)
+{
+    EXPECT_FALSE(isWorldMultiplierLevelScaled(false, 70.0f, 80, 0, 0));
+    EXPECT_TRUE(isWorldMultiplierLevelScaled(true, 80.0f, 80, 0, 5));
+    EXPECT_FALSE(isWorldMultiplierLevelScaled(true, 78.0f, 80, 5, 5));
+    EXPECT_TRUE(isWorldMultiplierLevelScaled(true, 70.0f, 80, 5, 5));
+}
+
+//
+// Creature multipliers
+//
+
+TEST(ABScalingCore, CreatureMultipliersApplyTheMinimums)
+{
+    AutoBalanceScalingSettings settings;
+
+    AutoBalanceScalingCreature creature;
+    creature.statModifiers = AutoBalanceStatModifiers(1.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f);
+    creature.baseHealth    = 1000.0f;
+    creature.baseMana      = 500.0f;
+    creature.baseArmor     = 200.0f;
+
+    CreatureCurveMultipliers curveMultipliers = { 0.05f, 0.001f, 0.001f, 0.001f };
+
+    AutoBalanceCreatureMultipliers multipliers = calculateCreatureMultipliers(settings, curveMultipliers, creature);
+    EXPECT_FLOAT_EQ(multipliers.healthMultiplier, settings.minHPModifier);
+    EXPECT_FLOAT_EQ(multipliers.manaMultiplier, settings.minManaModifier);
+    EXPECT_FLOAT_EQ(multipliers.damageMultiplier, settings.minDamageModifier);
+    EXPECT_FLOAT_EQ(multipliers.armorMultiplier, 0.001f); // armor has no minimum
+    EXPECT_EQ(multipliers.health, 100u);
+    EXPECT_EQ(multipliers.mana, 5u);
+    EXPECT_EQ(multipliers.armor, 0u);
+    EXPECT_FLOAT_EQ(multipliers.ccDurationMultiplier, 1.0f);
+}
+
+TEST(ABScalingCore, CreaturesWithoutManaKeepNone)
+{
+    AutoBalanceScalingSettings settings;
+
+    AutoBalanceScalingCreature creature;
+    creature.baseHealth = 1000.0f;
+
+    AutoBalanceCreatureMultipliers multipliers = calculateCreatureMultipliers(settings, { 1.0f, 1.0f, 1.0f, 1.0f }, creature);
+    EXPECT_EQ(multipliers.mana, 0u);
+    EXPECT_FLOAT_EQ(multipliers.manaMultiplier, 0.0f);
+    EXPECT_FLOAT_EQ(multipliers.scaledManaMultiplier, 0.0f);
+}
+
+TEST(ABScalingCore, LevelRatiosScaleTheMultipliers)
+{
+    AutoBalanceScalingSettings settings;
+
+    AutoBalanceScalingCreature creature;
+    creature.baseHealth       = 1000.0f;
+    creature.baseMana         = 400.0f;
+    creature.baseArmor        = 300.0f;
+    creature.healthLevelRatio = 2.0f;
+    creature.manaLevelRatio   = 1.5f;
+    creature.armorLevelRatio  = 3.0f;
+    creature.damageLevelRatio = 4.0f;
+
+    AutoBalanceCreatureMultipliers multipliers = calculateCreatureMultipliers(settings, { 0.5f, 0.5f, 0.5f, 0.5f }, creature);
+    EXPECT_FLOAT_EQ(multipliers.healthMultiplier, 0.5f);
+    EXPECT_FLOAT_EQ(multipliers.scaledHealthMultiplier, 1.0f);
+    EXPECT_EQ(multipliers.health, 1000u);
+    EXPECT_EQ(multipliers.mana, 300u);
+    EXPECT_EQ(multipliers.armor, 450u);
+    EXPECT_FLOAT_EQ(multipliers.scaledDamageMultiplier, 2.0f);
+}
+
+TEST(ABScalingCore, RewardScalingMethods)
+{
+    AutoBalanceScalingSettings settings;
+    settings.rewardScalingXPModifier    = 2.0f;
+    settings.rewardScalingMoneyModifier = 0.5f;
+
+    AutoBalanceScalingCreature creature;
+    creature.baseHealth       = 1000.0f;
+    creature.damageLevelRatio = 2.0f;
+
+    CreatureCurveMultipliers curveMultipliers = { 0.5f, 1.0f, 1.0f, 0.5f };
+
+    // dynamic: the average of the scaled health (0.5) and damage (1.0) multipliers, times the modifier
+    AutoBalanceCreatureMultipliers multipliers = calculateCreatureMultipliers(settings, curveMultipliers, creature);
+    EXPECT_FLOAT_EQ(multipliers.xpModifier, 1.5f);
+    EXPECT_FLOAT_EQ(multipliers.moneyModifier, 0.375f);
+
+    settings.rewardScalingMethod = AUTOBALANCE_SCALING_FIXED;
+    multipliers = calculateCreatureMultipliers(settings, curveMultipliers, creature);
+    EXPECT_FLOAT_EQ(multipliers.xpModifier, 2.0f);
+    EXPECT_FLOAT_EQ(multipliers.moneyModifier, 0.5f);
+
+    settings.rewardScalingXP    = false;
+    settings.rewardScalingMoney = false;
+    multipliers = calculateCreatureMultipliers(settings, curveMultipliers, creature);
+    EXPECT_FLOAT_EQ(multipliers.xpModifier, 1.0f);
+    EXPECT_FLOAT_EQ(multipliers.moneyModifier, 1.0f);
+}
+
+TEST(ABScalingCore, MapMultipliersMatchACreatureWithoutOverrides)
+{
+    AutoBalanceScalingSettings settings;
+    settings.statModifiers[AUTOBALANCE_TIER_RAID_25M][true] = AutoBalanceStatModifiers(1.0f, 1.2f, 0.5f, 1.0f, 0.8f, 0.9f);
+
+    AutoBalanceStatModifiers statModifierOverride(1.0f, -1.0f, -1.0f, 2.0f, -1.0f, -1.0f);
+    AutoBalanceScalingMap map = MakeMap(25);
+    map.statModifierBossOverride = &statModifierOverride;
+
+    for (float playerCount : { 1.0f, 10.0f, 25.0f })
+    {
+        CreatureCurveMultipliers curveMultipliers = calculateCurveMultipliers(settings, map, true, playerCount);
+
+        AutoBalanceScalingCreature creature;
+        creature.defaultMultiplier = curveMultipliers.health;
+        creature.statModifiers     = selectStatModifiers(settings, map, true);
+        creature.baseHealth        = 1000.0f;
+        creature.baseMana          = 1000.0f;
+        creature.baseArmor         = 1000.0f;
+
+        AutoBalanceCreatureMultipliers expected = calculateCreatureMultipliers(settings, curveMultipliers, creature);
+        AutoBalanceCreatureMultipliers actual   = calculateMapMultipliers(settings, map, true, playerCount);
+
+        EXPECT_FLOAT_EQ(actual.healthMultiplier, expected.healthMultiplier);
+        EXPECT_FLOAT_EQ(actual.manaMultiplier, expected.manaMultiplier);
+        EXPECT_FLOAT_EQ(actual.armorMultiplier, expected.armorMultiplier);
+        EXPECT_FLOAT_EQ(actual.damageMultiplier, expected.damageMultiplier);
+        EXPECT_FLOAT_EQ(actual.ccDurationMultiplier, expected.ccDurationMultiplier);
+        EXPECT_FLOAT_EQ(actual.xpModifier, expected.xpModifier);
+        EXPECT_FLOAT_EQ(actual.moneyModifier, expected.moneyModifier);
+    }
+
+    // the per-instance armor override applies on top of the tier
+    CreatureCurveMultipliers curveMultipliers = calculateCurveMultipliers(settings, map, true, 25.0f);
+    EXPECT_FLOAT_EQ(calculateMapMultipliers(settings, map, true, 25.0f).armorMultiplier, curveMultipliers.armor * 2.0f);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE
+ */
+
+#include "ABScalingSettings.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+namespace
+{
+    // A config made of the given key/value pairs, every other key is unset
+    class MapConfigSource : public AutoBalanceConfigSource
+    {
+    public:
+        explicit MapConfigSource(std::map<std::string, std::string> values) : _values(std::move(values)) {}
+
+        bool GetBool(std::string const& name, bool defaultValue) const override
+        {
+            auto itr = _values.find(name);
+            return itr == _values.end() ? defaultValue : (itr->second == "1" || itr->second == "true");
+        }
+
+        float GetFloat(std::string const& name, float defaultValue) const override
+        {
+            auto itr = _values.find(name);
+            return itr == _values.end() ? defaultValue : std::stof(itr->second);
+        }
+
+        std::string GetString(std::string const& name, std::string const& defaultValue) const override
+        {
+            auto itr = _values.find(name);
+            return itr == _values.end() ? defaultValue : itr->second;
+        }
+
+    private:
+        std::map<std::string, std::string> _values;
+    };
+
+    AutoBalanceScalingSettings Load(std::map<std::string, std::string> values, std::vector<std::string>* errors = nullptr)
+    {
+        AutoBalanceScalingSettings settings;
+        std::vector<std::string> loadErrors;
+
+        LoadScalingSettings(settings, MapConfigSource(std::move(values)), loadErrors);
+
+        if (errors)
+            *errors = loadErrors;
+
+        return settings;
+    }
+}
+
+TEST(ABScalingSettings, DefaultsWithAnEmptyConfig)
+{
+    std::vector<std::string> errors;
+    AutoBalanceScalingSettings settings = Load({}, &errors);
+
+    EXPECT_TRUE(errors.empty());
+
+    for (AutoBalanceInflectionPointTier const& tier : settings.inflectionPoints)
+    {
+        EXPECT_FLOAT_EQ(tier.inflectionPoint, 0.5f);
+        EXPECT_FLOAT_EQ(tier.bossModifier, 1.0f);
+        EXPECT_FLOAT_EQ(tier.bossInflectionPoint, -1.0f);
+    }
+
+    for (AutoBalanceStatModifiers const (&tier)[2] : settings.statModifiers)
+    {
+        EXPECT_FLOAT_EQ(tier[false].global, 1.0f);
+        EXPECT_FLOAT_EQ(tier[true].ccduration, -1.0f);
+    }
+
+    EXPECT_EQ(settings.formulaTypes[true][AUTOBALANCE_STAT_DAMAGE], AUTOBALANCE_FORMULA_TAN);
+    EXPECT_FLOAT_EQ(settings.minHPModifier, 0.1f);
+    EXPECT_EQ(settings.rewardScalingMethod, AUTOBALANCE_SCALING_DYNAMIC);
+    EXPECT_TRUE(settings.rewardScalingXP);
+}
+
+TEST(ABScalingSettings, SizedRaidTiersFallBackToTheirParent)
+{
+    AutoBalanceScalingSettings settings = Load({
+        { "AutoBalance.InflectionPointRaid",               "0.7" },
+        { "AutoBalance.InflectionPointRaid.CurveFloor",    "0.2" },
+        { "AutoBalance.InflectionPointRaid25M",            "0.6" },
+        { "AutoBalance.InflectionPointRaidHeroic.Damage",  "0.9" },
+        { "AutoBalance.StatModifierRaid.Health",           "1.3" },
+        { "AutoBalance.StatModifierRaid.Boss.Damage",      "1.2" },
+        { "AutoBalance.StatModifierRaid10M.Health",        "1.1" }
+    });
+
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_10M].inflectionPoint, 0.7f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_25M].inflectionPoint, 0.6f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_25M].curveFloor, 0.2f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON].inflectionPoint, 0.5f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_HEROIC_RAID_25M].statInflectionPoint[AUTOBALANCE_STAT_DAMAGE], 0.9f);
+
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_RAID_10M][false].health, 1.1f);
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_RAID_40M][false].health, 1.3f);
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_RAID_40M][true].damage, 1.2f);
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_RAID_40M][true].health, 1.0f);
+}
+
+TEST(ABScalingSettings, OnlyBaseTiersReadBossStatInflectionPoints)
+{
+    AutoBalanceScalingSettings settings = Load({
+        { "AutoBalance.InflectionPointRaid.Boss.Health",    "0.4" },
+        { "AutoBalance.InflectionPointRaid10M.Boss.Health", "0.3" }
+    });
+
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID].bossStatInflectionPoint[AUTOBALANCE_STAT_HEALTH], 0.4f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_10M].bossStatInflectionPoint[AUTOBALANCE_STAT_HEALTH], -1.0f);
+}
+
+TEST(ABScalingSettings, Raid40MBossInflectionIsRead)
+{
+    AutoBalanceScalingSettings settings = Load({
+        { "AutoBalance.InflectionPointRaid.BossInflection",    "0.8" },
+        { "AutoBalance.InflectionPointRaid40M.BossInflection", "0.6" }
+    });
+
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_40M].bossInflectionPoint, 0.6f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_25M].bossInflectionPoint, 0.8f);
+}
+
+TEST(ABScalingSettings, DeprecatedKeysAreFallbacks)
+{
+    AutoBalanceScalingSettings settings = Load({
+        { "AutoBalance.BossInflectionMult",      "1.5" },
+        { "AutoBalance.rate.health",             "2.0" },
+        { "AutoBalance.StatModifierHeroic.Health", "3.0" },
+        { "AutoBalance.DungeonScaleDownXP",      "0" }
+    });
+
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_DUNGEON].bossModifier, 1.5f);
+    EXPECT_FLOAT_EQ(settings.inflectionPoints[AUTOBALANCE_TIER_RAID_10M].bossModifier, 1.5f);
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_DUNGEON][false].health, 2.0f);
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_DUNGEON][true].health, 2.0f);
+    EXPECT_FLOAT_EQ(settings.statModifiers[AUTOBALANCE_TIER_HEROIC_DUNGEON][false].health, 3.0f);
+    EXPECT_FALSE(settings.rewardScalingXP);
+    EXPECT_TRUE(settings.rewardScalingMoney);
+}
+
+TEST(ABScalingSettings, FormulaTypes)
+{
+    AutoBalanceScalingSettings settings = Load({
+        { "AutoBalance.FormulaType.Mana",        "log" },
+        { "AutoBalance.FormulaType.Boss.Damage", "pol" },
+        { "AutoBalance.FormulaType.Armor",       "nonsense" }
+    });
+
+    EXPECT_EQ(settings.formulaTypes[false][AUTOBALANCE_STAT_MANA], AUTOBALANCE_FORMULA_LOG);
+    EXPECT_EQ(settings.formulaTypes[true][AUTOBALANCE_STAT_DAMAGE], AUTOBALANCE_FORMULA_POL);
+    EXPECT_EQ(settings.formulaTypes[false][AUTOBALANCE_STAT_DAMAGE], AUTOBALANCE_FORMULA_TAN);
+    EXPECT_EQ(settings.formulaTypes[false][AUTOBALANCE_STAT_ARMOR], AUTOBALANCE_FORMULA_TAN);
+}
+
+TEST(ABScalingSettings, InvalidRewardScalingMethodIsReported)
+{
+    std::vector<std::string> errors;
+    AutoBalanceScalingSettings settings = Load({ { "AutoBalance.RewardScaling.Method", "sometimes" } }, &errors);
+
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_NE(errors[0].find("sometimes"), std::string::npos);
+    EXPECT_EQ(settings.rewardScalingMethod, AUTOBALANCE_SCALING_DYNAMIC);
+
+    settings = Load({ { "AutoBalance.RewardScaling.Method", "fixed" } });
+    EXPECT_EQ(settings.rewardScalingMethod, AUTOBALANCE_SCALING_FIXED);
+}